@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Minimal harness for the runtime benchmarks.
+///
+/// Each benchmark executable collects its measurements to a suite,
+/// which prints them as JSON to stdout and to the file given as the first argument.
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <print>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace waylander {
+namespace benchmarks {
+
+/// Prevents the compiler from optimizing away computation of \p value.
+template<typename T>
+void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class suite {
+    struct result {
+        std::string name;
+        std::size_t rounds;
+        std::size_t items;
+        double seconds;
+    };
+
+    std::string name_;
+    std::vector<result> results_{};
+
+  public:
+    [[nodiscard]] explicit suite(std::string name) : name_{ std::move(name) } {}
+
+    /// Measures calling \p body \p rounds times, after calling it once to warm up.
+    ///
+    /// \p body returns the amount of items it processed, e.g. messages or bytes.
+    void measure(std::string name, const std::size_t rounds, std::invocable auto&& body) {
+        do_not_optimize(body());
+
+        auto items       = 0uz;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0uz; i < rounds; ++i) { items += body(); }
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto seconds = std::chrono::duration<double>(end - start).count();
+        std::println(stderr,
+                     "{:<48} {:>14.0f} items/s {:>10.1f} ns/round",
+                     name,
+                     static_cast<double>(items) / seconds,
+                     seconds * 1e9 / static_cast<double>(rounds));
+        results_.push_back({ std::move(name), rounds, items, seconds });
+    }
+
+    [[nodiscard]] auto json() const -> std::string {
+        auto out = std::format("{{\n    \"suite\": \"{}\",\n    \"results\": [", name_);
+        for (auto i = 0uz; i < results_.size(); ++i) {
+            const auto& r = results_[i];
+            out += std::format(
+                "{}\n        {{ \"name\": \"{}\", \"rounds\": {}, \"items\": {}, "
+                "\"seconds\": {}, \"items_per_second\": {}, \"ns_per_round\": {} }}",
+                i == 0 ? "" : ",",
+                r.name,
+                r.rounds,
+                r.items,
+                r.seconds,
+                static_cast<double>(r.items) / r.seconds,
+                r.seconds * 1e9 / static_cast<double>(r.rounds));
+        }
+        out += "\n    ]\n}\n";
+        return out;
+    }
+
+    /// Prints the results as JSON to stdout and to file argv[1] if given.
+    [[nodiscard]] auto report(const int argc, char** const argv) const -> int {
+        const auto results = json();
+        std::print("{}", results);
+        if (argc > 1) {
+            auto file = std::ofstream{ argv[1] };
+            file << results;
+            if (not file) { return 1; }
+        }
+        return 0;
+    }
+};
+
+} // namespace benchmarks
+} // namespace waylander
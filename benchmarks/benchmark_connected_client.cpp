@@ -0,0 +1,78 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Measures roundtrips through connected_client over a socket pair.
+///
+/// The other end of the socket pair plays the compositor in the same thread:
+/// it reads the wl_display::sync request and answers with wl_callback::done.
+/// Run with `meson test --benchmark`.
+
+#include <cstddef>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+    using wl_display  = wl::protocols::wl_display;
+    using wl_callback = wl::protocols::wl_callback;
+    using sync        = wl_display::request::sync;
+    using done        = wl_callback::event::done;
+
+    static constexpr auto roundtrips_per_round = 1'000uz;
+    static constexpr auto rounds               = 10uz;
+
+    auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+    auto client                     = wl::connected_client{ std::move(client_sock) };
+    const auto callback             = client.reserve_object_id<wl_callback>();
+
+    constexpr auto request_size =
+        sizeof(wl::message_header<wl_display>) + wl::message_payload_size(sync{});
+    auto request_bytes = sstd::byte_vec(request_size);
+
+    const auto done_event = [&] {
+        auto buff = wl::message_buffer{};
+        buff.append(callback, done{ .callback_data{ 0u } });
+        return buff.release_data();
+    }();
+
+    auto ov = wl::message_overload_set{};
+
+    auto results = benchmarks::suite{ "connected_client" };
+    results.measure("sync roundtrip", rounds, [&] {
+        for (auto i = 0uz; i < roundtrips_per_round; ++i) {
+            client.register_request(wl::global_display_object, sync{ .callback{ callback } });
+            client.flush_registered_requests();
+
+            server_sock.read(request_bytes);
+            server_sock.write(done_event);
+
+            client.recv_and_visit_events(ov).until<done>(callback);
+        }
+        return roundtrips_per_round;
+    });
+
+    return results.report(argc, argv);
+}
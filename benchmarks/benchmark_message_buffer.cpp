@@ -0,0 +1,128 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Measures message_buffer::append for messages of each argument kind.
+///
+/// Run with `meson test --benchmark`.
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "gnulander/memory_block.hpp"
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+// Include other protocols after core protocol.
+#include "waylander/wayland/protocols/viewporter_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+#include "benchmark.hpp"
+
+namespace {
+
+using namespace waylander;
+
+constexpr auto messages_per_round = 1'000uz;
+constexpr auto rounds             = 1'000uz;
+
+/// Appends \p msg to \p buff messages_per_round times, reusing the storage between rounds.
+void measure_append(benchmarks::suite& results,
+                    std::string name,
+                    wl::message_buffer& buff,
+                    const auto obj,
+                    const auto& msg) {
+    results.measure(std::move(name), rounds, [&] {
+        buff.clear();
+        for (auto i = 0uz; i < messages_per_round; ++i) { buff.append(obj, msg); }
+        benchmarks::do_not_optimize(buff.data().data());
+        return messages_per_round;
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace wl::protocols;
+
+    auto results = benchmarks::suite{ "message_buffer_append" };
+    auto buff    = wl::message_buffer{};
+
+    measure_append(results,
+                   "Wint (wl_surface::offset)",
+                   buff,
+                   wl::Wobject<wl_surface>{ 3u },
+                   wl_surface::request::offset{ .x{ 1 }, .y{ 2 } });
+
+    measure_append(results,
+                   "Wuint (xdg_wm_base::pong)",
+                   buff,
+                   wl::Wobject<xdg_wm_base>{ 3u },
+                   xdg_wm_base::request::pong{ .serial{ 42u } });
+
+    measure_append(results,
+                   "Wfixed (wp_viewport::set_source)",
+                   buff,
+                   wl::Wobject<wp_viewport>{ 3u },
+                   wp_viewport::request::set_source{ .x{ wl::Wfixed::from_double(0.5) },
+                                                     .y{ wl::Wfixed::from_double(1.5) },
+                                                     .width{ wl::Wfixed::from_int(64) },
+                                                     .height{ wl::Wfixed::from_int(64) } });
+
+    measure_append(results,
+                   "Wobject (wl_surface::attach)",
+                   buff,
+                   wl::Wobject<wl_surface>{ 3u },
+                   wl_surface::request::attach{ .buffer{ 4u }, .x{ 0 }, .y{ 0 } });
+
+    measure_append(results,
+                   "Wnew_id (wl_display::sync)",
+                   buff,
+                   wl::global_display_object,
+                   wl_display::request::sync{ .callback{ 4u } });
+
+    measure_append(results,
+                   "enum (xdg_toplevel::resize)",
+                   buff,
+                   wl::Wobject<xdg_toplevel>{ 3u },
+                   xdg_toplevel::request::resize{ .seat{ 4u },
+                                                  .serial{ 42u },
+                                                  .edges = xdg_toplevel::resize_edge::Ebottom });
+
+    measure_append(results,
+                   "Wstring (xdg_toplevel::set_title)",
+                   buff,
+                   wl::Wobject<xdg_toplevel>{ 3u },
+                   xdg_toplevel::request::set_title{ .title{ u8"waylander benchmark" } });
+
+    const auto keys = std::array<std::byte, 16>{};
+    measure_append(results,
+                   "Warray (wl_keyboard::enter)",
+                   buff,
+                   wl::Wobject<wl_keyboard>{ 3u },
+                   wl_keyboard::event::enter{ .serial{ 42u }, .surface{ 4u }, .keys{ keys } });
+
+    auto mem = gnulander::memory_block{};
+    measure_append(results,
+                   "Wfd (wl_shm::create_pool)",
+                   buff,
+                   wl::Wobject<wl_shm>{ 3u },
+                   wl_shm::request::create_pool{ .id{ 4u },
+                                                 .fd{ gnulander::fd_ref{ mem } },
+                                                 .size{ 4096 } });
+
+    return results.report(argc, argv);
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Measures interpert_message_payload with both decode policies.
+///
+/// Run with `meson test --benchmark`.
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+// Include other protocols after core protocol.
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+#include "benchmark.hpp"
+
+namespace {
+
+using namespace waylander;
+
+constexpr auto decodes_per_round = 10'000uz;
+constexpr auto rounds            = 100uz;
+
+/// Decodes payload of \p msg decodes_per_round times with both decode policies.
+template<typename Msg>
+void measure_decode(benchmarks::suite& results,
+                    const std::string& name,
+                    const auto obj,
+                    const Msg& msg) {
+    auto buff = wl::message_buffer{};
+    buff.append(obj, msg);
+    const auto data    = buff.release_data();
+    const auto payload = wl::parse_first_message(data).arguments;
+
+    const auto measure = [&]<wl::decode_policy Policy>(const std::string& policy_name) {
+        results.measure(name + " " + policy_name, rounds, [&] {
+            for (auto i = 0uz; i < decodes_per_round; ++i) {
+                benchmarks::do_not_optimize(wl::interpert_message_payload<Msg, Policy>(payload));
+            }
+            return decodes_per_round;
+        });
+    };
+    measure.template operator()<wl::decode_policy::checked>("checked");
+    measure.template operator()<wl::decode_policy::trusted>("trusted");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace wl::protocols;
+
+    auto results = benchmarks::suite{ "interpert_message_payload" };
+
+    measure_decode(results,
+                   "wl_pointer::motion",
+                   wl::Wobject<wl_pointer>{ 3u },
+                   wl_pointer::event::motion{ .time{ 1u },
+                                              .surface_x{ wl::Wfixed::from_double(10.5) },
+                                              .surface_y{ wl::Wfixed::from_double(20.5) } });
+
+    measure_decode(results,
+                   "wl_registry::global",
+                   wl::Wobject<wl_registry>{ 2u },
+                   wl_registry::event::global{ .name{ 7u },
+                                               .interface{ u8"xdg_wm_base" },
+                                               .version{ 6u } });
+
+    measure_decode(results,
+                   "xdg_toplevel::configure",
+                   wl::Wobject<xdg_toplevel>{ 3u },
+                   xdg_toplevel::event::configure{ .width{ 640 }, .height{ 480 }, .states{} });
+
+    return results.report(argc, argv);
+}
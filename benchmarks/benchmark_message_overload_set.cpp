@@ -0,0 +1,57 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Measures message_overload_set::overload_resolution with different amounts of objects.
+///
+/// Run with `meson test --benchmark`.
+
+#include <cstddef>
+#include <format>
+
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+    using wl_callback = wl::protocols::wl_callback;
+    using done        = wl_callback::event::done;
+
+    static constexpr auto lookups_per_round = 10'000uz;
+    static constexpr auto rounds            = 100uz;
+    static constexpr auto first_id          = 2u;
+
+    auto results = benchmarks::suite{ "message_overload_set" };
+
+    for (const auto objects : { 1u, 16u, 256u, 4096u }) {
+        auto ov = wl::message_overload_set{};
+        for (auto id = first_id; id < first_id + objects; ++id) {
+            ov.add_overload<done>(wl::Wobject<wl_callback>{ id }, [](const done&) {});
+        }
+
+        results.measure(std::format("overload_resolution with {} objects", objects), rounds, [&] {
+            for (auto i = 0u; i < lookups_per_round; ++i) {
+                const auto id = first_id + i % objects;
+                benchmarks::do_not_optimize(
+                    ov.overload_resolution({ id }, { done::opcode.value }).has_value());
+            }
+            return lookups_per_round;
+        });
+    }
+
+    return results.report(argc, argv);
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Compares throughput of parsed_message_generator and parsed_message_range.
+///
+/// Run with `meson test --benchmark`.
+
+#include <cstddef>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+    using wl_surface    = wl::protocols::wl_surface;
+    using damage_buffer = wl_surface::request::damage_buffer;
+    using frame         = wl_surface::request::frame;
+    using commit        = wl_surface::request::commit;
+
+    static constexpr auto frames = 10'000uz;
+    static constexpr auto rounds = 100uz;
+
+    const auto surface = wl::Wobject<wl_surface>{ 3u };
+    auto buff          = wl::message_buffer{};
+    for (auto i = 0uz; i < frames; ++i) {
+        buff.append(surface, damage_buffer{ .x{ 0 }, .y{ 0 }, .width{ 64 }, .height{ 64 } });
+        buff.append(surface, frame{ .callback{ 4u } });
+        buff.append(surface, commit{});
+    }
+    const auto data = buff.release_data();
+
+    const auto count_messages = [](auto&& msg_range) {
+        auto count = 0uz;
+        for (const auto& msg : msg_range) {
+            benchmarks::do_not_optimize(msg.arguments.size());
+            ++count;
+        }
+        return count;
+    };
+
+    auto results = benchmarks::suite{ "message_parsing" };
+    results.measure("parsed_message_generator", rounds, [&] {
+        return count_messages(wl::parsed_message_generator(data));
+    });
+    results.measure("parsed_message_range", rounds, [&] {
+        return count_messages(wl::parsed_message_range{ data });
+    });
+    results.measure("unchecked_parsed_message_range", rounds, [&] {
+        return count_messages(wl::unchecked_parsed_message_range{ data });
+    });
+    return results.report(argc, argv);
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Measures a client running against mock_compositor over a socket pair.
+///
+/// Startup is get_registry, binding of the globals and a sync roundtrip.
+/// Frame loop attaches a buffer to a surface, commits and waits for the frame callback.
+/// Run with `meson test --benchmark`.
+
+#include <cstddef>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+#include "gnulander/memory_block.hpp"
+
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+#include "benchmark.hpp"
+#include "mock_compositor.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+    using namespace wl::protocols;
+
+    static constexpr auto startups_per_round = 100uz;
+    static constexpr auto frames_per_round   = 1'000uz;
+    static constexpr auto rounds             = 10uz;
+
+    auto results = benchmarks::suite{ "mock_compositor" };
+
+    results.measure("startup", rounds, [&] {
+        for (auto i = 0uz; i < startups_per_round; ++i) {
+            auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+            auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+            auto client                     = wl::connected_client{ std::move(client_sock) };
+
+            const auto registry = client.reserve_object_id<wl_registry>();
+            client.register_request(wl::global_display_object,
+                                    wl_display::request::get_registry{ registry });
+
+            auto ov = wl::message_overload_set{};
+            ov.add_overload<wl_registry::event::global>(registry, [&](const auto& global) {
+                const auto id = client.reserve_object_id();
+                client.register_request(registry,
+                                        wl_registry::request::bind{
+                                            .name                     = global.name,
+                                            .new_id_interface         = global.interface,
+                                            .new_id_interface_version = global.version,
+                                            .id{ id.value } });
+            });
+
+            auto callback = client.reserve_object_id<wl_callback>();
+            client.register_request(wl::global_display_object,
+                                    wl_display::request::sync{ callback });
+            client.flush_registered_requests();
+            compositor.dispatch();
+            client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+
+            callback = client.reserve_object_id<wl_callback>();
+            client.register_request(wl::global_display_object,
+                                    wl_display::request::sync{ callback });
+            client.flush_registered_requests();
+            compositor.dispatch();
+            client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+        }
+        return startups_per_round;
+    });
+
+    auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+    auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+    auto client                     = wl::connected_client{ std::move(client_sock) };
+
+    // Globals are bound by their known names, as the registry events are not needed.
+    const auto registry       = client.reserve_object_id<wl_registry>();
+    const auto compositor_obj = client.reserve_object_id<wl_compositor>();
+    const auto shm            = client.reserve_object_id<wl_shm>();
+    const auto pool           = client.reserve_object_id<wl_shm_pool>();
+    const auto buffer         = client.reserve_object_id<wl_buffer>();
+    const auto surface        = client.reserve_object_id<wl_surface>();
+
+    static constexpr auto size = 64 * 64 * 4;
+    auto mem                   = gnulander::memory_block{};
+    mem.truncate(size);
+
+    client.register_request(wl::global_display_object,
+                            wl_display::request::get_registry{ registry });
+    client.register_request(registry,
+                            wl_registry::request::bind{
+                                .name{ wl::mock_compositor::compositor_global },
+                                .new_id_interface{ wl_compositor::name },
+                                .new_id_interface_version{ wl_compositor::version },
+                                .id{ compositor_obj.value } });
+    client.register_request(registry,
+                            wl_registry::request::bind{
+                                .name{ wl::mock_compositor::shm_global },
+                                .new_id_interface{ wl_shm::name },
+                                .new_id_interface_version{ wl_shm::version },
+                                .id{ shm.value } });
+    client.register_request(shm,
+                            wl_shm::request::create_pool{ .id{ pool },
+                                                          .fd{ gnulander::fd_ref{ mem } },
+                                                          .size{ size } });
+    client.register_request(pool,
+                            wl_shm_pool::request::create_buffer{
+                                .id{ buffer },
+                                .offset{ 0 },
+                                .width{ 64 },
+                                .height{ 64 },
+                                .stride{ 64 * 4 },
+                                .format = wl_shm::format::Eargb8888 });
+    client.register_request(compositor_obj, wl_compositor::request::create_surface{ surface });
+
+    auto ov = wl::message_overload_set{};
+
+    results.measure("frame loop", rounds, [&] {
+        for (auto i = 0uz; i < frames_per_round; ++i) {
+            const auto callback = client.reserve_object_id<wl_callback>();
+            client.register_request(surface, wl_surface::request::attach{ buffer, { 0 }, { 0 } });
+            client.register_request(surface, wl_surface::request::frame{ callback });
+            client.register_request(surface, wl_surface::request::commit{});
+            client.flush_registered_requests();
+            compositor.dispatch();
+            client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+        }
+        return frames_per_round;
+    });
+
+    return results.report(argc, argv);
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Instantiates encoding and decoding of messages of generated protocols.
+///
+/// Not meant to be run. Benchmark measure_compile_time.py times compiling this,
+/// to track the compile-time cost of using generated protocol headers.
+/// First WAYLANDER_BENCHMARK_MESSAGES requests of every interface are instantiated through
+/// connected_client::register_request and first WAYLANDER_BENCHMARK_MESSAGES events
+/// through message_overload_set::add_overload and interpert_message_payload.
+/// Only protocol WAYLANDER_BENCHMARK_PROTOCOL_<NAME> is instantiated if one is defined.
+/// Run with `meson test --benchmark`.
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "waylander/type_utils.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+// Include other protocols after core protocol.
+#include "waylander/wayland/protocols/linux_dmabuf_v1_protocol.hpp"
+#include "waylander/wayland/protocols/presentation_time_protocol.hpp"
+#include "waylander/wayland/protocols/tablet_v2_protocol.hpp"
+#include "waylander/wayland/protocols/viewporter_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+#ifndef WAYLANDER_BENCHMARK_MESSAGES
+    #define WAYLANDER_BENCHMARK_MESSAGES 1000
+#endif
+
+#if not defined(WAYLANDER_BENCHMARK_PROTOCOL_WAYLAND)                                             \
+    and not defined(WAYLANDER_BENCHMARK_PROTOCOL_LINUX_DMABUF_V1)                                 \
+    and not defined(WAYLANDER_BENCHMARK_PROTOCOL_PRESENTATION_TIME)                               \
+    and not defined(WAYLANDER_BENCHMARK_PROTOCOL_TABLET_V2)                                       \
+    and not defined(WAYLANDER_BENCHMARK_PROTOCOL_VIEWPORTER)                                      \
+    and not defined(WAYLANDER_BENCHMARK_PROTOCOL_XDG_SHELL)
+    #define WAYLANDER_BENCHMARK_PROTOCOL_WAYLAND
+    #define WAYLANDER_BENCHMARK_PROTOCOL_LINUX_DMABUF_V1
+    #define WAYLANDER_BENCHMARK_PROTOCOL_PRESENTATION_TIME
+    #define WAYLANDER_BENCHMARK_PROTOCOL_TABLET_V2
+    #define WAYLANDER_BENCHMARK_PROTOCOL_VIEWPORTER
+    #define WAYLANDER_BENCHMARK_PROTOCOL_XDG_SHELL
+#endif
+
+namespace {
+
+using namespace waylander;
+
+constexpr auto messages_per_interface = std::size_t{ WAYLANDER_BENCHMARK_MESSAGES };
+
+template<typename>
+struct has_fd_argument;
+
+template<typename... Args>
+struct has_fd_argument<sstd::type_list<Args...>> :
+    std::bool_constant<(std::same_as<Args, wl::Wfd> or ...)> {};
+
+template<wl::interface W, typename Request>
+void encode(wl::connected_client& client, const Request& msg) {
+    client.register_request(wl::Wobject<W>{}, msg);
+}
+
+template<wl::interface W, typename Event>
+void decode(wl::message_overload_set& overloads, const std::span<const std::byte> payload) {
+    // Decoding of file descriptors is not supported yet.
+    if constexpr (not has_fd_argument<wl::message_args_to_type_list<Event>>::value) {
+        overloads.add_overload<Event>(wl::Wobject<W>{}, [](const Event&) {});
+        std::ignore = wl::interpert_message_payload<Event, wl::decode_policy::trusted>(payload);
+    }
+}
+
+/// Taking the addresses instantiates the function templates.
+template<wl::interface W, typename... Requests, typename... Events>
+constexpr auto instantiate(wl::message_list<Requests...>, wl::message_list<Events...>) {
+    constexpr auto requests = std::min(messages_per_interface, sizeof...(Requests));
+    constexpr auto events   = std::min(messages_per_interface, sizeof...(Events));
+    return []<std::size_t... R, std::size_t... E>(std::index_sequence<R...>,
+                                                  std::index_sequence<E...>) {
+        return std::tuple{ &encode<W, sstd::pack_element_t<R, Requests...>>...,
+                           &decode<W, sstd::pack_element_t<E, Events...>>... };
+    }(std::make_index_sequence<requests>{}, std::make_index_sequence<events>{});
+}
+
+template<wl::interface... W>
+constexpr auto instantiate_interfaces() {
+    return std::tuple{ instantiate<W>(typename W::request_list{}, typename W::event_list{})... };
+}
+
+using namespace wl::protocols;
+
+#ifdef WAYLANDER_BENCHMARK_PROTOCOL_WAYLAND
+[[maybe_unused]] constexpr auto wayland_instantiations =
+    instantiate_interfaces<wl_display,
+                           wl_registry,
+                           wl_callback,
+                           wl_compositor,
+                           wl_shm_pool,
+                           wl_shm,
+                           wl_buffer,
+                           wl_data_offer,
+                           wl_data_source,
+                           wl_data_device,
+                           wl_data_device_manager,
+                           wl_shell,
+                           wl_shell_surface,
+                           wl_surface,
+                           wl_seat,
+                           wl_pointer,
+                           wl_keyboard,
+                           wl_touch,
+                           wl_output,
+                           wl_region,
+                           wl_subcompositor,
+                           wl_subsurface,
+                           wl_fixes>();
+#endif
+
+#ifdef WAYLANDER_BENCHMARK_PROTOCOL_LINUX_DMABUF_V1
+[[maybe_unused]] constexpr auto linux_dmabuf_v1_instantiations =
+    instantiate_interfaces<zwp_linux_dmabuf_v1,
+                           zwp_linux_buffer_params_v1,
+                           zwp_linux_dmabuf_feedback_v1>();
+#endif
+
+#ifdef WAYLANDER_BENCHMARK_PROTOCOL_PRESENTATION_TIME
+[[maybe_unused]] constexpr auto presentation_time_instantiations =
+    instantiate_interfaces<wp_presentation, wp_presentation_feedback>();
+#endif
+
+#ifdef WAYLANDER_BENCHMARK_PROTOCOL_TABLET_V2
+[[maybe_unused]] constexpr auto tablet_v2_instantiations =
+    instantiate_interfaces<zwp_tablet_manager_v2,
+                           zwp_tablet_seat_v2,
+                           zwp_tablet_tool_v2,
+                           zwp_tablet_v2,
+                           zwp_tablet_pad_ring_v2,
+                           zwp_tablet_pad_strip_v2,
+                           zwp_tablet_pad_group_v2,
+                           zwp_tablet_pad_v2>();
+#endif
+
+#ifdef WAYLANDER_BENCHMARK_PROTOCOL_VIEWPORTER
+[[maybe_unused]] constexpr auto viewporter_instantiations =
+    instantiate_interfaces<wp_viewporter, wp_viewport>();
+#endif
+
+#ifdef WAYLANDER_BENCHMARK_PROTOCOL_XDG_SHELL
+[[maybe_unused]] constexpr auto xdg_shell_instantiations =
+    instantiate_interfaces<xdg_wm_base, xdg_positioner, xdg_surface, xdg_toplevel, xdg_popup>();
+#endif
+
+} // namespace
@@ -0,0 +1,111 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Instantiates message utilities for every message of every generated protocol.
+///
+/// Not meant to be run. Benchmark measure_compile_time.py times compiling this,
+/// to track instantiation time of sstd::type_list machinery and message_utils.hpp.
+/// Run with `meson test --benchmark`.
+
+#include <cstddef>
+
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+// Include other protocols after core protocol.
+#include "waylander/wayland/protocols/linux_dmabuf_v1_protocol.hpp"
+#include "waylander/wayland/protocols/presentation_time_protocol.hpp"
+#include "waylander/wayland/protocols/tablet_v2_protocol.hpp"
+#include "waylander/wayland/protocols/viewporter_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+namespace {
+
+using namespace waylander;
+
+template<typename Msg>
+constexpr auto payload_size_if_static() -> std::size_t {
+    if constexpr (wl::static_message<Msg>) {
+        return wl::message_payload_size(Msg{});
+    } else {
+        return 0uz;
+    }
+}
+
+template<typename... Msgs>
+constexpr auto payload_sizes(wl::message_list<Msgs...>) -> std::size_t {
+    return (0uz + ... + payload_size_if_static<Msgs>());
+}
+
+template<wl::interface... W>
+constexpr auto payload_sizes_of_interfaces() -> std::size_t {
+    return (0uz + ... + (payload_sizes(typename W::request_list{})
+                         + payload_sizes(typename W::event_list{})));
+}
+
+using namespace wl::protocols;
+
+[[maybe_unused]] const auto total_payload_size = payload_sizes_of_interfaces<
+    // wayland
+    wl_display,
+    wl_registry,
+    wl_callback,
+    wl_compositor,
+    wl_shm_pool,
+    wl_shm,
+    wl_buffer,
+    wl_data_offer,
+    wl_data_source,
+    wl_data_device,
+    wl_data_device_manager,
+    wl_shell,
+    wl_shell_surface,
+    wl_surface,
+    wl_seat,
+    wl_pointer,
+    wl_keyboard,
+    wl_touch,
+    wl_output,
+    wl_region,
+    wl_subcompositor,
+    wl_subsurface,
+    wl_fixes,
+    // linux_dmabuf_v1
+    zwp_linux_dmabuf_v1,
+    zwp_linux_buffer_params_v1,
+    zwp_linux_dmabuf_feedback_v1,
+    // presentation_time
+    wp_presentation,
+    wp_presentation_feedback,
+    // tablet_v2
+    zwp_tablet_manager_v2,
+    zwp_tablet_seat_v2,
+    zwp_tablet_tool_v2,
+    zwp_tablet_v2,
+    zwp_tablet_pad_ring_v2,
+    zwp_tablet_pad_strip_v2,
+    zwp_tablet_pad_group_v2,
+    zwp_tablet_pad_v2,
+    // viewporter
+    wp_viewporter,
+    wp_viewport,
+    // xdg_shell
+    xdg_wm_base,
+    xdg_positioner,
+    xdg_surface,
+    xdg_toplevel,
+    xdg_popup>();
+
+} // namespace
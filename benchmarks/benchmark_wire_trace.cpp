@@ -0,0 +1,135 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Measures recording of wire traces and replaying them.
+///
+/// Run with `meson test --benchmark`.
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+    using wl_display  = wl::protocols::wl_display;
+    using wl_callback = wl::protocols::wl_callback;
+    using wl_registry = wl::protocols::wl_registry;
+    using sync        = wl_display::request::sync;
+    using done        = wl_callback::event::done;
+
+    static constexpr auto records_per_round    = 10'000uz;
+    static constexpr auto roundtrips_per_round = 1'000uz;
+    static constexpr auto rounds               = 10uz;
+
+    auto results = benchmarks::suite{ "wire_trace" };
+
+    auto ring = wl::wire_trace_ring{ 1uz << 20 };
+
+    const auto chunk = sstd::byte_vec(64);
+    results.measure("record 64 byte chunk", rounds, [&] {
+        for (auto i = 0uz; i < records_per_round; ++i) {
+            ring.record(wl::wire_direction::received, chunk);
+            if (i % 1'000uz == 0) {
+                ring.consume([](const auto bytes) { benchmarks::do_not_optimize(bytes.data()); });
+            }
+        }
+        return records_per_round;
+    });
+
+    {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+        const auto callback             = client.reserve_object_id<wl_callback>();
+        client.set_wire_trace(&ring);
+
+        constexpr auto request_size =
+            sizeof(wl::message_header<wl_display>) + wl::message_payload_size(sync{});
+        auto request_bytes = sstd::byte_vec(request_size);
+
+        const auto done_event = [&] {
+            auto buff = wl::message_buffer{};
+            buff.append(callback, done{ .callback_data{ 0u } });
+            return buff.release_data();
+        }();
+
+        auto ov = wl::message_overload_set{};
+        results.measure("recorded sync roundtrip", rounds, [&] {
+            for (auto i = 0uz; i < roundtrips_per_round; ++i) {
+                client.register_request(wl::global_display_object, sync{ .callback{ callback } });
+                client.flush_registered_requests();
+
+                server_sock.read(request_bytes);
+                server_sock.write(done_event);
+
+                client.recv_and_visit_events(ov).until<done>(callback);
+            }
+            ring.consume([](const auto bytes) { benchmarks::do_not_optimize(bytes.data()); });
+            return roundtrips_per_round;
+        });
+    }
+
+    // Registry globals received in 1000 byte chunks, so messages are split between records.
+    const auto trace = [&] {
+        auto events = wl::message_buffer{};
+        for (auto i = 0u; i < 10'000u; ++i) {
+            events.append(wl::Wobject<wl_registry>{ 2 },
+                          wl_registry::event::global{ .name{ i },
+                                                      .interface{ u8"wl_compositor" },
+                                                      .version{ 6 } });
+        }
+        auto data = events.release_data();
+
+        ring.consume([](const auto) {});
+        for (auto bytes = std::span<const std::byte>{ data }; not bytes.empty();) {
+            const auto size = std::min(bytes.size(), 1'000uz);
+            ring.record(wl::wire_direction::received, bytes.first(size));
+            bytes = bytes.subspan(size);
+        }
+
+        auto trace = sstd::byte_vec(wl::wire_trace_magic.begin(), wl::wire_trace_magic.end());
+        ring.consume([&](const auto bytes) {
+            trace.insert(trace.end(), bytes.begin(), bytes.end());
+        });
+        return trace;
+    }();
+
+    auto ov   = wl::message_overload_set{};
+    auto sink = 0u;
+    ov.add_overload<wl_registry::event::global>(
+        wl::Wobject<wl_registry>{ 2 },
+        [&](const auto& global) { sink += global.name.value; });
+
+    results.measure("replay 10000 globals", rounds, [&] {
+        const auto messages = wl::replay_wire_trace(trace, ov);
+        benchmarks::do_not_optimize(sink);
+        return messages;
+    });
+
+    return results.report(argc, argv);
+}
@@ -0,0 +1,150 @@
+#!/usr/bin/python3
+# Copyright (C) 2024 Miro Palmu.
+#
+# This file is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This file is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+"""Times compiling a source file with its command from compile_commands.json.
+
+With --time-report also collects wall times of GCC -ftime-report.
+With --json writes the results as JSON, so they can be compared between builds.
+
+Also reports the size of the executable sections of the compiled object file.
+Compiling the same source again with --define WAYLANDER_PROBE_MESSAGE_ARGUMENTS
+gives the numbers of probing the message arguments instead of the generated fields.
+"""
+
+import argparse
+import json
+import os
+import re
+import shlex
+import statistics
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+def find_compile_command(build_dir: str, source: str) -> tuple[list[str], str]:
+    with open(os.path.join(build_dir, "compile_commands.json")) as file:
+        commands = json.load(file)
+    source = os.path.realpath(source)
+    for entry in commands:
+        directory = entry["directory"]
+        if os.path.realpath(os.path.join(directory, entry["file"])) == source:
+            if "arguments" in entry:
+                return entry["arguments"], directory
+            return shlex.split(entry["command"]), directory
+    raise RuntimeError(f"{source} not found from compile_commands.json")
+
+def without_output_and_deps(command: list[str]) -> list[str]:
+    """Drop -o and dependency file flags, so measuring does not touch the build directory."""
+    stripped = []
+    skip_next = False
+    for arg in command:
+        if skip_next:
+            skip_next = False
+        elif arg in ("-o", "-MF", "-MQ", "-MT"):
+            skip_next = True
+        elif arg not in ("-MD", "-MMD"):
+            stripped.append(arg)
+    return stripped
+
+def parse_time_report(stderr: str) -> dict[str, float]:
+    """Wall times in seconds of the rows of GCC -ftime-report."""
+    report = {}
+    # name : usr [(percent)] sys [(percent)] wall ...
+    column = r"[\d.]+\s*(?:\(\s*\d+%\))?\s*"
+    row = re.compile(rf"^\s*(\|?[^:]+?)\s*:\s*{column}{column}([\d.]+)")
+    for line in stderr.splitlines():
+        match = row.match(line)
+        if match:
+            report[match.group(1)] = float(match.group(2))
+    return report
+
+def code_size(object_file: str) -> int:
+    """Sum of the sizes of the executable sections of 64-bit little-endian ELF object file."""
+    with open(object_file, "rb") as file:
+        elf = file.read()
+    if elf[:4] != b"\x7fELF" or elf[4] != 2 or elf[5] != 1:
+        raise RuntimeError(f"{object_file} is not 64-bit little-endian ELF")
+    (section_table,) = struct.unpack_from("<Q", elf, 0x28)
+    section_size, section_count = struct.unpack_from("<HH", elf, 0x3a)
+    shf_execinstr = 0x4
+    total = 0
+    for i in range(section_count):
+        # sh_name, sh_type, sh_flags, sh_addr, sh_offset, sh_size
+        _, _, flags, _, _, size = struct.unpack_from("<IIQQQQ", elf, section_table + i * section_size)
+        if flags & shf_execinstr:
+            total += size
+    return total
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("build_dir", help="Meson build directory.")
+    parser.add_argument("source", help="Source file to compile.")
+    parser.add_argument("--repeat", type=int, default=3, help="How many times to compile.")
+    parser.add_argument("--define", action="append", default=[], metavar="NAME[=VALUE]",
+                        help="Add -DNAME[=VALUE] to the command. Can be given multiple times.")
+    parser.add_argument("--time-report", action="store_true", help="Compile with -ftime-report.")
+    parser.add_argument("--json", metavar="path", help="Write the results as JSON to path.")
+    args = parser.parse_args()
+
+    command, directory = find_compile_command(args.build_dir, args.source)
+    command = without_output_and_deps(command) + [f"-D{define}" for define in args.define]
+    if args.time_report:
+        command.append("-ftime-report")
+
+    seconds = []
+    reports = []
+    with tempfile.TemporaryDirectory() as temp_dir:
+        object_file = os.path.join(temp_dir, "out.o")
+        for _ in range(args.repeat):
+            start = time.perf_counter()
+            result = subprocess.run(command + ["-o", object_file],
+                                    cwd=directory, check=True, stderr=subprocess.PIPE, text=True)
+            seconds.append(time.perf_counter() - start)
+            if args.time_report:
+                reports.append(parse_time_report(result.stderr))
+        code_bytes = code_size(object_file)
+
+    name = os.path.basename(args.source)
+    if len(args.define) != 0:
+        name += f" ({' '.join(args.define)})"
+    print(f"{name}: min {min(seconds):.3f} s, mean {statistics.mean(seconds):.3f} s"
+          f" over {args.repeat} compilations, {code_bytes} bytes of code")
+
+    results = {
+        "source": os.path.realpath(args.source),
+        "defines": args.define,
+        "compiler": command[0],
+        "seconds": seconds,
+        "min_seconds": min(seconds),
+        "mean_seconds": statistics.mean(seconds),
+        "code_bytes": code_bytes,
+    }
+    if args.time_report:
+        # Report of the fastest compilation.
+        report = reports[seconds.index(min(seconds))]
+        results["time_report_wall_seconds"] = report
+        for phase in ("phase parsing", "template instantiation", "TOTAL"):
+            if phase in report:
+                print(f"    {phase}: {report[phase]:.3f} s")
+
+    if args.json is not None:
+        with open(args.json, "w") as file:
+            json.dump(results, file, indent=4)
+
+if __name__ == "__main__":
+    sys.exit(main())
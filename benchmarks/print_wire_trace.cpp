@@ -0,0 +1,63 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Prints every message of a recorded wire trace, see wl::format_wire_trace.
+///
+/// Usage: print_wire_trace <trace>
+///
+/// Messages of the interfaces of all protocols coming with waylander are rendered.
+
+#include <initializer_list>
+#include <print>
+#include <span>
+#include <vector>
+
+#include "waylander/wayland/message_printer.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/linux_dmabuf_v1_protocol.hpp"
+#include "waylander/wayland/protocols/presentation_time_protocol.hpp"
+#include "waylander/wayland/protocols/tablet_v2_protocol.hpp"
+#include "waylander/wayland/protocols/viewporter_protocol.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+
+    if (argc != 2) {
+        std::println(stderr, "Usage: {} <trace>", argv[0]);
+        return 1;
+    }
+
+    using protocol_interfaces = std::span<const wl::interface_info>;
+    const auto protocols      = {
+        protocol_interfaces{ wl::protocols::wayland_interfaces },
+        protocol_interfaces{ wl::protocols::xdg_shell_interfaces },
+        protocol_interfaces{ wl::protocols::linux_dmabuf_v1_interfaces },
+        protocol_interfaces{ wl::protocols::presentation_time_interfaces },
+        protocol_interfaces{ wl::protocols::tablet_v2_interfaces },
+        protocol_interfaces{ wl::protocols::viewporter_interfaces },
+    };
+
+    auto interfaces = std::vector<wl::interface_info>{};
+    for (const auto protocol : protocols) {
+        interfaces.insert(interfaces.end(), protocol.begin(), protocol.end());
+    }
+
+    const auto trace = wl::read_wire_trace_file(argv[1]);
+    auto printer     = wl::message_printer{ interfaces };
+    for (const auto& line : wl::format_wire_trace(trace, printer)) { std::println("{}", line); }
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// Replays the received events of a recorded wire trace as fast as possible.
+///
+/// Usage: replay_wire_trace <trace> [results.json]
+///
+/// The interfaces of the objects are not recorded, so every (object id, opcode)-pair
+/// of the trace gets an overload which only touches the payload.
+/// Measures parsing and dispatching the events, see wl::replay_wire_trace.
+
+#include <cstddef>
+#include <print>
+#include <set>
+#include <span>
+#include <utility>
+
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+#include "benchmark.hpp"
+
+int main(int argc, char** argv) {
+    using namespace waylander;
+
+    if (argc < 2) {
+        std::println(stderr, "Usage: {} <trace> [results.json]", argv[0]);
+        return 1;
+    }
+
+    static constexpr auto rounds = 100uz;
+
+    const auto trace = wl::read_wire_trace_file(argv[1]);
+
+    using opcode_t = wl::Wopcode<wl::generic_object>::integral_type;
+    auto keys      = std::set<std::pair<wl::Wuint::integral_type, opcode_t>>{};
+    std::println(stderr,
+                 "{} received messages",
+                 wl::replay_wire_trace(trace, [&](const wl::parsed_message& msg) {
+                     keys.emplace(msg.object_id.value, msg.opcode.value);
+                 }));
+
+    auto overloads = wl::message_overload_set{};
+    for (const auto& [obj_id, opcode] : keys) {
+        overloads.add_payload_overload({ obj_id }, { opcode }, [](const auto payload) {
+            benchmarks::do_not_optimize(payload.data());
+        });
+    }
+
+    auto results = benchmarks::suite{ "replay_wire_trace" };
+    results.measure("replay", rounds, [&] { return wl::replay_wire_trace(trace, overloads); });
+    return results.report(argc - 1, argv + 1);
+}
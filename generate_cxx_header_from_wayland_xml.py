@@ -54,6 +54,19 @@ def get_cxx_Wtype(type: wl_arg_type, interface: Optional[str] = None) -> str:
     else:
        raise RuntimeError(f"Unregonized wl_ar_type: {type}")
 
+def get_signature_letter(type: wl_arg_type) -> str:
+    """Type in the notation of libwayland message signatures."""
+    return {
+        wl_arg_type.wl_int: "i",
+        wl_arg_type.wl_uint: "u",
+        wl_arg_type.wl_fixed: "f",
+        wl_arg_type.wl_string: "s",
+        wl_arg_type.wl_object: "o",
+        wl_arg_type.wl_new_id: "n",
+        wl_arg_type.wl_array: "a",
+        wl_arg_type.linux_fd: "h",
+    }[type]
+
 def commentify(s: str, comment_symbol: str = "///") -> str:
     comm = ""
     lines = s.split("\n")
@@ -126,6 +139,11 @@ class wl_arg:
 
         return f"{desc}{indent}{cxx_type} {self.name};\n"
 
+    def as_cxx_argument_info(self) -> str:
+        """Entry of message_arguments, see argument_info."""
+        interface = f", u8\"{self.interface}\"" if self.interface else ""
+        return f"{{ u8\"{self.name}\", u8'{get_signature_letter(self.arg_type)}'{interface} }}"
+
 @dataclass
 class wl_enum_entry:
     # Required attributes:
@@ -199,6 +217,23 @@ def cxx_opcode_static_member(interface: str, opcode: int, indent_in_spaces: int
     indent = (" " * indent_in_spaces)
     return indent + f"static constexpr Wopcode<{interface}> opcode{{ {opcode} }};\n"
 
+def cxx_version_static_members(since_version: Optional[int],
+                               deprecated_since_version: Optional[int],
+                               indent_in_spaces: int = 4):
+    """Messages without since attribute are part of the first version of the interface."""
+    indent = (" " * indent_in_spaces)
+    since = since_version if since_version is not None else 1
+    members = indent + f"static constexpr protocol_version since{{ {since} }};\n"
+    if deprecated_since_version is not None:
+        members += indent + f"static constexpr protocol_version deprecated_since{{ {deprecated_since_version} }};\n"
+    return members
+
+def cxx_fields_alias(message: str, args: list[wl_arg], indent_in_spaces: int = 4):
+    """Lists data members of message in wire order, so they do not have to be probed."""
+    indent = (" " * indent_in_spaces)
+    members = ", ".join(f"&{message}::{arg.name}" for arg in args)
+    return "\n" + indent + f"using fields = message_fields<{members}>;\n"
+
 @dataclass
 class wl_event:
     # Required attributes
@@ -207,6 +242,7 @@ class wl_event:
     # Optional attributes
     event_type: Optional[str]
     since_version: Optional[int]
+    deprecated_since_version: Optional[int]
 
     # (description?,arg*)
     description: Optional[wl_description]
@@ -222,8 +258,10 @@ class wl_event:
             comment = self.description.as_sphinx_comment()
         header = f"struct {interface}::event::{self.name} {{\n"
         body = cxx_opcode_static_member(interface, opcode)
+        body += cxx_version_static_members(self.since_version, self.deprecated_since_version)
         for arg in self.args:
             body += arg.as_cxx_data_member(interface)
+        body += cxx_fields_alias(f"{interface}::event::{self.name}", self.args)
         tail = "};\n\n"
         return comment + header + body + tail
 
@@ -235,6 +273,7 @@ class wl_request:
     # Optional attributes
     request_type: Optional[str]
     since_version: Optional[int]
+    deprecated_since_version: Optional[int]
 
     # (description?,arg*)
     description: Optional[wl_description]
@@ -250,8 +289,10 @@ class wl_request:
             comment = self.description.as_sphinx_comment()
         header = f"struct {interface}::request::{self.name} {{\n"
         body = cxx_opcode_static_member(interface, opcode)
+        body += cxx_version_static_members(self.since_version, self.deprecated_since_version)
         for arg in self.args:
             body += arg.as_cxx_data_member(interface)
+        body += cxx_fields_alias(f"{interface}::request::{self.name}", self.args)
         tail = "};\n\n"
         return comment + header + body + tail
 
@@ -274,13 +315,27 @@ class wl_interface:
     def has_enums(self) -> bool:
         return len(self.enums) != 0
 
+    def referenced_interfaces(self) -> set[str]:
+        """Other interfaces which have to be complete for the message definitions."""
+        referenced = set()
+        for message in self.requests + self.events:
+            for arg in message.args:
+                if arg.interface:
+                    referenced.add(arg.interface)
+                if arg.enum and "." in arg.enum:
+                    referenced.add(arg.enum.split(".")[0])
+        referenced.discard(self.name)
+        return referenced
+
     def as_cxx_struct_without_definitions(self) -> str:
         header = f"struct {self.name} {{\n"
-        body = ""
 
         indent_in_spaces = 4
         indent = ' ' * indent_in_spaces
 
+        body = indent + f"static constexpr std::u8string_view name{{ u8\"{self.name}\" }};\n"
+        body += indent + f"static constexpr protocol_version version{{ {self.version} }};\n\n"
+
         for enum in self.enums:
             body += enum.as_cxx_enum_class_decleration(indent_in_spaces)
 
@@ -295,7 +350,40 @@ class wl_interface:
         body += indent + "struct event {\n"
         for event in self.events:
             body += event.as_cxx_member_struct_decleration(2 * indent_in_spaces)
-        body += indent + "};\n"
+        body += indent + "};\n\n"
+
+        # Messages are listed in opcode order, so index of a message is its opcode.
+        requests = ", ".join(f"request::{request.name}" for request in self.requests)
+        events = ", ".join(f"event::{event.name}" for event in self.events)
+        body += indent + f"using request_list = message_list<{requests}>;\n"
+        body += indent + f"using event_list = message_list<{events}>;\n"
+
+        # Arguments of all messages are stored in one array, which message_info entries refer to.
+        messages = self.requests + self.events
+        args = [arg for message in messages for arg in message.args]
+        body += "\n" + indent + "/// Names and signatures of the messages indexed by opcode, see message_info.\n"
+        def cxx_array(member: str, element: str, entries: list[str]) -> str:
+            array = f"static constexpr auto {member} = std::array<{element}, {len(entries)}>"
+            if len(entries) == 0:
+                return indent + array + "{};\n"
+            content = indent + array + "{ {\n"
+            for entry in entries:
+                content += 2 * indent + entry + ",\n"
+            return content + indent + "} };\n"
+
+        body += cxx_array("message_arguments", "argument_info", [arg.as_cxx_argument_info() for arg in args])
+
+        first_arg = 0
+        for kind, kind_messages in [("request", self.requests), ("event", self.events)]:
+            entries = []
+            for message in kind_messages:
+                signature = "".join(get_signature_letter(arg.arg_type) for arg in message.args)
+                arguments = f"std::span{{ message_arguments }}.subspan({first_arg}, {len(message.args)})"
+                if len(message.args) == 0:
+                    arguments = "{}"
+                entries.append(f"{{ u8\"{message.name}\", u8\"{signature}\", {arguments} }}")
+                first_arg += len(message.args)
+            body += cxx_array(f"{kind}_infos", "message_info", entries)
 
         tail = "};\n"
         return header + body + tail
@@ -355,15 +443,147 @@ class wl_protocol:
         for interface in self.interfaces:
             content += interface.as_cxx_definitions()
 
+        content += "/// Metadata of the interfaces of the protocol, see interface_info.\n"
+        content += f"inline constexpr auto {self.name}_interfaces = std::array{{\n"
+        for interface in self.interfaces:
+            content += f"    interface_info_of<{interface.name}>,\n"
+        content += "};\n\n"
+
         content += "} // namespace protocols\n"
         content += "} // namespace wl\n"
+        content += "} // namespace waylander\n\n"
+
+        content += "#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS\n"
+        content += "// Instantiated in the library, see meson option explicit_instantiations.\n\n"
+        content += '#include "waylander/wayland/message_buffer.hpp"\n'
+        content += '#include "waylander/wayland/message_intrperter.hpp"\n\n'
+        content += "namespace waylander {\n"
+        content += "namespace wl {\n\n"
+        content += self.cxx_explicit_instantiations(extern = True)
+        content += "\n} // namespace wl\n"
         content += "} // namespace waylander\n"
+        content += "#endif\n"
 
         filename = f"{path_prefix}{self.name}_protocol.hpp"
         with open(filename, "w") as file:
             file.write(content)
         print(f"{filename} created!")
 
+    def cxx_explicit_instantiations(self, extern: bool) -> str:
+        """Encoding of the requests and decoding of the events.
+
+        Targets are the non-inline encode_request and decode_message_payload,
+        as extern template does not suppress instantiation of constexpr functions.
+        """
+        prefix = "extern template" if extern else "template"
+        content = ""
+        for interface in self.interfaces:
+            obj = f"Wobject<protocols::{interface.name}>"
+            for request in interface.requests:
+                msg = f"protocols::{interface.name}::request::{request.name}"
+                content += f"{prefix} void encode_request(message_buffer&, {obj}, const {msg}&);\n"
+            for event in interface.events:
+                # Decoding of file descriptors is not supported yet.
+                if any(arg.arg_type == wl_arg_type.linux_fd for arg in event.args):
+                    continue
+                msg = f"protocols::{interface.name}::event::{event.name}"
+                for policy in ["trusted", "checked"]:
+                    content += f"{prefix} auto decode_message_payload<{msg}, decode_policy::{policy}>("
+                    content += f"std::span<const std::byte>) -> {msg};\n"
+        return content
+
+    def write_cxx_instantiations(self, path_prefix: str = ""):
+        content: str = f"// Generated from Wayland xml protocol: {self.name}\n\n"
+        content += f"/// @file\n/// Explicit instantiations of encoding and decoding of {self.name} messages.\n"
+        content += "///\n/// Compiled to the library with meson option explicit_instantiations.\n\n"
+
+        content += "#include <cstddef>\n#include <span>\n\n"
+        content += '#include "waylander/wayland/message_buffer.hpp"\n'
+        content += '#include "waylander/wayland/message_intrperter.hpp"\n'
+        if self.name != "wayland":
+            # Interfaces of the core protocol are used without including it.
+            content += '#include "waylander/wayland/protocols/wayland_protocol.hpp"\n'
+        content += f'#include "waylander/wayland/protocols/{self.name}_protocol.hpp"\n\n'
+
+        content += "namespace waylander {\n"
+        content += "namespace wl {\n\n"
+        content += self.cxx_explicit_instantiations(extern = False)
+        content += "\n} // namespace wl\n"
+        content += "} // namespace waylander\n"
+
+        filename = f"{path_prefix}{self.name}_protocol_instantiations.cpp"
+        with open(filename, "w") as file:
+            file.write(content)
+        print(f"{filename} created!")
+
+    def write_cxx_interface_header(self, interface: wl_interface, filename: str, generated: set[str]):
+        """Header of single interface.
+
+        Headers of referenced interfaces in the set generated are included after the interface
+        struct is complete, so interfaces referring to each other can include each other.
+        Other referenced interfaces have to be declared before including the header.
+        """
+        content: str = f"// Generated from Wayland xml protocol: {self.name}\n\n"
+        content += f"/// @file\n/// {interface.name} interface of {self.name} xml protocol\n"
+
+        if self.copyright:
+            content += "///\n"
+            content += commentify(self.copyright) + "\n"
+
+        content += "#pragma once\n\n"
+
+        content += '#include "waylander/wayland/protocol_primitives.hpp"\n\n'
+
+        content += "namespace waylander {\n"
+        content += "namespace wl {\n"
+        content += "namespace protocols {\n\n"
+        content += interface.as_cxx_struct_without_definitions()
+        content += "\n} // namespace protocols\n"
+        content += "} // namespace wl\n"
+        content += "} // namespace waylander\n\n"
+
+        includes = sorted(interface.referenced_interfaces() & generated)
+        for referenced in includes:
+            content += f'#include "{referenced}.hpp"\n'
+        if len(includes) != 0:
+            content += "\n"
+
+        content += "namespace waylander {\n"
+        content += "namespace wl {\n"
+        content += "namespace protocols {\n\n"
+        content += interface.as_cxx_definitions()
+        content += "} // namespace protocols\n"
+        content += "} // namespace wl\n"
+        content += "} // namespace waylander\n"
+
+        with open(filename, "w") as file:
+            file.write(content)
+        print(f"{filename} created!")
+
+    def write_cxx_module(self, path_prefix: str = ""):
+        content: str = f"// Generated from Wayland xml protocol: {self.name}\n\n"
+        content += f"/// @file\n/// Module interface unit of {self.name} protocol.\n"
+        content += "///\n/// Compiled to the modules library with meson option modules.\n\n"
+
+        content += "module;\n\n"
+        if self.name != "wayland":
+            # Interfaces of the core protocol are used without including it.
+            content += '#include "waylander/wayland/protocols/wayland_protocol.hpp"\n'
+        content += f'#include "waylander/wayland/protocols/{self.name}_protocol.hpp"\n\n'
+
+        content += f"export module waylander.protocols.{self.name};\n\n"
+
+        content += "export namespace waylander::wl::protocols {\n"
+        for interface in self.interfaces:
+            content += f"using protocols::{interface.name};\n"
+        content += f"using protocols::{self.name}_interfaces;\n"
+        content += "} // namespace waylander::wl::protocols\n"
+
+        filename = f"{path_prefix}{self.name}_protocol_module.cpp"
+        with open(filename, "w") as file:
+            file.write(content)
+        print(f"{filename} created!")
+
 from lxml import etree as ET
 
 def parse_wl_description(node: ET.Element) -> wl_description:
@@ -501,6 +721,11 @@ def parse_wl_event(node: ET.Element) -> wl_event:
     if since_version is not None:
         parsed_since_version = int(since_version)
 
+    deprecated_since_version = node.attrib.get("deprecated-since")
+    parsed_deprecated_since_version = None
+    if deprecated_since_version is not None:
+        parsed_deprecated_since_version = int(deprecated_since_version)
+
     parsed_desc = None
     if (len(node) >= 1):
         parsed_desc = parse_wl_description(node[0])
@@ -516,6 +741,7 @@ def parse_wl_event(node: ET.Element) -> wl_event:
         name = node.attrib["name"],
         event_type = parsed_event_type,
         since_version = parsed_since_version,
+        deprecated_since_version = parsed_deprecated_since_version,
         description = parsed_desc,
         args = parsed_args
     )
@@ -532,6 +758,11 @@ def parse_wl_request(node: ET.Element) -> wl_request:
     if since_version is not None:
         parsed_since_version = int(since_version)
 
+    deprecated_since_version = node.attrib.get("deprecated-since")
+    parsed_deprecated_since_version = None
+    if deprecated_since_version is not None:
+        parsed_deprecated_since_version = int(deprecated_since_version)
+
     parsed_desc = None
     if (len(node) >= 1):
         parsed_desc = parse_wl_description(node[0])
@@ -547,6 +778,7 @@ def parse_wl_request(node: ET.Element) -> wl_request:
         name = node.attrib["name"],
         request_type = parsed_request_type,
         since_version = parsed_since_version,
+        deprecated_since_version = parsed_deprecated_since_version,
         description = parsed_desc,
         args = parsed_args
     )
@@ -641,7 +873,12 @@ def main(argv0: str, argv_rest: list[str], temp_dir: str):
     - parses xml from the repo
     - generates waylander protocol headers
 
-    If $TMPDIR is not usable defaults to /tmp""",
+    If $TMPDIR is not usable defaults to /tmp
+
+    With --xml parses given xml files instead of cloning.
+    With --interface-headers generates one header per interface instead of
+    one per protocol, named <interface>.hpp, see meson variable
+    waylander_protocol_generator_command.""",
                 exit_on_error=True,
                 formatter_class=argparse.RawDescriptionHelpFormatter,
     )
@@ -652,13 +889,53 @@ def main(argv0: str, argv_rest: list[str], temp_dir: str):
         metavar="core|[un]stable|staging",
         choices=["core", "stable", "staging", "unstable"],
         help="""Protocols to generate. Can be given multiple times.""",
-        required=True,
+        default=[],
+    )
+
+    parser.add_argument(
+        "--xml",
+        type=str,
+        action='append',
+        metavar="path",
+        help="""Protocol xml file to generate. Can be given multiple times.""",
+        default=[],
     )
 
     parser.add_argument(
         "destination-dir",
         type=str,
-        help="Path of a destination directory for the generated headers.",
+        nargs='?',
+        default=None,
+        help="""Path of a destination directory for the generated headers.
+Not used with --interface-headers.""",
+    )
+
+    parser.add_argument(
+        "--interface-headers",
+        metavar="path",
+        type=str,
+        nargs='+',
+        default=None,
+        help="""Generate only headers of given paths. Name of the file without .hpp is the name of the
+interface. Interfaces referring to each other include each other, so the paths have to be
+in the same directory.""",
+    )
+
+    parser.add_argument(
+        "--instantiations-dir",
+        metavar="path",
+        type=str,
+        default=None,
+        help="""Also generate sources with explicit instantiations of message encoding and
+decoding to given directory, see meson option explicit_instantiations.""",
+    )
+
+    parser.add_argument(
+        "--modules-dir",
+        metavar="path",
+        type=str,
+        default=None,
+        help="Also generate module interface units to given directory, see meson option modules.",
     )
 
     parser.add_argument(
@@ -679,27 +956,62 @@ def main(argv0: str, argv_rest: list[str], temp_dir: str):
 
     cmd_args = vars(parser.parse_args(argv_rest))
     protocols = set(p for p in cmd_args["p"])
+    xml_paths = cmd_args["xml"]
     dst_dir_path = cmd_args["destination-dir"]
+    interface_header_paths = cmd_args["interface_headers"]
+
+    if len(protocols) == 0 and len(xml_paths) == 0:
+        parser.error("at least one of -p or --xml is required")
+    if dst_dir_path is None and interface_header_paths is None:
+        parser.error("destination-dir or --interface-headers is required")
 
     wl_address = cmd_args["alt_wayland_address"]
     wl_protocols_address = cmd_args["alt_wayland_protocols_address"]
-
-    import git
-    def parse_protocols_from_repo(git_pathspec: str, repo: git.Repo):
-        tree_at_head = repo.head.commit.tree
-        for path_in_repo in repo.git.ls_files([git_pathspec]).splitlines():
-            print(f"found: {path_in_repo}")
-            xml = tree_at_head[path_in_repo].data_stream.read()
-            parse_wayland_xml(xml).write_cxx_header(path_prefix=dst_dir_path + "/")
-
-    import tempfile
-    with tempfile.TemporaryDirectory(dir=temp_dir) as temp_dir:
-        if "core" in protocols:
-            wl_repo = git.Repo.clone_from(wl_address, temp_dir + "/wayland")
-            parse_protocols_from_repo("protocol/wayland.xml", wl_repo)
-
-        non_core_protocols = set(p for p in protocols if p != "core")
-        if len(non_core_protocols) != 0:
-            wl_protocols_repo = git.Repo.clone_from(wl_protocols_address, temp_dir + "/wayland-protocols")
-            for protocol in non_core_protocols:
-                parse_protocols_from_repo(f"{protocol}/*.xml", wl_protocols_repo)
+    instantiations_dir_path = cmd_args["instantiations_dir"]
+    modules_dir_path = cmd_args["modules_dir"]
+
+    parsed_protocols: list[wl_protocol] = []
+
+    for xml_path in xml_paths:
+        with open(xml_path, "rb") as file:
+            parsed_protocols.append(parse_wayland_xml(file.read()))
+
+    if len(protocols) != 0:
+        import git
+        def parse_protocols_from_repo(git_pathspec: str, repo: git.Repo):
+            tree_at_head = repo.head.commit.tree
+            for path_in_repo in repo.git.ls_files([git_pathspec]).splitlines():
+                print(f"found: {path_in_repo}")
+                xml = tree_at_head[path_in_repo].data_stream.read()
+                parsed_protocols.append(parse_wayland_xml(xml))
+
+        import tempfile
+        with tempfile.TemporaryDirectory(dir=temp_dir) as temp_dir:
+            if "core" in protocols:
+                wl_repo = git.Repo.clone_from(wl_address, temp_dir + "/wayland")
+                parse_protocols_from_repo("protocol/wayland.xml", wl_repo)
+
+            non_core_protocols = set(p for p in protocols if p != "core")
+            if len(non_core_protocols) != 0:
+                wl_protocols_repo = git.Repo.clone_from(wl_protocols_address, temp_dir + "/wayland-protocols")
+                for protocol in non_core_protocols:
+                    parse_protocols_from_repo(f"{protocol}/*.xml", wl_protocols_repo)
+
+    if interface_header_paths is not None:
+        import os
+        wanted = { os.path.basename(path).removesuffix(".hpp"): path for path in interface_header_paths }
+        generated = set(wanted)
+        for protocol in parsed_protocols:
+            for interface in protocol.interfaces:
+                if interface.name in wanted:
+                    protocol.write_cxx_interface_header(interface, wanted.pop(interface.name), generated)
+        if len(wanted) != 0:
+            raise RuntimeError(f"Interfaces not found from the protocols: {', '.join(sorted(wanted))}")
+        return
+
+    for protocol in parsed_protocols:
+        protocol.write_cxx_header(path_prefix=dst_dir_path + "/")
+        if instantiations_dir_path is not None:
+            protocol.write_cxx_instantiations(path_prefix=instantiations_dir_path + "/")
+        if modules_dir_path is not None:
+            protocol.write_cxx_module(path_prefix=modules_dir_path + "/")
@@ -15,6 +15,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
 #include "waylander/construct_allocator_adapter.hpp"
 
 namespace waylander {
@@ -23,5 +27,14 @@ using byte_vec_alloc =
     sstd::allocator::construct_allocator_adapter<sstd::allocator::default_init_construct,
                                                  std::byte>;
 using byte_vec = std::vector<std::byte, byte_vec_alloc>;
+
+namespace pmr {
+/// Like sstd::byte_vec but allocates from a std::pmr::memory_resource.
+using byte_vec_alloc =
+    sstd::allocator::construct_allocator_adapter<sstd::allocator::default_init_construct,
+                                                 std::byte,
+                                                 std::pmr::polymorphic_allocator<std::byte>>;
+using byte_vec = std::vector<std::byte, byte_vec_alloc>;
+} // namespace pmr
 } // namespace sstd
 } // namespace waylander
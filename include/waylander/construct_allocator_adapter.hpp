@@ -38,7 +38,9 @@
 /// [4] https://stackoverflow.com/questions/21028299/is-this-behavior-of-vectorresizesize-type-n-under-c11-and-boost-container/21028912#21028912
 
 #include <concepts>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <type_traits>
 #include <utility>
 
@@ -100,6 +102,57 @@ class construct_allocator_adapter : public A, private ConstructImpl {
 
     using A::A;
     using ConstructImpl::construct;
+
+    /// Adapts already existing allocator.
+    ///
+    /// Inherited constructors do not include the copy constructor of A,
+    /// which is needed e.g. when A::select_on_container_copy_construction returns an A.
+    [[nodiscard]] constexpr construct_allocator_adapter(const A& alloc) noexcept : A(alloc) {}
+};
+
+/// Statistics collected by counting_memory_resource.
+struct allocation_counter {
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    std::size_t allocated_bytes{};
+};
+
+/// Memory resource which records every allocation made through it to an allocation_counter.
+///
+/// Plugs into construct_allocator_adapter through std::pmr::polymorphic_allocator,
+/// e.g. sstd::pmr::byte_vec, and to the classes taking std::pmr::memory_resource*,
+/// in order to check that a code path does not allocate after its buffers have warmed up.
+class counting_memory_resource : public std::pmr::memory_resource {
+    allocation_counter counter_{};
+    std::pmr::memory_resource* upstream_;
+
+    [[nodiscard]] auto do_allocate(const std::size_t bytes, const std::size_t alignment)
+        -> void* override {
+        auto* const ptr = upstream_->allocate(bytes, alignment);
+        ++counter_.allocations;
+        counter_.allocated_bytes += bytes;
+        return ptr;
+    }
+
+    void do_deallocate(void* const ptr,
+                       const std::size_t bytes,
+                       const std::size_t alignment) override {
+        ++counter_.deallocations;
+        upstream_->deallocate(ptr, bytes, alignment);
+    }
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+        -> bool override {
+        return this == &other;
+    }
+
+  public:
+    [[nodiscard]] explicit counting_memory_resource(
+        std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept
+        : upstream_{ upstream } {}
+
+    [[nodiscard]] auto counter() const noexcept -> const allocation_counter& { return counter_; }
+    [[nodiscard]] auto upstream() const noexcept -> std::pmr::memory_resource* { return upstream_; }
 };
 
 } // namespace allocator
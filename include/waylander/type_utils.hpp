@@ -130,24 +130,67 @@ using make_overloaded = overloaded<make_overloadable<F>...>;
 template<typename F, typename... T>
 using template_overload_resolution = decltype(std::declval<F>()(std::declval<T>()...));
 
-/// Primary template for folding types using template_overload_resolution.
-template<typename, typename, typename...>
-struct type_fold_left;
+/// Selects \p I:th type of pack \p T.
+///
+/// Uses pack indexing or compiler builtin when available,
+/// so selecting does not instantiate a template per index.
+#if __cpp_pack_indexing >= 202311L
+template<std::size_t I, typename... T>
+    requires(I < sizeof...(T))
+using pack_element_t = T...[I];
+#elif __has_builtin(__type_pack_element)
+template<std::size_t I, typename... T>
+    requires(I < sizeof...(T))
+using pack_element_t = __type_pack_element<I, T...>;
+#else
+namespace {
+/// Implementation detail of pack_element_t.
+///
+/// Overload resolution picks the base class indexed_type<I, U> matching I.
+template<typename, typename...>
+struct indexed_pack;
 
-/// Base case as partial specializaion for folding types using template_overload_resolution.
-template<typename F, typename T>
-struct type_fold_left<F, T> {
-    using type = T;
+template<std::size_t... I, typename... T>
+struct indexed_pack<std::index_sequence<I...>, T...> : indexed_type<I, T>... {};
+
+template<std::size_t I, typename T>
+auto select_indexed(const indexed_type<I, T>&) -> T;
+} // namespace
+
+template<std::size_t I, typename... T>
+    requires(I < sizeof...(T))
+using pack_element_t = decltype(select_indexed<I>(
+    std::declval<indexed_pack<std::index_sequence_for<T...>, T...>>()));
+#endif
+
+namespace {
+/// Implementation detail of type_fold_left.
+///
+/// Folding operator<< over these with a fold expression updates the accumulated type
+/// without recursive template instantiations.
+template<typename F, typename Acc>
+struct type_fold_accumulator {
+    using type = Acc;
+
+    template<typename T>
+    auto operator<<(std::type_identity<T>) const
+        -> type_fold_accumulator<F, template_overload_resolution<F, Acc, T>>;
 };
+} // namespace
 
-/// Recursive case as partial specializaion for folding types using template_overload_resolution.
-template<typename F, typename Lhs, typename Rhs, typename... Tail>
-struct type_fold_left<F, Lhs, Rhs, Tail...> {
-    using type = type_fold_left<F, template_overload_resolution<F, Lhs, Rhs>, Tail...>::type;
+/// Folds types \p T using template_overload_resolution<F, Acc, T> starting from \p Init.
+///
+/// Fold expression is used, so the instantiation depth does not depend on the amount of types.
+template<typename F, typename Init, typename... T>
+struct type_fold_left {
+    using type =
+        decltype((type_fold_accumulator<F, Init>{} << ... << std::type_identity<T>{}))::type;
 };
 
 template<typename... T>
 struct type_list {
+    static constexpr std::size_t size = sizeof...(T);
+
     template<typename... F>
     using map = type_list<template_overload_resolution<make_overloaded<F...>, T>...>;
 
@@ -161,6 +204,10 @@ struct type_list {
 
     template<typename... U>
     using append = template_invoke_t<type_list, T..., U...>;
+
+    /// I:th type of the list.
+    template<std::size_t I>
+    using at = pack_element_t<I, T...>;
 };
 
 /// Primary template for type trait to check if T == type_list.
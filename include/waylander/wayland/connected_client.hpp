@@ -18,32 +18,99 @@
 /// @file
 /// Implements Wayland client side communication.
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <memory_resource>
+#include <span>
 #include <utility>
+#include <vector>
 
 #include "gnulander/local_stream_socket.hpp"
+#include "waylander/wayland/connection_metrics.hpp"
+#include "waylander/wayland/event_stream.hpp"
 #include "waylander/wayland/message_buffer.hpp"
 #include "waylander/wayland/message_intrperter.hpp"
 #include "waylander/wayland/message_overload_set.hpp"
 #include "waylander/wayland/message_parser.hpp"
 #include "waylander/wayland/protocol_primitives.hpp"
 #include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/request_coalescer.hpp"
 #include "waylander/wayland/system_utils.hpp"
+#include "waylander/wayland/timeline_tracer.hpp"
+#include "waylander/wayland/wire_trace.hpp"
 
 namespace waylander {
 namespace wl {
 
-static constexpr auto global_display_object = Wobject<protocols::wl_display>{ 1 };
+inline constexpr auto global_display_object = Wobject<protocols::wl_display>{ 1 };
+
+/// Determines when connected_client flushes registered requests without explicit request.
+enum class flush_policy {
+    /// Registered requests are flushed only by connected_client::flush_registered_requests.
+    manual,
+    /// Latency mode: every registered request is flushed immediately.
+    immediate,
+    /// Throughput mode: requests are batched until the size threshold is reached.
+    size_threshold,
+    /// Registered requests are flushed after each batch of received events has been visited.
+    end_of_dispatch
+};
+
+/// Statistics of connected_client::flush_registered_requests, see connected_client::flush_stats.
+struct flush_statistics {
+    /// Flushes which moved registered requests to the pending output.
+    std::size_t flushes{};
+    std::size_t flushed_bytes{};
+    std::size_t flushed_fds{};
+    /// Size of the largest flush in bytes.
+    std::size_t largest_flush_bytes{};
+    /// Flushes which returned with output left pending, as the socket would have blocked.
+    std::size_t partial_flushes{};
+};
 
 /// Represents one connected client by wrapping the Wayland socket.
 class connected_client {
     gnulander::local_stream_socket server_sock_;
     Wuint::integral_type next_new_id_{ 2 };
     message_buffer request_buff_{};
+
+    flush_policy flush_policy_{ flush_policy::manual };
+    std::size_t flush_size_threshold_{ default_flush_size_threshold };
+    flush_statistics flush_stats_{};
+
+    /// Flushed requests which are not yet written to the socket.
+    ///
+    /// Data before pending_data_offset_ and fds before pending_fds_offset_ are already written.
+    sstd::pmr::byte_vec pending_data_{};
+    std::size_t pending_data_offset_{ 0 };
+    std::pmr::vector<Wfd> pending_fds_{};
+    std::size_t pending_fds_offset_{ 0 };
+
+    /// Records sent and received bytes if not null, see set_wire_trace.
+    wire_trace_ring* wire_trace_{ nullptr };
+
+    /// Records spans of the activity if not null, see set_timeline.
+    timeline_tracer* timeline_{ nullptr };
+
+#ifdef WAYLANDER_METRICS
+    /// Counts the traffic if not null, see set_metrics.
+    connection_metrics* metrics_{ nullptr };
+#endif
+
+    /// Flushes registered requests if it is required by the current flush_policy.
+    void flush_by_policy();
+
+    /// Writes as much of the pending output as possible without blocking.
+    ///
+    /// Returns true if all of the pending output was written.
+    bool write_pending_output();
+
     /// Allways assumed that the data never begins at middle of message, only at a beginning.
-    sstd::byte_vec recv_buff_{};
+    sstd::pmr::byte_vec recv_buff_{};
+    std::chrono::steady_clock::time_point last_read_time_{};
 
     /// Represents prepeared work to receive and visit messages.
     class recvis_closure {
@@ -63,69 +130,197 @@ class connected_client {
         /// Receive and visit events until given (object id, opcode)-pair.
         ///
         /// Invokes the given function with the payload of the "until" message.
+        /// The interface of the object is only used for connection_metrics.
         void until(const Wobject<generic_object>,
                    const Wopcode<generic_object>,
+                   const interface_info*,
                    const std::move_only_function<void(std::span<const std::byte>) const>);
 
       public:
         /// Receive and visit events until \p obj_id receives message \p Msg.
         template<typename Msg, interface W>
         void until(const Wobject<W> obj_id) && {
-            until({ obj_id.value }, { Msg::opcode.value }, {});
+            until({ obj_id.value }, { Msg::opcode.value }, interface_info_if_known<W>, {});
         }
 
         /// Receive and visit events until \p obj_id receives message \p Msg.
         ///
-        /// Invokes the given function with the payload of the "until" message.
-        template<typename Msg, interface W>
+        /// Invokes the given function with the payload of the "until" message,
+        /// which is by default validated before it is interperted, see decode_policy.
+        template<typename Msg, decode_policy Policy = decode_policy::checked, interface W>
         void until(const Wobject<W> obj_id, std::invocable<Msg> auto&& callback_arg) && {
             until({ obj_id.value },
                   { Msg::opcode.value },
+                  interface_info_if_known<W>,
                   [callback = std::forward<decltype(callback_arg)>(callback_arg)](
                       const std::span<const std::byte> payload) {
-                      std::invoke(callback, interpert_message_payload<Msg>(payload));
+                      std::invoke(callback, decode_message_payload<Msg, Policy>(payload));
                   });
         }
     };
 
   public:
+    /// Size of libwayland connection buffer, which is used by compositors to receive requests.
+    static constexpr auto default_flush_size_threshold = 4096uz;
+
     /// Connected to socket at \p socket.
-    [[nodiscard]] connected_client(const std::filesystem::path& socket = wayland_socket_path());
+    ///
+    /// All of the buffers of the client are allocated from \p resource.
+    [[nodiscard]] connected_client(
+        const std::filesystem::path& socket = wayland_socket_path(),
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /// Uses given \p socket as the compositor socket.
-    [[nodiscard]] connected_client(gnulander::local_stream_socket&& socket);
+    ///
+    /// All of the buffers of the client are allocated from \p resource.
+    [[nodiscard]] connected_client(
+        gnulander::local_stream_socket&& socket,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
-    template<typename T = generic_object>
-    [[nodiscard]] auto reserve_object_id() -> Wobject<T> {
+    /// Reserves id for a new object, which will be bound with version at most Version.
+    template<typename T = generic_object, protocol_version Version = any_version>
+    [[nodiscard]] auto reserve_object_id() -> Wobject<T, Version> {
         return { next_new_id_++ };
     }
 
     template<interface WObj, message_for_inteface<WObj> request>
     void register_request(const Wobject<WObj> obj, const request& msg) {
-        request_buff_.append(obj, msg);
+#ifdef WAYLANDER_METRICS
+        const auto size_before = request_buff_.size();
+#endif
+        encode_request(request_buff_, obj, msg);
+        if (timeline_) {
+            timeline_->record({ .kind      = timeline_kind::request,
+                                .opcode    = { request::opcode.value },
+                                .object    = { obj.value },
+                                .interface = interface_info_if_known<WObj>,
+                                .begin     = std::chrono::steady_clock::now() });
+        }
+#ifdef WAYLANDER_METRICS
+        if (metrics_) {
+            metrics_->count_sent(interface_info_if_known<WObj>,
+                                 { request::opcode.value },
+                                 request_buff_.size() - size_before);
+        }
+#endif
+        if (flush_policy_ != flush_policy::manual) { flush_by_policy(); }
     }
 
-    void flush_registered_requests();
+    /// Coalesces redundant registered requests of \p surfaces, see coalesce_surface_requests.
+    void coalesce_registered_surface_requests(
+        const std::span<const Wobject<protocols::wl_surface>> surfaces) {
+        coalesce_surface_requests(request_buff_, surfaces);
+    }
+
+    /// Sets when registered requests are flushed automatically.
+    ///
+    /// \p size_threshold is the amount of registered bytes which triggers
+    /// a flush with flush_policy::size_threshold and is ignored otherwise.
+    void set_flush_policy(const flush_policy policy,
+                          const std::size_t size_threshold = default_flush_size_threshold);
+
+    /// Records all bytes written to and read from the socket to \p ring.
+    ///
+    /// Recording is disabled by nullptr. \p ring has to outlive the recording.
+    void set_wire_trace(wire_trace_ring* const ring) noexcept { wire_trace_ = ring; }
+
+    /// Records socket reads, flushes, registered requests, dispatched events and
+    /// recv_and_visit_events calls of this client to \p tracer.
+    ///
+    /// Recording is disabled by nullptr. \p tracer has to outlive the recording.
+    void set_timeline(timeline_tracer* const tracer) noexcept { timeline_ = tracer; }
+
+    /// Counts the traffic of this client to \p metrics.
+    ///
+    /// Does nothing unless the library is built with meson option metrics, see metrics_enabled.
+    /// Counting is disabled by nullptr. \p metrics has to outlive the counting.
+    void set_metrics([[maybe_unused]] connection_metrics* const metrics) noexcept {
+#ifdef WAYLANDER_METRICS
+        metrics_ = metrics;
+#endif
+    }
+
+    /// Moves registered requests to the pending output and writes as much of it as possible.
+    ///
+    /// On a blocking socket all of the pending output is written.
+    /// On a non-blocking socket the writing stops if the socket would block (EAGAIN),
+    /// and the rest is left pending until the next flush. File descriptors are always
+    /// sent along the data not after it, so they stay aligned with their messages.
+    ///
+    /// File descriptors of the registered requests have to stay open until they are written,
+    /// i.e. has_pending_output() returns false.
+    ///
+    /// Returns true if all of the pending output was written, i.e. not has_pending_output().
+    bool flush_registered_requests();
+
+    /// Statistics of the flushes since construction.
+    ///
+    /// Unlike connection_metrics these are always collected, as they cost a few additions.
+    [[nodiscard]] auto flush_stats() const noexcept -> const flush_statistics& {
+        return flush_stats_;
+    }
 
     [[nodiscard]] constexpr bool has_registered_requests(this auto&& self) noexcept {
         return not self.request_buff_.empty();
     }
 
+    /// True if flushed requests are still waiting to be written to the socket.
+    [[nodiscard]] constexpr bool has_pending_output(this auto&& self) noexcept {
+        return self.pending_data_offset_ != self.pending_data_.size();
+    }
+
     /// Receive non-zero amount of data to recv_buff_.
     void recv_more_data();
 
+    /// Time when data was last read from the socket.
+    ///
+    /// Overloads can use this as the arrival time of the event they handle.
+    [[nodiscard]] auto last_read_time() const noexcept -> std::chrono::steady_clock::time_point {
+        return last_read_time_;
+    }
+
     /// Inspect recv_buff_ and get bytes from beginning that are checked to form whole messages.
+    ///
+    /// Throws std::logic_error if a message header has size less than 8 bytes.
     [[nodiscard]] auto get_recd_bytes_forming_whole_messages() -> std::span<const std::byte>;
 
-    /// Read non-zero amount of bytes and return parser with all whole messages received.
+    /// Return parser with all whole messages received.
+    ///
+    /// If there are no whole messages left from previous calls, reads non-zero amount of bytes.
+    /// The messages are counted to connection_metrics without their interfaces.
     [[nodiscard]] auto recv_events() -> message_parser;
 
+    /// Removes the whole received messages of \p obj and returns parser of them.
+    ///
+    /// Messages of other objects are left in place, in their order, for the next
+    /// recv_events or recv_and_visit_events. If there are no messages of \p obj,
+    /// reads more until there are.
+    ///
+    /// \p interface of \p obj is only used for connection_metrics.
+    [[nodiscard]] auto take_messages_of(Wobject<generic_object> obj,
+                                        const interface_info* interface = nullptr)
+        -> message_parser;
+
+    /// Receive the events of \p obj as event_variant<W>, see take_messages_of.
+    ///
+    /// Events of other objects are not lost, but are left for recv_and_visit_events.
+    ///
+    /// Events introduced after the bound version of \p obj are not decoded, see Wobject.
+    template<interface_with_events W,
+             decode_policy Policy = decode_policy::checked,
+             protocol_version Version>
+    [[nodiscard]] auto events_of(const Wobject<W, Version> obj)
+        -> received_events<W, Policy, Version> {
+        auto messages = take_messages_of({ obj.value }, interface_info_if_known<W>);
+        return received_events<W, Policy, Version>{ std::move(messages), obj };
+    }
+
     auto recv_and_visit_events(message_overload_set&) -> recvis_closure;
 };
 
 /// See decleration.
-template<interface T>
-Wobject<T> Wobject<T>::reserve_id(connected_client& client) {
+template<interface T, protocol_version Version>
+Wobject<T> Wobject<T, Version>::reserve_id(connected_client& client) {
     return *this = client.reserve_object_id<T>();
 }
 
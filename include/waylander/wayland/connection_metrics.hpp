@@ -0,0 +1,194 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements counters and histograms of the traffic of connected_client.
+///
+/// connected_client updates connection_metrics given to connected_client::set_metrics
+/// only if the library is built with meson option metrics, otherwise the collection
+/// is compiled out and connection_metrics stays empty.
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// True if connected_client collects connection_metrics, see meson option metrics.
+inline constexpr bool metrics_enabled =
+#ifdef WAYLANDER_METRICS
+    true;
+#else
+    false;
+#endif
+
+/// Counter written by a single thread and read by any thread.
+///
+/// Incrementing is a relaxed load and store, which avoids the cost of read-modify-write.
+class single_writer_counter {
+    std::atomic<std::uint64_t> value_{ 0 };
+
+  public:
+    void add(const std::uint64_t n) noexcept {
+        value_.store(value_.load(std::memory_order::relaxed) + n, std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] auto load() const noexcept -> std::uint64_t {
+        return value_.load(std::memory_order::relaxed);
+    }
+};
+
+/// Histogram with power of two buckets, where bucket i counts values with bit width i.
+///
+/// Bucket 0 counts zeros and the last bucket also counts all values larger than it.
+class log2_histogram {
+  public:
+    static constexpr auto bucket_count = 40uz;
+    using snapshot_type                = std::array<std::uint64_t, bucket_count>;
+
+  private:
+    std::array<single_writer_counter, bucket_count> buckets_{};
+
+  public:
+    void record(const std::uint64_t value) noexcept {
+        const auto bucket = std::min<std::size_t>(std::bit_width(value), bucket_count - 1);
+        buckets_[bucket].add(1);
+    }
+
+    [[nodiscard]] auto snapshot() const noexcept -> snapshot_type;
+};
+
+/// Counters of one message of one interface.
+///
+/// Sent messages are requests registered to connected_client and received messages are
+/// events dispatched to an overload or to the callback of recvis_closure::until.
+struct message_metrics_snapshot {
+    /// Interface of the message, see interface_info_of.
+    const interface_info* interface;
+    Wopcode<generic_object> opcode;
+    wire_direction direction;
+    std::uint64_t messages;
+    std::uint64_t bytes;
+    /// Execution times of the overloads handling the received messages in nanoseconds.
+    log2_histogram::snapshot_type handler_nanoseconds;
+
+    /// Name and signature of the message or nullptr if opcode is not part of the interface.
+    [[nodiscard]] auto info() const noexcept -> const message_info*;
+};
+
+/// Copy of the counters of connection_metrics.
+struct connection_metrics_snapshot {
+    std::uint64_t sent_messages;
+    std::uint64_t sent_bytes;
+    std::uint64_t received_messages;
+    std::uint64_t received_bytes;
+    std::uint64_t read_syscalls;
+    std::uint64_t write_syscalls;
+    /// Received messages without an overload.
+    std::uint64_t unhandled_messages;
+    /// Messages which did not fit to the message table or whose interface is not known.
+    std::uint64_t untracked_messages;
+    /// Bytes moved to the pending output by each connected_client::flush_registered_requests.
+    log2_histogram::snapshot_type flush_bytes;
+    /// Messages of which at least one was sent or received.
+    std::vector<message_metrics_snapshot> messages;
+};
+
+/// Metrics of the traffic of a connected_client.
+///
+/// The counters are written only by the thread using the connected_client,
+/// but snapshot can be taken from any thread.
+///
+/// Messages are counted per (interface, opcode) in a fixed size table, so counting
+/// never allocates. Interfaces are known for sent requests, for the events which have
+/// an overload and for the events taken with connected_client::events_of, other events,
+/// e.g. the ones returned by connected_client::recv_events, are counted only in the totals.
+/// Events which are handed out instead of dispatched are recorded with handler time 0.
+class connection_metrics {
+    struct message_slot {
+        std::atomic<const interface_info*> interface{ nullptr };
+        Wopcode<generic_object> opcode{};
+        wire_direction direction{};
+        single_writer_counter messages{};
+        single_writer_counter bytes{};
+        log2_histogram handler_nanoseconds{};
+    };
+
+    std::size_t slot_count_;
+    std::unique_ptr<message_slot[]> slots_;
+
+    single_writer_counter sent_messages_{};
+    single_writer_counter sent_bytes_{};
+    single_writer_counter received_messages_{};
+    single_writer_counter received_bytes_{};
+    single_writer_counter read_syscalls_{};
+    single_writer_counter write_syscalls_{};
+    single_writer_counter unhandled_messages_{};
+    single_writer_counter untracked_messages_{};
+    log2_histogram flush_bytes_{};
+
+    /// Finds or claims the slot of the message, nullptr if the table is full.
+    [[nodiscard]] auto slot(const interface_info* interface,
+                            Wopcode<generic_object> opcode,
+                            wire_direction direction) noexcept -> message_slot*;
+
+  public:
+    /// Messages of at most \p max_messages (interface, opcode)-pairs are counted separately.
+    [[nodiscard]] explicit connection_metrics(std::size_t max_messages = 256);
+
+    connection_metrics(const connection_metrics&)            = delete;
+    connection_metrics& operator=(const connection_metrics&) = delete;
+
+    /// Request was registered, \p interface is nullptr if it is not known.
+    void count_sent(const interface_info* interface,
+                    Wopcode<generic_object> opcode,
+                    std::size_t bytes) noexcept;
+
+    /// Event was handled in \p handler_nanoseconds, \p interface is nullptr if it is not known.
+    void count_received(const interface_info* interface,
+                        Wopcode<generic_object> opcode,
+                        std::size_t bytes,
+                        std::uint64_t handler_nanoseconds) noexcept;
+
+    /// Event was received but there was no overload for it.
+    void count_unhandled() noexcept {
+        received_messages_.add(1);
+        unhandled_messages_.add(1);
+    }
+
+    void count_read(const std::size_t bytes) noexcept {
+        read_syscalls_.add(1);
+        received_bytes_.add(bytes);
+    }
+
+    void count_write() noexcept { write_syscalls_.add(1); }
+
+    void count_flush(const std::size_t bytes) noexcept { flush_bytes_.record(bytes); }
+
+    [[nodiscard]] auto snapshot() const -> connection_metrics_snapshot;
+};
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements arena for owning copies of decoded dynamic message arguments.
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+
+#include "waylander/type_utils.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Bump arena which owns copies of Wstring and Warray arguments.
+///
+/// Normally decoded Wstring and Warray arguments point to the receive buffer,
+/// which is reused after the message has been visited. Copying them to a decode_arena
+/// makes them valid until the arena is released, without allocation per argument.
+///
+/// Strings are interned, so repeated strings such as interface names of
+/// wl_registry.global events are stored only once.
+class decode_arena {
+    std::pmr::monotonic_buffer_resource resource_;
+    std::pmr::unordered_set<std::u8string_view> interned_strings_;
+
+  public:
+    static constexpr auto default_initial_block_size = 4096uz;
+
+    /// Blocks of the arena are allocated from \p upstream.
+    [[nodiscard]] explicit decode_arena(
+        std::size_t initial_block_size      = default_initial_block_size,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    decode_arena(const decode_arena&)            = delete;
+    decode_arena(decode_arena&&)                 = delete;
+    decode_arena& operator=(const decode_arena&) = delete;
+    decode_arena& operator=(decode_arena&&)      = delete;
+
+    /// Returns interned copy of \p str, which is null-terminated like on the wire.
+    [[nodiscard]] auto copy(Wstring str) -> Wstring;
+
+    /// Returns copy of \p arr.
+    [[nodiscard]] auto copy(Warray arr) -> Warray;
+
+    /// Arguments which do not point to external storage are returned as is.
+    template<typename T>
+    [[nodiscard]] constexpr auto copy(const T& arg) -> T {
+        return arg;
+    }
+
+    /// Amount of distinct strings copied since construction or last release.
+    [[nodiscard]] auto interned_string_count() const noexcept -> std::size_t;
+
+    /// Invalidates all copies and releases the memory back to the upstream resource.
+    void release();
+};
+
+/// Like interpert_message_payload(payload) but Wstring and Warray arguments are
+/// copied to \p arena, so the message stays valid after \p payload is gone.
+template<typename Msg, decode_policy Policy = decode_policy::trusted>
+auto interpert_message_payload(const std::span<const std::byte> payload, decode_arena& arena)
+    -> Msg {
+    const auto msg_viewing_payload = interpert_message_payload<Msg, Policy>(payload);
+    return std::apply([&](const auto&... arg) { return Msg{ arena.copy(arg)... }; },
+                      message_arguments_as_ref_tuple(msg_viewing_payload));
+}
+
+} // namespace wl
+} // namespace waylander
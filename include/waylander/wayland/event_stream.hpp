@@ -0,0 +1,173 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements pull-based typed event streams of Wayland objects.
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+template<typename>
+struct message_list_to_variant;
+
+template<typename... Messages>
+struct message_list_to_variant<message_list<Messages...>> {
+    using type = std::variant<Messages...>;
+};
+} // namespace
+
+/// Interface which has at least one event.
+template<typename W>
+concept interface_with_events = interface<W> and requires {
+    requires W::event_list::size != 0;
+};
+
+/// std::variant of all events of interface W, where the index of an event is its opcode.
+template<interface_with_events W>
+using event_variant = typename message_list_to_variant<typename W::event_list>::type;
+
+/// Decodes event of interface W from \p msg.
+///
+/// The opcode is dispatched with an if-chain over the known events, so the compiler
+/// sees every alternative and can turn it into a jump table. Events introduced after
+/// Version are left out of the chain, as they can not be sent to object of that version.
+/// Throws std::logic_error if the opcode is not an event of W available at Version.
+template<interface_with_events W,
+         decode_policy Policy     = decode_policy::checked,
+         protocol_version Version = any_version,
+         std::size_t Opcode       = 0uz>
+auto decode_event(const parsed_message& msg) -> event_variant<W> {
+    if constexpr (Opcode == W::event_list::size) {
+        throw std::logic_error{ "Unknown event opcode." };
+    } else {
+        using event_t = std::variant_alternative_t<Opcode, event_variant<W>>;
+        if constexpr (message_available_at<event_t, Version>) {
+            if (msg.opcode.value == Opcode) {
+                return event_variant<W>{ std::in_place_index<Opcode>,
+                                         decode_message_payload<event_t, Policy>(msg.arguments) };
+            }
+        }
+        return decode_event<W, Policy, Version, Opcode + 1uz>(msg);
+    }
+}
+
+/// Range of the events of one object, decoded to event_variant<W>, from a range of messages.
+///
+/// Messages to other objects are skipped. The events are decoded when dereferenced,
+/// so a message is decoded again if the same iterator is dereferenced twice.
+/// Events are decoded with decode_event for the bound version Version of the object.
+template<interface_with_events W,
+         decode_policy Policy     = decode_policy::checked,
+         protocol_version Version = any_version>
+class event_range {
+    parsed_message_range messages_;
+    Wobject<W> obj_;
+
+  public:
+    class iterator {
+        parsed_message_range::iterator current_{};
+        Wobject<W> obj_{};
+
+        /// Advances until message to obj_ or the end of the messages.
+        constexpr void skip_other_objects() {
+            while (current_ != std::default_sentinel and current_->object_id.value != obj_.value) {
+                ++current_;
+            }
+        }
+
+      public:
+        using value_type      = event_variant<W>;
+        using difference_type = std::ptrdiff_t;
+
+        [[nodiscard]] constexpr iterator() = default;
+
+        [[nodiscard]] constexpr iterator(const parsed_message_range::iterator first,
+                                         const Wobject<W> obj)
+            : current_{ first },
+              obj_{ obj } {
+            skip_other_objects();
+        }
+
+        [[nodiscard]] auto operator*() const -> value_type {
+            return decode_event<W, Policy, Version>(*current_);
+        }
+
+        constexpr auto operator++() -> iterator& {
+            ++current_;
+            skip_other_objects();
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> iterator {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const noexcept {
+            return current_ == other.current_;
+        }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept {
+            return current_ == std::default_sentinel;
+        }
+    };
+
+    [[nodiscard]] constexpr event_range(const parsed_message_range messages,
+                                        const Wobject<W, Version> obj) noexcept
+        : messages_{ messages },
+          obj_{ obj } {}
+
+    [[nodiscard]] constexpr auto begin() const -> iterator {
+        return iterator{ messages_.begin(), obj_ };
+    }
+    [[nodiscard]] constexpr auto end() const noexcept -> std::default_sentinel_t { return {}; }
+};
+
+/// Like event_range but owns the received messages, see connected_client::events_of.
+template<interface_with_events W,
+         decode_policy Policy     = decode_policy::checked,
+         protocol_version Version = any_version>
+class received_events {
+    message_parser messages_;
+    Wobject<W, Version> obj_;
+
+  public:
+    [[nodiscard]] received_events(message_parser&& messages, const Wobject<W, Version> obj)
+        : messages_{ std::move(messages) },
+          obj_{ obj } {}
+
+    [[nodiscard]] auto begin() const -> event_range<W, Policy, Version>::iterator {
+        return event_range<W, Policy, Version>{ messages_.messages(), obj_ }.begin();
+    }
+    [[nodiscard]] constexpr auto end() const noexcept -> std::default_sentinel_t { return {}; }
+};
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,62 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements batched conversions from Wfixed to floating-point numbers.
+///
+/// These are meant for high-rate events like pointer, touch and tablet motion,
+/// whose coordinates are gathered to structure of arrays before they are processed.
+
+#include <cassert>
+#include <concepts>
+#include <span>
+
+#include "waylander/wayland/protocol_primitives.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Converts \p in to \p out, which has to be at least as long as \p in.
+///
+/// Defined in the library, so the loop is vectorized regardless of the flags of the user.
+void convert_fixed(std::span<const Wfixed> in, std::span<float> out) noexcept;
+
+/// Converts \p in to \p out, which has to be at least as long as \p in.
+///
+/// Defined in the library, so the loop is vectorized regardless of the flags of the user.
+void convert_fixed(std::span<const Wfixed> in, std::span<double> out) noexcept;
+
+/// Converts argument \p member of each of \p messages to \p out,
+/// which has to be at least as long as \p messages.
+///
+/// For example, coordinates of a batch of motion events can be converted with
+/// convert_fixed(motions, &motion::surface_x, xs) and
+/// convert_fixed(motions, &motion::surface_y, ys).
+template<typename Msg, std::floating_point T>
+constexpr void convert_fixed(const std::span<const Msg> messages,
+                             Wfixed Msg::*const member,
+                             const std::span<T> out) noexcept {
+    assert(out.size() >= messages.size());
+    // Power of two, so multiplying by it is exact.
+    constexpr auto inverse_scale = T{ 1 } / Wfixed::scale;
+    for (auto i = 0uz; i < messages.size(); ++i) {
+        out[i] = static_cast<T>((messages[i].*member).value) * inverse_scale;
+    }
+}
+
+} // namespace wl
+} // namespace waylander
@@ -21,7 +21,9 @@
 #include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <memory_resource>
 #include <ranges>
+#include <span>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -29,22 +31,52 @@
 #include "waylander/byte_vec.hpp"
 #include "waylander/sstd.hpp"
 #include "waylander/type_utils.hpp"
+#include "waylander/wayland/message_utils.hpp"
 #include "waylander/wayland/protocol_primitives.hpp"
 
 namespace waylander {
 namespace wl {
 
 class message_buffer {
-    sstd::byte_vec buff_{};
-    std::vector<Wfd> fd_buff_{};
+    sstd::pmr::byte_vec buff_{};
+    std::pmr::vector<Wfd> fd_buff_{};
 
   public:
+    [[nodiscard]] message_buffer() = default;
+
+    /// All of the storage of the buffer is allocated from \p resource.
+    [[nodiscard]] explicit message_buffer(std::pmr::memory_resource* const resource)
+        : buff_{ sstd::pmr::byte_vec_alloc{ resource } },
+          fd_buff_{ std::pmr::polymorphic_allocator<Wfd>{ resource } } {}
+
+    /// Memory resource which all of the storage of the buffer is allocated from.
+    [[nodiscard]] auto resource() const noexcept -> std::pmr::memory_resource* {
+        return buff_.get_allocator().resource();
+    }
+
     /// True if buffer does not contains any data.
     constexpr bool empty() { return buff_.empty() and fd_buff_.empty(); }
 
+    /// Amount of bytes in the buffer, which does not include the file descriptors.
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return buff_.size(); }
+
+    /// View of the bytes in the buffer, which is invalidated by any modification of the buffer.
+    [[nodiscard]] constexpr auto data() const noexcept -> std::span<const std::byte> {
+        return buff_;
+    }
+
+    /// View of the file descriptors in the buffer, which is invalidated by any modification.
+    [[nodiscard]] constexpr auto fds() const noexcept -> std::span<const Wfd> { return fd_buff_; }
+
+    /// Removes all data and file descriptors but keeps the allocated storage for reuse.
+    constexpr void clear() noexcept {
+        buff_.clear();
+        fd_buff_.clear();
+    }
+
     template<interface WObj, message_for_inteface<WObj> Message>
     constexpr void append(const Wobject<WObj> obj, const Message& msg) {
-        const auto msg_primitives               = sstd::to_ref_tuple(msg);
+        const auto msg_primitives               = message_arguments_as_ref_tuple(msg);
         constexpr auto amount_of_msg_primitives = std::tuple_size_v<decltype(msg_primitives)>;
 
         auto msg_total_size = sizeof(message_header<WObj>);
@@ -130,14 +162,35 @@ class message_buffer {
                     sizeof(header));
     }
 
-    constexpr auto release_data() -> sstd::byte_vec {
-        return std::exchange(buff_, sstd::byte_vec{});
+    /// Appends already encoded messages and file descriptors belonging to them.
+    ///
+    /// Precondition: \p data consists of whole Wayland wire format messages.
+    constexpr void append_encoded(const std::span<const std::byte> data,
+                                  const std::span<const Wfd> fds = {}) {
+        buff_.insert(buff_.end(), data.begin(), data.end());
+        fd_buff_.insert(fd_buff_.end(), fds.begin(), fds.end());
+    }
+
+    /// Released data is allocated from the memory resource of this buffer.
+    constexpr auto release_data() -> sstd::pmr::byte_vec {
+        return std::exchange(buff_, sstd::pmr::byte_vec(buff_.get_allocator()));
     };
 
-    constexpr auto release_fds() -> std::vector<Wfd> {
-        return std::exchange(fd_buff_, std::vector<Wfd>{});
+    /// Released file descriptors are allocated from the memory resource of this buffer.
+    constexpr auto release_fds() -> std::pmr::vector<Wfd> {
+        return std::exchange(fd_buff_, std::pmr::vector<Wfd>(fd_buff_.get_allocator()));
     };
 };
 
+/// Runtime entry point of message_buffer::append used by connected_client.
+///
+/// Unlike message_buffer::append this is neither constexpr nor inline, so the extern
+/// template declarations generated for meson option explicit_instantiations suppress its
+/// instantiation in user translation units.
+template<interface WObj, message_for_inteface<WObj> Message>
+void encode_request(message_buffer& buff, const Wobject<WObj> obj, const Message& msg) {
+    buff.append(obj, msg);
+}
+
 } // namespace wl
 } // namespace waylander
@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstring>
 #include <span>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 
@@ -32,74 +33,179 @@
 namespace waylander {
 namespace wl {
 
-/// Interperts given bytes as Wayland wire format message payload.
-template<typename Msg>
-constexpr auto interpert_message_payload(const std::span<const std::byte> payload) -> Msg {
-    using msg_primitives_as_tuple           = decltype(sstd::to_tuple(std::declval<Msg>()));
-    constexpr auto amount_of_msg_primitives = std::tuple_size_v<msg_primitives_as_tuple>;
-
-    auto bytes_read{ 0uz };
-
-    const auto read_element_32aligned = [&]<typename T>(std::type_identity<T>) -> T {
-        if constexpr (std::same_as<Wstring, T>) {
-            // Read size:
-            Wstring::size_type str_size;
-            std::memcpy(&str_size, std::addressof(payload[bytes_read]), sizeof(str_size));
-
-            // Handle null string because if not here then (*) below is broken.
-            if (str_size == 0) {
-                // null-string
-                return Wstring{};
-            }
+/// Determines if the payload is validated before it is interperted.
+enum class decode_policy {
+    /// Payload is assumed to be valid, e.g. it is produced by message_buffer.
+    trusted,
+    /// Payload is validated with validate_message_payload and std::logic_error is thrown if
+    /// it is invalid, so that e.g. a malformed message from the compositor is not read past.
+    checked
+};
+
+/// Size in bytes, including padding, of the argument of type T at the beginning of \p payload.
+///
+/// File descriptors are not part of the payload, so their size is zero.
+///
+/// Precondition: \p payload begins with a valid argument of type T.
+template<typename T>
+constexpr auto message_argument_wire_size(const std::span<const std::byte> payload)
+    -> std::size_t {
+    if constexpr (std::same_as<Wstring, T> or std::same_as<Warray, T>) {
+        typename T::size_type element_size;
+        std::memcpy(&element_size, payload.data(), sizeof(element_size));
+
+        const auto unpadded_total_size = sizeof(element_size) + element_size;
+        return unpadded_total_size + sstd::round_upto_multiple_of<4>(unpadded_total_size);
+    } else if constexpr (std::same_as<Wfd, T>) {
+        return 0uz;
+    } else if constexpr (static_message_argument<T>) {
+        return sizeof(T) + sstd::round_upto_multiple_of<4>(sizeof(T));
+    }
+}
 
-            const auto str_begin = std::addressof(payload[bytes_read + sizeof(Wstring::size_type)]);
+/// Interperts the argument of type T at the beginning of \p payload.
+///
+/// Precondition: \p payload begins with a valid argument of type T.
+template<typename T>
+constexpr auto interpert_message_argument(const std::span<const std::byte> payload) -> T {
+    if constexpr (std::same_as<Wstring, T>) {
+        // Read size:
+        Wstring::size_type str_size;
+        std::memcpy(&str_size, payload.data(), sizeof(str_size));
+
+        // Handle null string because if not here then (*) below is broken.
+        if (str_size == 0) {
+            // null-string
+            return Wstring{};
+        }
 
-            // Increment bytes_read:
-            const auto unpadded_total_size = sizeof(str_size) + str_size;
-            const auto padded_total_size =
-                unpadded_total_size + sstd::round_upto_multiple_of<4>(unpadded_total_size);
-            bytes_read += padded_total_size;
+        const auto str_begin = payload.data() + sizeof(Wstring::size_type);
 
-            static_assert(std::alignment_of_v<char8_t> == 1, "Sanity check for obscure platforms.");
+        static_assert(std::alignment_of_v<char8_t> == 1, "Sanity check for obscure platforms.");
 
-            return Wstring{ std::u8string_view(
+        return Wstring{ std::u8string_view(
 #ifdef __cpp_lib_start_lifetime_as // Techincally UB without this.
-                std::start_lifetime_as_array<char8_t>(str_begin, str_size),
+            std::start_lifetime_as_array<char8_t>(str_begin, str_size),
 #else
-                reinterpret_cast<char8_t const*>(str_begin),
+            reinterpret_cast<char8_t const*>(str_begin),
 #endif
-                str_size - 1) }; // (*) -1 for null delimiter
-        } else if constexpr (std::same_as<Warray, T>) {
-            // Read size:
-            Warray::size_type array_size;
-            std::memcpy(&array_size, std::addressof(payload[bytes_read]), sizeof(array_size));
+            str_size - 1) }; // (*) -1 for null delimiter
+    } else if constexpr (std::same_as<Warray, T>) {
+        // Read size:
+        Warray::size_type array_size;
+        std::memcpy(&array_size, payload.data(), sizeof(array_size));
+
+        // Pointer arithmetic instead of indexing, as empty array may end the payload.
+        const auto array_begin = payload.data() + sizeof(Warray::size_type);
+        return Warray{ std::span(array_begin, array_size) };
+    } else if constexpr (static_message_argument<T>) {
+        T elem;
+        std::memcpy(std::addressof(elem), payload.data(), sizeof(T));
+        return elem;
+    }
+}
+
+/// Checks that \p payload is a valid Wayland wire format payload of message type Msg.
+///
+/// Valid payload has all of its arguments in bounds, including the padding of
+/// Wstring and Warray arguments, non-null strings end with the null delimiter and
+/// the arguments span the whole payload.
+template<typename Msg>
+constexpr bool validate_message_payload(const std::span<const std::byte> payload) {
+    using msg_primitives_as_tuple           = message_argument_tuple<Msg>;
+    constexpr auto amount_of_msg_primitives = std::tuple_size_v<msg_primitives_as_tuple>;
+
+    auto bytes_read{ 0uz };
+
+    const auto validate_element_32aligned = [&]<typename T>(std::type_identity<T>) -> bool {
+        const auto unread_bytes = payload.size() - bytes_read;
+
+        if constexpr (std::same_as<Wstring, T> or std::same_as<Warray, T>) {
+            // Wstring and Warray use same size type.
+            static_assert(sizeof(Wstring::size_type) == sizeof(Warray::size_type));
 
-            const auto array_begin =
-                std::addressof(payload[bytes_read + sizeof(Warray::size_type)]);
+            if (unread_bytes < sizeof(typename T::size_type)) { return false; }
+            typename T::size_type element_size;
+            std::memcpy(&element_size, std::addressof(payload[bytes_read]), sizeof(element_size));
 
-            // Increment bytes_read:
-            const auto unpadded_total_size = sizeof(array_size) + array_size;
+            // Can not overflow, as std::size_t is wider than the size type.
+            const auto unpadded_total_size = sizeof(element_size) + std::size_t{ element_size };
             const auto padded_total_size =
                 unpadded_total_size + sstd::round_upto_multiple_of<4>(unpadded_total_size);
-            bytes_read += padded_total_size;
-
-            return Warray{ std::span(array_begin, array_size) };
+            if (unread_bytes < padded_total_size) { return false; }
+
+            if constexpr (std::same_as<Wstring, T>) {
+                // Non-null strings have to end with null delimiter.
+                if (element_size != 0
+                    and payload[bytes_read + unpadded_total_size - 1uz] != std::byte{ 0 }) {
+                    return false;
+                }
+            }
 
+            bytes_read += padded_total_size;
+            return true;
+        } else if constexpr (std::same_as<Wfd, T>) {
+            // File descriptors are not part of the payload.
+            return true;
         } else if constexpr (static_message_argument<T>) {
             constexpr auto pad          = sstd::round_upto_multiple_of<4>(sizeof(T));
             constexpr auto element_size = sizeof(T) + pad;
-            T elem;
-            std::memcpy(std::addressof(elem), std::addressof(payload[bytes_read]), sizeof(T));
+            if (unread_bytes < element_size) { return false; }
             bytes_read += element_size;
-            return elem;
+            return true;
         }
     };
 
+    const auto elements_ok = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        // Short circuits, so bytes_read never goes past the payload.
+        return (validate_element_32aligned(
+                    std::type_identity<std::tuple_element_t<I, msg_primitives_as_tuple>>{})
+                and ...);
+    }(std::make_index_sequence<amount_of_msg_primitives>());
+
+    return elements_ok and bytes_read == payload.size();
+}
+
+/// Interperts given bytes as Wayland wire format message payload.
+///
+/// With decode_policy::trusted the payload is read without any checks, so it has to be valid.
+/// With decode_policy::checked it is validated first, see validate_message_payload.
+template<typename Msg, decode_policy Policy = decode_policy::trusted>
+constexpr auto interpert_message_payload(const std::span<const std::byte> payload) -> Msg {
+    using msg_primitives_as_tuple           = message_argument_tuple<Msg>;
+    constexpr auto amount_of_msg_primitives = std::tuple_size_v<msg_primitives_as_tuple>;
+
+    if constexpr (Policy == decode_policy::checked) {
+        if (not validate_message_payload<Msg>(payload)) {
+            throw std::logic_error{ "Invalid Wayland message payload." };
+        }
+    }
+
+    auto bytes_read{ 0uz };
+
+    const auto read_element_32aligned = [&]<typename T>(std::type_identity<T>) -> T {
+        const auto element = payload.subspan(bytes_read);
+        bytes_read += message_argument_wire_size<T>(element);
+        return interpert_message_argument<T>(element);
+    };
+
     return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        // Braced initialization guarantees left-to-right evaluation order.
         return Msg{ read_element_32aligned(
             std::type_identity<std::tuple_element_t<I, msg_primitives_as_tuple>>{})... };
     }(std::make_index_sequence<amount_of_msg_primitives>());
 }
 
+/// Runtime entry point of interpert_message_payload used by message_overload_set,
+/// event streams and connected_client.
+///
+/// Unlike interpert_message_payload this is neither constexpr nor inline, so the extern
+/// template declarations generated for meson option explicit_instantiations suppress its
+/// instantiation in user translation units.
+template<typename Msg, decode_policy Policy = decode_policy::trusted>
+auto decode_message_payload(const std::span<const std::byte> payload) -> Msg {
+    return interpert_message_payload<Msg, Policy>(payload);
+}
+
 } // namespace wl
 } // namespace waylander
@@ -21,13 +21,15 @@
 #include <concepts>
 #include <cstddef>
 #include <functional>
+#include <memory_resource>
 #include <optional>
 #include <span>
-#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 
+#include "waylander/wayland/decode_arena.hpp"
 #include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_view.hpp"
 #include "waylander/wayland/protocol_primitives.hpp"
 
 namespace waylander {
@@ -43,6 +45,10 @@ namespace wl {
 ///
 /// Note that the overloads can hold a state, so to make the implementation simpler,
 /// a const message_overload_set is not supported.
+///
+/// The dispatch table can be allocated from a std::pmr::memory_resource. However,
+/// std::move_only_function does not support allocators, so overloads which do not fit
+/// to its small buffer are still allocated with operator new.
 class message_overload_set {
     using key_t = std::pair<Wobject<generic_object>, Wopcode<generic_object>>;
 
@@ -53,27 +59,115 @@ class message_overload_set {
     /// The overloads have different call signatures, so they have to be type erased.
     using erased_overload_t = std::move_only_function<void(std::span<const std::byte>)>;
 
-    std::unordered_map<key_t, erased_overload_t, key_t_hash> overloads_{};
+  public:
+    /// Overload and the interface of the object it was added for.
+    struct overload_entry {
+        erased_overload_t overload;
+        /// See interface_info_if_known.
+        const interface_info* interface;
+    };
+
+  private:
+    std::pmr::unordered_map<key_t, overload_entry, key_t_hash> overloads_{};
+
+    /// Throws if overload for \p key is already present.
+    void insert_overload(key_t key,
+                         erased_overload_t&& overload,
+                         const interface_info* interface = nullptr);
 
   public:
-    template<typename Msg, interface W>
-    void add_overload(const Wobject<W> obj_id, std::invocable<Msg> auto&& overload_arg) {
-        const auto [_, insert_ok] =
-            overloads_.insert({ key_t{ obj_id.value, Msg::opcode.value },
-                                [overload = std::forward<decltype(overload_arg)>(overload_arg)](
-                                    const std::span<const std::byte> payload) mutable {
-                                    std::invoke(overload, interpert_message_payload<Msg>(payload));
-                                } });
-
-        if (not insert_ok) {
-            throw std::runtime_error{ "Overload for {Wobject<W>, Msg::opcode} already present!" };
-        }
+    [[nodiscard]] message_overload_set() = default;
+
+    /// Dispatch table is allocated from \p resource.
+    [[nodiscard]] explicit message_overload_set(std::pmr::memory_resource* const resource)
+        : overloads_{ decltype(overloads_)::allocator_type{ resource } } {}
+
+    /// Adds \p overload_arg for message Msg of \p obj_id.
+    ///
+    /// By default the payloads are validated before they are interperted, see decode_policy.
+    /// Msg has to be available at the bound version of \p obj_id, see Wobject.
+    template<typename Msg,
+             decode_policy Policy = decode_policy::checked,
+             interface W,
+             protocol_version Version>
+    void add_overload(const Wobject<W, Version> obj_id,
+                      std::invocable<Msg> auto&& overload_arg) {
+        static_assert(message_available_at<Msg, Version>,
+                      "Message is newer than the bound version of the object.");
+        insert_overload(key_t{ obj_id.value, Msg::opcode.value },
+                        [overload = std::forward<decltype(overload_arg)>(overload_arg)](
+                            const std::span<const std::byte> payload) mutable {
+                            std::invoke(overload, decode_message_payload<Msg, Policy>(payload));
+                        },
+                        interface_info_if_known<W>);
+    }
+
+    /// Like add_overload(obj_id, overload) but the Wstring and Warray arguments of
+    /// the message given to the overload are copied to \p arena, see decode_arena.
+    ///
+    /// \p arena has to outlive this message_overload_set.
+    template<typename Msg,
+             decode_policy Policy = decode_policy::checked,
+             interface W,
+             protocol_version Version>
+    void add_overload(const Wobject<W, Version> obj_id,
+                      decode_arena& arena,
+                      std::invocable<Msg> auto&& overload_arg) {
+        static_assert(message_available_at<Msg, Version>,
+                      "Message is newer than the bound version of the object.");
+        insert_overload(key_t{ obj_id.value, Msg::opcode.value },
+                        [&arena, overload = std::forward<decltype(overload_arg)>(overload_arg)](
+                            const std::span<const std::byte> payload) mutable {
+                            std::invoke(overload,
+                                        interpert_message_payload<Msg, Policy>(payload, arena));
+                        },
+                        interface_info_if_known<W>);
+    }
+
+    /// Like add_overload(obj_id, overload) but the overload is given message_view<Msg>,
+    /// so only the arguments it accesses are decoded.
+    template<typename Msg,
+             decode_policy Policy = decode_policy::checked,
+             interface W,
+             protocol_version Version>
+    void add_view_overload(const Wobject<W, Version> obj_id,
+                           std::invocable<message_view<Msg>> auto&& overload_arg) {
+        static_assert(message_available_at<Msg, Version>,
+                      "Message is newer than the bound version of the object.");
+        insert_overload(key_t{ obj_id.value, Msg::opcode.value },
+                        [overload = std::forward<decltype(overload_arg)>(overload_arg)](
+                            const std::span<const std::byte> payload) mutable {
+                            std::invoke(overload, view_message_payload<Msg, Policy>(payload));
+                        },
+                        interface_info_if_known<W>);
+    }
+
+    /// Adds \p overload_arg for raw payloads of messages \p opcode of \p obj_id.
+    ///
+    /// Useful when the interface of the object is not known, e.g. when replaying a wire trace.
+    void add_payload_overload(const Wobject<generic_object> obj_id,
+                              const Wopcode<generic_object> opcode,
+                              std::invocable<std::span<const std::byte>> auto&& overload_arg) {
+        insert_overload(key_t{ obj_id, opcode },
+                        erased_overload_t{ std::forward<decltype(overload_arg)>(overload_arg) });
+    }
+
+    /// Removes overload for message \p opcode of \p obj_id if there is one.
+    ///
+    /// Must not be called from the removed overload.
+    void remove_overload(const Wobject<generic_object> obj_id,
+                         const Wopcode<generic_object> opcode) {
+        overloads_.erase({ obj_id, opcode });
     }
 
     /// Finds overload corresponding to {object id, opcode}-pair or returns empty optional.
     auto overload_resolution(const Wobject<generic_object> obj_id,
                              const Wopcode<generic_object> opcode)
         -> std::optional<std::reference_wrapper<erased_overload_t>>;
+
+    /// Like overload_resolution but returns nullptr on failure and gives also the interface.
+    auto find_overload(const Wobject<generic_object> obj_id, const Wopcode<generic_object> opcode)
+        -> overload_entry*;
 };
 
 } // namespace wl
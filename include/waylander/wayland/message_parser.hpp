@@ -19,9 +19,13 @@
 /// Implements parsing Wayland protocol messages from raw bytes.
 
 #include <cstddef>
+#include <cstring>
 #include <generator>
+#include <iterator>
+#include <memory_resource>
 #include <ranges>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "waylander/byte_vec.hpp"
@@ -31,6 +35,123 @@
 namespace waylander {
 namespace wl {
 
+/// Parse the message at the beginning of \p buff.
+///
+/// Throws std::logic_error if \p buff does not begin with a whole message.
+[[nodiscard]] auto parse_first_message(const std::span<const std::byte> buff) -> parsed_message;
+
+/// Parse the message at the beginning of \p buff without any checks.
+///
+/// Precondition: \p buff begins with a whole message of at least 8 bytes.
+[[nodiscard]] inline auto parse_first_message_unchecked(const std::span<const std::byte> buff)
+    -> parsed_message {
+    parsed_message msg;
+    Wmessage_size_t msg_size;
+    std::memcpy(&msg.object_id, buff.data(), sizeof(msg.object_id));
+    std::memcpy(&msg.opcode,
+                buff.data() + message_header<generic_object>::opcode_offset,
+                sizeof(msg.opcode));
+    std::memcpy(&msg_size,
+                buff.data() + message_header<generic_object>::size_offset,
+                sizeof(msg_size));
+
+    msg.arguments = buff.subspan(sizeof(message_header<generic_object>),
+                                 msg_size.value - sizeof(message_header<generic_object>));
+    return msg;
+}
+
+/// Amount of bytes from the beginning of \p buff which form whole messages.
+///
+/// Throws std::logic_error if a message header has size less than 8 bytes.
+[[nodiscard]] auto whole_messages_size(const std::span<const std::byte> buff) -> std::size_t;
+
+/// Forward range of the messages in a buffer.
+///
+/// Like parsed_message_generator, but the iterator is a plain value type
+/// which parses the messages as it is advanced, so iterating does not allocate.
+///
+/// If Checked is true, messages are parsed with parse_first_message,
+/// so partial messages throw when the iterator reaches them.
+/// Otherwise parse_first_message_unchecked is used and the buffer has to
+/// consist of whole messages, e.g. bytes returned by
+/// connected_client::get_recd_bytes_forming_whole_messages.
+///
+/// The range is a view, so the buffer has to outlive it and its iterators.
+template<bool Checked>
+class basic_parsed_message_range {
+    std::span<const std::byte> buff_;
+
+  public:
+    class iterator {
+        /// Bytes starting from the current message.
+        std::span<const std::byte> unparsed_{};
+        parsed_message current_{};
+
+        constexpr void parse_current() {
+            if (unparsed_.empty()) { return; }
+            if constexpr (Checked) {
+                current_ = parse_first_message(unparsed_);
+            } else {
+                current_ = parse_first_message_unchecked(unparsed_);
+            }
+        }
+
+      public:
+        using value_type      = parsed_message;
+        using difference_type = std::ptrdiff_t;
+
+        [[nodiscard]] constexpr iterator() = default;
+
+        [[nodiscard]] constexpr explicit iterator(const std::span<const std::byte> buff)
+            : unparsed_{ buff } {
+            parse_current();
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> const parsed_message& {
+            return current_;
+        }
+
+        [[nodiscard]] constexpr auto operator->() const noexcept -> const parsed_message* {
+            return &current_;
+        }
+
+        constexpr auto operator++() -> iterator& {
+            unparsed_ = unparsed_.subspan(sizeof(message_header<generic_object>)
+                                          + current_.arguments.size());
+            parse_current();
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> iterator {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const noexcept {
+            return unparsed_.data() == other.unparsed_.data()
+                   and unparsed_.size() == other.unparsed_.size();
+        }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept {
+            return unparsed_.empty();
+        }
+    };
+
+    [[nodiscard]] constexpr explicit basic_parsed_message_range(
+        const std::span<const std::byte> buff) noexcept
+        : buff_{ buff } {}
+
+    [[nodiscard]] constexpr auto begin() const -> iterator { return iterator{ buff_ }; }
+    [[nodiscard]] constexpr auto end() const noexcept -> std::default_sentinel_t { return {}; }
+};
+
+using parsed_message_range           = basic_parsed_message_range<true>;
+using unchecked_parsed_message_range = basic_parsed_message_range<false>;
+
+static_assert(std::ranges::forward_range<parsed_message_range>);
+static_assert(std::ranges::forward_range<unchecked_parsed_message_range>);
+
 /// Parse messages from \p buff one at a time.
 ///
 /// One at a time means that the next unparsed message is parsed when begin is
@@ -45,14 +166,26 @@ namespace wl {
     -> std::generator<const parsed_message&>;
 
 class message_parser {
-    sstd::byte_vec unparsed_messages_;
+    sstd::pmr::byte_vec unparsed_messages_;
 
   public:
-    [[nodiscard]] constexpr message_parser(const std::span<const std::byte> input)
-        : unparsed_messages_(input.begin(), input.end()) {}
+    /// Copy of \p input is allocated from \p resource.
+    [[nodiscard]] message_parser(
+        const std::span<const std::byte> input,
+        std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+        : unparsed_messages_(input.begin(), input.end(), sstd::pmr::byte_vec_alloc{ resource }) {}
+
+    /// Takes ownership of \p messages without copying them.
+    [[nodiscard]] explicit message_parser(sstd::pmr::byte_vec&& messages) noexcept
+        : unparsed_messages_(std::move(messages)) {}
 
     /// Returned generator can not outlive message_parser pointed by this pointer.
     [[nodiscard]] auto message_generator() -> std::generator<const parsed_message&>;
+
+    /// Returned range can not outlive message_parser pointed by this pointer.
+    [[nodiscard]] auto messages() const noexcept -> parsed_message_range {
+        return parsed_message_range{ unparsed_messages_ };
+    }
 };
 
 } // namespace wl
@@ -0,0 +1,73 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements rendering of raw messages as text using the generated message metadata.
+///
+/// Rendering is separate from sending and receiving, so the hot path only has to keep
+/// the raw bytes, e.g. with wire_trace_ring, and the text is rendered offline or on demand.
+
+#include <generator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Renders messages like WAYLAND_DEBUG, e.g. wl_registry#2.global(name: 1, ...).
+///
+/// Interfaces of the objects are followed from the new_id arguments
+/// and wl_display::delete_id events of the rendered messages.
+class message_printer {
+    std::span<const interface_info> interfaces_;
+    std::unordered_map<Wuint::integral_type, const interface_info*> objects_{};
+
+    [[nodiscard]] auto find_interface(std::u8string_view name) const -> const interface_info*;
+
+  public:
+    /// Messages of \p interfaces can be rendered, e.g. protocols::wayland_interfaces.
+    ///
+    /// global_display_object is bound to wl_display, if it is one of \p interfaces.
+    [[nodiscard]] explicit message_printer(std::span<const interface_info> interfaces);
+
+    /// Binds \p obj to interface with name \p interface, e.g. objects created before printing.
+    ///
+    /// Unknown interfaces are ignored.
+    void bind(Wobject<generic_object> obj, std::u8string_view interface);
+
+    /// Renders \p msg as a request if \p direction is sent, otherwise as an event.
+    ///
+    /// Messages of unknown objects or opcodes are rendered with their size only.
+    /// Throws std::logic_error if the arguments of \p msg do not match its signature.
+    [[nodiscard]] auto format(wire_direction direction, const parsed_message& msg) -> std::string;
+};
+
+/// Renders every message of \p trace on its own line prefixed with the time since the first record.
+///
+/// Requests are marked with " -> " like in WAYLAND_DEBUG output.
+/// Messages split between records are reassembled, separately for both directions.
+[[nodiscard]] auto format_wire_trace(std::span<const std::byte> trace, message_printer& printer)
+    -> std::generator<std::string>;
+
+} // namespace wl
+} // namespace waylander
@@ -19,6 +19,7 @@
 /// Utilities for handling Wayland messages.
 
 #include <concepts>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -32,8 +33,8 @@ namespace wl {
 namespace {
 template<typename>
 struct is_any_Wobject : std::false_type {};
-template<interface WObj>
-struct is_any_Wobject<Wobject<WObj>> : std::true_type {};
+template<interface WObj, protocol_version Version>
+struct is_any_Wobject<Wobject<WObj, Version>> : std::true_type {};
 
 template<typename>
 struct is_any_Wnew_id : std::false_type {};
@@ -56,35 +57,75 @@ template<typename A>
 concept dynamic_message_argument =
     std::same_as<A, Wstring> or std::same_as<A, Warray> or std::same_as<A, Wfd>;
 
+/// True if Wmsg lists its arguments in Wmsg::fields, as the generated messages do.
+///
+/// Defining WAYLANDER_PROBE_MESSAGE_ARGUMENTS ignores the fields and probes every message,
+/// which is only meant for comparing compile times, see benchmarks/measure_compile_time.py.
+template<typename Wmsg>
+concept message_with_fields =
+#ifdef WAYLANDER_PROBE_MESSAGE_ARGUMENTS
+    false and
+#endif
+    requires { typename Wmsg::fields; };
+
+namespace {
+template<typename Wmsg>
+struct message_argument_tuple_impl {
+    using type = decltype(sstd::to_tuple(std::declval<Wmsg>()));
+};
+
+template<message_with_fields Wmsg>
+struct message_argument_tuple_impl<Wmsg> {
+    using type = typename Wmsg::fields::types;
+};
+} // namespace
+
+/// std::tuple of the argument types of Wmsg in wire order.
+///
+/// Uses generated Wmsg::fields if available, otherwise probes the aggregate with sstd::to_tuple.
+template<typename Wmsg>
+using message_argument_tuple = typename message_argument_tuple_impl<Wmsg>::type;
+
+/// Arguments of \p msg as tuple of const references in wire order.
+template<typename Wmsg>
+constexpr auto message_arguments_as_ref_tuple(const Wmsg& msg) {
+    if constexpr (message_with_fields<Wmsg>) {
+        return Wmsg::fields::tie(msg);
+    } else {
+        return sstd::to_ref_tuple(msg);
+    }
+}
+
 template<typename Wmsg>
 using message_args_to_tuple =
-    sstd::steal_template_args_t<decltype(sstd::to_tuple(std::declval<Wmsg>())), sstd::type_list>;
+    sstd::steal_template_args_t<message_argument_tuple<Wmsg>, sstd::type_list>;
 
 template<typename Wmsg>
 using message_args_to_type_list =
     sstd::steal_template_args_t<message_args_to_tuple<Wmsg>, sstd::type_list>;
 
+namespace {
+/// Implementation detail of static_message and message_payload_size.
+///
+/// Fold expressions over the argument pack keep the instantiation depth constant,
+/// as these are instantiated for every message of every protocol.
+template<typename>
+struct message_argument_list_traits;
+
+template<typename... Args>
+struct message_argument_list_traits<sstd::type_list<Args...>> {
+    static constexpr bool all_static = (static_message_argument<Args> and ...);
+    static constexpr std::size_t size = (0uz + ... + sizeof(Args));
+};
+} // namespace
+
 template<typename Wmsg>
-concept static_message =
-    (sstd::template_invoke_with_list_t<std::conjunction,
-                                       typename message_args_to_type_list<Wmsg>::template map<
-                                           decltype([](static_message_argument auto) {
-                                               return std::integral_constant<bool, true>{};
-                                           }),
-                                           decltype([](dynamic_message_argument auto) {
-                                               return std::integral_constant<bool, false>{};
-                                           })>>::value);
+concept static_message = message_argument_list_traits<message_args_to_type_list<Wmsg>>::all_static;
 
 /// Calculates message size without the header in bytes.
 template<static_message Wmsg>
 constexpr auto message_payload_size(const Wmsg&) -> std::size_t {
-    using size_of = decltype([]<typename T>(T) { return sstd::numeral_t<sizeof(T)>{}; });
-    using add_op  = decltype([](auto Lhs, auto Rhs) {
-        return sstd::numeral_t<decltype(Lhs)::value + decltype(Rhs)::value>{};
-    });
-
-    return message_args_to_type_list<Wmsg>::template map<
-        size_of>::template fold_left<sstd::numeral_t<0uz>, add_op>::value;
+    return message_argument_list_traits<message_args_to_type_list<Wmsg>>::size;
 }
 
 } // namespace wl
@@ -0,0 +1,155 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements lazily decoding view of Wayland wire format message payload.
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "waylander/type_utils.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// View of message payload of type Msg, which decodes only the accessed arguments.
+///
+/// Arguments are accessed by name with get<&Msg::argument>() for the generated messages,
+/// which list their arguments in Msg::fields, or with get<I>(), where I is the index of
+/// the argument in declaration order of Msg. Offsets of the arguments before the first
+/// Wstring or Warray are compile-time constants, the rest are computed by
+/// walking the sizes of the preceding Wstring and Warray arguments on each access.
+///
+/// The view does not own the payload, so it is valid only as long as the payload is.
+template<typename Msg>
+class message_view {
+    using msg_primitives_as_tuple = message_argument_tuple<Msg>;
+
+    template<std::size_t I>
+    using argument_t = std::tuple_element_t<I, msg_primitives_as_tuple>;
+
+    std::span<const std::byte> payload_;
+
+  public:
+    static constexpr auto argument_count = std::tuple_size_v<msg_primitives_as_tuple>;
+
+  private:
+    template<std::size_t I>
+    static constexpr bool is_dynamic_argument =
+        std::same_as<argument_t<I>, Wstring> or std::same_as<argument_t<I>, Warray>;
+
+    /// Index of the first Wstring or Warray argument or argument_count if there is none.
+    static constexpr auto static_prefix_size = []<std::size_t... I>(std::index_sequence<I...>) {
+        // Extra element at the end, so the array is never empty.
+        constexpr bool is_dynamic[] = { is_dynamic_argument<I>..., false };
+        auto first_dynamic          = 0uz;
+        while (first_dynamic < argument_count and not is_dynamic[first_dynamic]) {
+            ++first_dynamic;
+        }
+        return first_dynamic;
+    }(std::make_index_sequence<argument_count>());
+
+    /// Offsets of the arguments with index I <= static_prefix_size.
+    template<std::size_t I>
+        requires(I <= static_prefix_size)
+    static constexpr auto static_offset = []<std::size_t... J>(std::index_sequence<J...>) {
+        // Static arguments do not depend on the payload, so empty span is enough.
+        return (0uz + ... + message_argument_wire_size<argument_t<J>>({}));
+    }(std::make_index_sequence<I>());
+
+    template<auto Member>
+    static consteval auto index_of() -> std::size_t {
+        constexpr auto index = Msg::fields::template index_of<Member>;
+        static_assert(index < argument_count, "Member is not an argument of the message.");
+        return index;
+    }
+
+  public:
+    [[nodiscard]] constexpr explicit message_view(const std::span<const std::byte> payload) noexcept
+        : payload_{ payload } {}
+
+    /// Offset of argument I from the beginning of the payload.
+    template<std::size_t I>
+        requires(I < argument_count)
+    [[nodiscard]] constexpr auto offset() const -> std::size_t {
+        if constexpr (I <= static_prefix_size) {
+            return static_offset<I>;
+        } else {
+            auto argument_offset = static_offset<static_prefix_size>;
+            [&]<std::size_t... J>(std::index_sequence<J...>) {
+                ((argument_offset += message_argument_wire_size<argument_t<static_prefix_size + J>>(
+                      payload_.subspan(argument_offset))),
+                 ...);
+            }(std::make_index_sequence<I - static_prefix_size>());
+            return argument_offset;
+        }
+    }
+
+    /// Decodes argument I.
+    template<std::size_t I>
+        requires(I < argument_count)
+    [[nodiscard]] constexpr auto get() const -> argument_t<I> {
+        return interpert_message_argument<argument_t<I>>(payload_.subspan(offset<I>()));
+    }
+
+    /// Offset of argument Member, which is a pointer to data member of Msg.
+    template<auto Member>
+        requires std::is_member_object_pointer_v<decltype(Member)> and message_with_fields<Msg>
+    [[nodiscard]] constexpr auto offset() const -> std::size_t {
+        return offset<index_of<Member>()>();
+    }
+
+    /// Decodes argument Member, which is a pointer to data member of Msg.
+    template<auto Member>
+        requires std::is_member_object_pointer_v<decltype(Member)> and message_with_fields<Msg>
+    [[nodiscard]] constexpr auto get() const -> argument_t<index_of<Member>()> {
+        return get<index_of<Member>()>();
+    }
+
+    /// Decodes all of the arguments.
+    [[nodiscard]] constexpr auto materialize() const -> Msg {
+        return interpert_message_payload<Msg>(payload_);
+    }
+
+    [[nodiscard]] constexpr auto payload() const noexcept -> std::span<const std::byte> {
+        return payload_;
+    }
+};
+
+/// Creates message_view of \p payload.
+///
+/// With decode_policy::checked the payload is validated first, see validate_message_payload.
+template<typename Msg, decode_policy Policy = decode_policy::trusted>
+constexpr auto view_message_payload(const std::span<const std::byte> payload)
+    -> message_view<Msg> {
+    if constexpr (Policy == decode_policy::checked) {
+        if (not validate_message_payload<Msg>(payload)) {
+            throw std::logic_error{ "Invalid Wayland message payload." };
+        }
+    }
+    return message_view<Msg>{ payload };
+}
+
+} // namespace wl
+} // namespace waylander
@@ -25,20 +25,28 @@
 
 #include "waylander/wayland/message_overload_set.hpp"
 #include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/timeline_tracer.hpp"
 
 namespace waylander {
 namespace wl {
 
 /// Invokes overload from \p mos corresponding to \p msg if present or invokes \p default_overload.
 ///
+/// Invocations of the overloads are recorded to \p timeline if it is not nullptr.
+///
 /// Precondition: \p msg.arguments is a valid Wayland wire format message payload of
 /// message type corresponding to the resolved overload.
 template<typename F>
     requires std::invocable<F> or std::invocable<F, const parsed_message&>
-void message_visit(F&& default_overload, message_overload_set& mos, const parsed_message& msg) {
-    const auto overload_resolution = mos.overload_resolution(msg.object_id, msg.opcode);
-    if (overload_resolution.has_value()) {
-        std::invoke(overload_resolution.value(), msg.arguments);
+void message_visit(F&& default_overload,
+                   message_overload_set& mos,
+                   const parsed_message& msg,
+                   timeline_tracer* const timeline = nullptr) {
+    const auto entry = mos.find_overload(msg.object_id, msg.opcode);
+    if (entry) {
+        const auto span =
+            timeline_scope{ timeline, timeline_kind::dispatch, entry->interface, msg };
+        std::invoke(entry->overload, msg.arguments);
     } else {
         if constexpr (std::invocable<F>) {
             std::invoke(default_overload);
@@ -53,11 +61,12 @@ template<typename F>
     requires std::invocable<F> or std::invocable<F, const parsed_message&>
 void message_visit(F&& default_overload,
                    message_overload_set& mos,
-                   std::ranges::input_range auto&& msg_range) {
+                   std::ranges::input_range auto&& msg_range,
+                   timeline_tracer* const timeline = nullptr) {
     // Offload any additional requirements of msg_range to constraints of std::ranges::for_each.
     std::ranges::for_each(
         std::forward<decltype(msg_range)>(msg_range),
-        [&](const parsed_message& msg) { message_visit(default_overload, mos, msg); });
+        [&](const parsed_message& msg) { message_visit(default_overload, mos, msg, timeline); });
 }
 
 } // namespace wl
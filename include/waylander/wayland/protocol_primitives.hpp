@@ -18,12 +18,16 @@
 /// @file
 /// Defines mapping from Wayland protocol primitives to C++.
 
+#include <array>
 #include <bit>
 #include <climits>
+#include <compare>
 #include <concepts>
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 
 #include "gnulander/fd_handle.hpp"
@@ -50,17 +54,81 @@ struct Wuint {
     using integral_type = std::uint32_t;
     integral_type value;
 };
+
+/// Signed 24.8 fixed-point number, i.e. value / 256.
+///
+/// Conversions from and to double round the same way as libwayland.
 struct Wfixed {
-    bool is_negative : 1;
-    unsigned mantissa : 23;
-    unsigned exponent : 8;
+    using integral_type = std::int32_t;
+    /// Wire representation, which is the number multiplied by 256.
+    integral_type value;
+
+    static constexpr auto fractional_bits = 8;
+    static constexpr auto scale           = integral_type{ 1 } << fractional_bits;
+
+    /// Rounds \p d to the nearest representable number.
+    [[nodiscard]] static constexpr auto from_double(const double d) noexcept -> Wfixed {
+        // Adding 1.5 * 2^(52 - 8) moves the 24.8 representation of d to the low bits.
+        const auto shifted = d + static_cast<double>(std::int64_t{ 3 } << (51 - fractional_bits));
+        return { static_cast<integral_type>(std::bit_cast<std::int64_t>(shifted)) };
+    }
+
+    [[nodiscard]] static constexpr auto from_int(const integral_type i) noexcept -> Wfixed {
+        return { i * scale };
+    }
+
+    [[nodiscard]] constexpr auto to_double() const noexcept -> double {
+        return static_cast<double>(value) / scale;
+    }
+
+    /// Rounds towards zero.
+    [[nodiscard]] constexpr auto to_int() const noexcept -> integral_type { return value / scale; }
+
+    [[nodiscard]] friend constexpr auto operator<=>(Wfixed, Wfixed) noexcept = default;
+
+    [[nodiscard]] constexpr auto operator-() const noexcept -> Wfixed { return { -value }; }
+
+    [[nodiscard]] friend constexpr auto operator+(const Wfixed lhs, const Wfixed rhs) noexcept
+        -> Wfixed {
+        return { lhs.value + rhs.value };
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const Wfixed lhs, const Wfixed rhs) noexcept
+        -> Wfixed {
+        return { lhs.value - rhs.value };
+    }
+
+    /// Rounds towards negative infinity.
+    [[nodiscard]] friend constexpr auto operator*(const Wfixed lhs, const Wfixed rhs) noexcept
+        -> Wfixed {
+        const auto product = std::int64_t{ lhs.value } * std::int64_t{ rhs.value };
+        return { static_cast<integral_type>(product >> fractional_bits) };
+    }
+
+    /// Rounds towards zero.
+    [[nodiscard]] friend constexpr auto operator/(const Wfixed lhs, const Wfixed rhs) noexcept
+        -> Wfixed {
+        const auto dividend = std::int64_t{ lhs.value } * scale;
+        return { static_cast<integral_type>(dividend / rhs.value) };
+    }
+
+    constexpr auto operator+=(const Wfixed rhs) noexcept -> Wfixed& { return *this = *this + rhs; }
+    constexpr auto operator-=(const Wfixed rhs) noexcept -> Wfixed& { return *this = *this - rhs; }
+    constexpr auto operator*=(const Wfixed rhs) noexcept -> Wfixed& { return *this = *this * rhs; }
+    constexpr auto operator/=(const Wfixed rhs) noexcept -> Wfixed& { return *this = *this / rhs; }
 };
 
+/// Version of an interface.
+using protocol_version = std::uint32_t;
+
+/// Version of objects whose bound version is not tracked, so all messages are assumed available.
+inline constexpr protocol_version any_version = 0;
+
 /// Forward decleration for converting operator in Wobject.
 template<interface T>
 struct Wnew_id;
 
-template<interface WObj = generic_object>
+template<interface WObj = generic_object, protocol_version Version = any_version>
 struct Wobject {
     using integral_type = Wuint::integral_type;
     integral_type value;
@@ -82,6 +150,17 @@ struct Wobject {
     Wobject<WObj> reserve_id(class connected_client& client);
 };
 
+/// Wobject which is bound with version at most Version.
+///
+/// Converts to Wobject<WObj>, so it can be used everywhere where unversioned one can.
+/// Messages introduced after Version can not be sent to or by it,
+/// so overload sets and event streams of it can leave them out at compile time.
+template<interface WObj, protocol_version Version>
+    requires(Version != any_version)
+struct Wobject<WObj, Version> : Wobject<WObj> {
+    static constexpr auto version = Version;
+};
+
 template<interface WObj = generic_object>
 struct Wnew_id {
     using integral_type = Wobject<WObj>::integral_type;
@@ -157,8 +236,138 @@ concept message_for_inteface = interface<Interface> and requires {
 };
 
 namespace {
+template<typename Msg>
+concept message_with_since = requires {
+    { Msg::since } -> std::convertible_to<protocol_version>;
+};
+} // namespace
+
+/// Version of interface in which message Msg was introduced.
+///
+/// Generated messages define since and messages without it are assumed to be in the first version.
+template<typename Msg>
+inline constexpr protocol_version message_since = 1;
+
+template<message_with_since Msg>
+inline constexpr protocol_version message_since<Msg> = Msg::since;
+
+/// Message Msg is part of interface version Version, i.e. it can be sent to or by such object.
+template<typename Msg, protocol_version Version>
+concept message_available_at = Version == any_version or message_since<Msg> <= Version;
+
+/// Message Msg is deprecated in interface version Version.
+template<typename Msg, protocol_version Version>
+concept message_deprecated_at = Version != any_version and requires {
+    requires Msg::deprecated_since <= Version;
+};
+
+/// List of message types, where index of a message is its opcode.
+///
+/// Generated protocol headers define request_list and event_list for each interface.
+template<typename... Messages>
+struct message_list {
+    static constexpr auto size = sizeof...(Messages);
+};
+
+/// Name and type of a message argument, see message_info.
+struct argument_info {
+    std::u8string_view name;
+    /// Type in the notation of libwayland message signatures: i, u, f, s, o, n, a or h.
+    char8_t type;
+    /// Interface of object and new_id arguments, empty if any interface is allowed.
+    std::u8string_view interface{};
+};
+
+/// Name and signature of a message, for printing messages whose type is known only at runtime.
+///
+/// Generated protocol headers define request_infos and event_infos indexed by opcode
+/// for each interface.
+struct message_info {
+    std::u8string_view name;
+    /// Types of the arguments, e.g. "usun" for wl_registry::bind.
+    std::u8string_view signature;
+    std::span<const argument_info> arguments;
+};
+
+/// Name, version and messages of an interface.
+///
+/// Generated protocol headers define <protocol>_interfaces array of these.
+struct interface_info {
+    std::u8string_view name;
+    protocol_version version;
+    std::span<const message_info> requests;
+    std::span<const message_info> events;
+};
+
+template<interface W>
+inline constexpr auto interface_info_of =
+    interface_info{ W::name, W::version, W::request_infos, W::event_infos };
+
+/// Address of interface_info_of<W> or nullptr if W has no generated metadata, e.g. generic_object.
+template<interface W>
+inline constexpr auto interface_info_if_known = [] -> const interface_info* {
+    if constexpr (requires {
+                      W::request_infos;
+                      W::event_infos;
+                  }) {
+        return &interface_info_of<W>;
+    } else {
+        return nullptr;
+    }
+}();
+
+namespace {
+template<typename>
+struct data_member_pointer_traits;
+template<typename T, typename C>
+struct data_member_pointer_traits<T C::*> {
+    using member_type = T;
+};
+
+template<auto Member>
+using data_member_t = typename data_member_pointer_traits<decltype(Member)>::member_type;
+
+template<auto Lhs, auto Rhs>
+consteval bool is_same_data_member() {
+    if constexpr (std::same_as<decltype(Lhs), decltype(Rhs)>) {
+        return Lhs == Rhs;
+    } else {
+        return false;
+    }
+}
+} // namespace
+
+/// List of the arguments of a message as pointers to its data members in wire order.
+///
+/// Generated protocol headers define fields for each message, so the arguments
+/// do not have to be found by probing the arity of the message aggregate.
+template<auto... Members>
+struct message_fields {
+    static constexpr auto size = sizeof...(Members);
+
+    using types = std::tuple<data_member_t<Members>...>;
+
+    /// Index of data member pointer Member in wire order or size if it is not one of Members.
+    template<auto Member>
+    static constexpr auto index_of = [] {
+        // Extra element at the end, so the array is never empty.
+        constexpr bool is_member[] = { is_same_data_member<Member, Members>()..., false };
+        auto index                 = 0uz;
+        while (index < size and not is_member[index]) { ++index; }
+        return index;
+    }();
+
+    /// Arguments of \p msg as tuple of const references.
+    template<typename Msg>
+    [[nodiscard]] static constexpr auto tie(const Msg& msg) noexcept {
+        return std::tie(msg.*Members...);
+    }
+};
+
+namespace {
+/// Wfixed is left out, as its value is not the number it represents.
 template<typename T>
-concept has_integral_value = requires(T t) {
+concept has_integral_value = not std::same_as<T, Wfixed> and requires(T t) {
     { auto{ t.value } } -> std::integral;
 };
 
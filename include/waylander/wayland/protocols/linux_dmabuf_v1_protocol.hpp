@@ -35,6 +35,9 @@ namespace protocols {
 /// Declare everything before they might be used.
 
 struct zwp_linux_dmabuf_v1 {
+    static constexpr std::u8string_view name{ u8"zwp_linux_dmabuf_v1" };
+    static constexpr protocol_version version{ 5 };
+
     struct request {
         struct destroy;
         struct create_params;
@@ -46,8 +49,39 @@ struct zwp_linux_dmabuf_v1 {
         struct format;
         struct modifier;
     };
+
+    using request_list = message_list<request::destroy,
+                                      request::create_params,
+                                      request::get_default_feedback,
+                                      request::get_surface_feedback>;
+    using event_list   = message_list<event::format, event::modifier>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 8>{ {
+        { u8"params_id", u8'n', u8"zwp_linux_buffer_params_v1" },
+        { u8"id", u8'n', u8"zwp_linux_dmabuf_feedback_v1" },
+        { u8"id", u8'n', u8"zwp_linux_dmabuf_feedback_v1" },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"format", u8'u' },
+        { u8"format", u8'u' },
+        { u8"modifier_hi", u8'u' },
+        { u8"modifier_lo", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 4>{ {
+        { u8"destroy", u8"", {} },
+        { u8"create_params", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"get_default_feedback", u8"n", std::span{ message_arguments }.subspan(1, 1) },
+        { u8"get_surface_feedback", u8"no", std::span{ message_arguments }.subspan(2, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 2>{ {
+        { u8"format", u8"u", std::span{ message_arguments }.subspan(4, 1) },
+        { u8"modifier", u8"uuu", std::span{ message_arguments }.subspan(5, 3) },
+    } };
 };
 struct zwp_linux_buffer_params_v1 {
+    static constexpr std::u8string_view name{ u8"zwp_linux_buffer_params_v1" };
+    static constexpr protocol_version version{ 5 };
+
     enum class error : Wint::integral_type;
     enum class flags : Wuint::integral_type;
 
@@ -62,8 +96,47 @@ struct zwp_linux_buffer_params_v1 {
         struct created;
         struct failed;
     };
+
+    using request_list = message_list<request::destroy,
+                                      request::add,
+                                      request::create,
+                                      request::create_immed>;
+    using event_list   = message_list<event::created, event::failed>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 16>{ {
+        { u8"fd", u8'h' },
+        { u8"plane_idx", u8'u' },
+        { u8"offset", u8'u' },
+        { u8"stride", u8'u' },
+        { u8"modifier_hi", u8'u' },
+        { u8"modifier_lo", u8'u' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"format", u8'u' },
+        { u8"flags", u8'u' },
+        { u8"buffer_id", u8'n', u8"wl_buffer" },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"format", u8'u' },
+        { u8"flags", u8'u' },
+        { u8"buffer", u8'n', u8"wl_buffer" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 4>{ {
+        { u8"destroy", u8"", {} },
+        { u8"add", u8"huuuuu", std::span{ message_arguments }.subspan(0, 6) },
+        { u8"create", u8"iiuu", std::span{ message_arguments }.subspan(6, 4) },
+        { u8"create_immed", u8"niiuu", std::span{ message_arguments }.subspan(10, 5) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 2>{ {
+        { u8"created", u8"n", std::span{ message_arguments }.subspan(15, 1) },
+        { u8"failed", u8"", {} },
+    } };
 };
 struct zwp_linux_dmabuf_feedback_v1 {
+    static constexpr std::u8string_view name{ u8"zwp_linux_dmabuf_feedback_v1" };
+    static constexpr protocol_version version{ 5 };
+
     enum class tranche_flags : Wuint::integral_type;
 
     struct request {
@@ -79,6 +152,37 @@ struct zwp_linux_dmabuf_feedback_v1 {
         struct tranche_formats;
         struct tranche_flags;
     };
+
+    using request_list = message_list<request::destroy>;
+    using event_list   = message_list<event::done,
+                                      event::format_table,
+                                      event::main_device,
+                                      event::tranche_done,
+                                      event::tranche_target_device,
+                                      event::tranche_formats,
+                                      event::tranche_flags>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 6>{ {
+        { u8"fd", u8'h' },
+        { u8"size", u8'u' },
+        { u8"device", u8'a' },
+        { u8"device", u8'a' },
+        { u8"indices", u8'a' },
+        { u8"flags", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 7>{ {
+        { u8"done", u8"", {} },
+        { u8"format_table", u8"hu", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"main_device", u8"a", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"tranche_done", u8"", {} },
+        { u8"tranche_target_device", u8"a", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"tranche_formats", u8"a", std::span{ message_arguments }.subspan(4, 1) },
+        { u8"tranche_flags", u8"u", std::span{ message_arguments }.subspan(5, 1) },
+    } };
 };
 /// unbind the factory
 ///
@@ -86,6 +190,9 @@ struct zwp_linux_dmabuf_feedback_v1 {
 /// remain valid.
 struct zwp_linux_dmabuf_v1::request::destroy {
     static constexpr Wopcode<zwp_linux_dmabuf_v1> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// create a temporary object for buffer parameters
@@ -96,8 +203,11 @@ struct zwp_linux_dmabuf_v1::request::destroy {
 /// received.
 struct zwp_linux_dmabuf_v1::request::create_params {
     static constexpr Wopcode<zwp_linux_dmabuf_v1> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the new temporary
     Wnew_id<zwp_linux_buffer_params_v1> params_id;
+
+    using fields = message_fields<&zwp_linux_dmabuf_v1::request::create_params::params_id>;
 };
 
 /// get default feedback
@@ -108,7 +218,10 @@ struct zwp_linux_dmabuf_v1::request::create_params {
 /// (see get_surface_feedback).
 struct zwp_linux_dmabuf_v1::request::get_default_feedback {
     static constexpr Wopcode<zwp_linux_dmabuf_v1> opcode{ 2 };
+    static constexpr protocol_version since{ 4 };
     Wnew_id<zwp_linux_dmabuf_feedback_v1> id;
+
+    using fields = message_fields<&zwp_linux_dmabuf_v1::request::get_default_feedback::id>;
 };
 
 /// get feedback for a surface
@@ -121,8 +234,12 @@ struct zwp_linux_dmabuf_v1::request::get_default_feedback {
 /// the feedback object becomes inert.
 struct zwp_linux_dmabuf_v1::request::get_surface_feedback {
     static constexpr Wopcode<zwp_linux_dmabuf_v1> opcode{ 3 };
+    static constexpr protocol_version since{ 4 };
     Wnew_id<zwp_linux_dmabuf_feedback_v1> id;
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&zwp_linux_dmabuf_v1::request::get_surface_feedback::id,
+                                  &zwp_linux_dmabuf_v1::request::get_surface_feedback::surface>;
 };
 
 /// supported buffer format
@@ -140,8 +257,11 @@ struct zwp_linux_dmabuf_v1::request::get_surface_feedback {
 /// get_surface_feedback.
 struct zwp_linux_dmabuf_v1::event::format {
     static constexpr Wopcode<zwp_linux_dmabuf_v1> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// DRM_FORMAT code
     Wuint format;
+
+    using fields = message_fields<&zwp_linux_dmabuf_v1::event::format::format>;
 };
 
 /// supported buffer format modifier
@@ -171,12 +291,17 @@ struct zwp_linux_dmabuf_v1::event::format {
 /// get_surface_feedback.
 struct zwp_linux_dmabuf_v1::event::modifier {
     static constexpr Wopcode<zwp_linux_dmabuf_v1> opcode{ 1 };
+    static constexpr protocol_version since{ 3 };
     /// DRM_FORMAT code
     Wuint format;
     /// high 32 bits of layout modifier
     Wuint modifier_hi;
     /// low 32 bits of layout modifier
     Wuint modifier_lo;
+
+    using fields = message_fields<&zwp_linux_dmabuf_v1::event::modifier::format,
+                                  &zwp_linux_dmabuf_v1::event::modifier::modifier_hi,
+                                  &zwp_linux_dmabuf_v1::event::modifier::modifier_lo>;
 };
 
 enum class zwp_linux_buffer_params_v1::error : Wint::integral_type {
@@ -213,6 +338,9 @@ enum class zwp_linux_buffer_params_v1::flags : Wuint::integral_type {
 /// wl_buffer creation.
 struct zwp_linux_buffer_params_v1::request::destroy {
     static constexpr Wopcode<zwp_linux_buffer_params_v1> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// add a dmabuf to the temporary set
@@ -238,6 +366,7 @@ struct zwp_linux_buffer_params_v1::request::destroy {
 /// was already set.
 struct zwp_linux_buffer_params_v1::request::add {
     static constexpr Wopcode<zwp_linux_buffer_params_v1> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// dmabuf fd
     Wfd fd;
     /// plane index
@@ -250,6 +379,13 @@ struct zwp_linux_buffer_params_v1::request::add {
     Wuint modifier_hi;
     /// low 32 bits of layout modifier
     Wuint modifier_lo;
+
+    using fields = message_fields<&zwp_linux_buffer_params_v1::request::add::fd,
+                                  &zwp_linux_buffer_params_v1::request::add::plane_idx,
+                                  &zwp_linux_buffer_params_v1::request::add::offset,
+                                  &zwp_linux_buffer_params_v1::request::add::stride,
+                                  &zwp_linux_buffer_params_v1::request::add::modifier_hi,
+                                  &zwp_linux_buffer_params_v1::request::add::modifier_lo>;
 };
 
 /// create a wl_buffer from the given dmabufs
@@ -315,6 +451,7 @@ struct zwp_linux_buffer_params_v1::request::add {
 /// cancel the buffer creation, it can just destroy this object.
 struct zwp_linux_buffer_params_v1::request::create {
     static constexpr Wopcode<zwp_linux_buffer_params_v1> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// base plane width in pixels
     Wint width;
     /// base plane height in pixels
@@ -323,6 +460,11 @@ struct zwp_linux_buffer_params_v1::request::create {
     Wuint format;
     /// see enum flags
     zwp_linux_buffer_params_v1::flags flags;
+
+    using fields = message_fields<&zwp_linux_buffer_params_v1::request::create::width,
+                                  &zwp_linux_buffer_params_v1::request::create::height,
+                                  &zwp_linux_buffer_params_v1::request::create::format,
+                                  &zwp_linux_buffer_params_v1::request::create::flags>;
 };
 
 /// immediately create a wl_buffer from the given                      dmabufs
@@ -352,6 +494,7 @@ struct zwp_linux_buffer_params_v1::request::create {
 /// same restrictions.
 struct zwp_linux_buffer_params_v1::request::create_immed {
     static constexpr Wopcode<zwp_linux_buffer_params_v1> opcode{ 3 };
+    static constexpr protocol_version since{ 2 };
     /// id for the newly created wl_buffer
     Wnew_id<wl_buffer> buffer_id;
     /// base plane width in pixels
@@ -362,6 +505,12 @@ struct zwp_linux_buffer_params_v1::request::create_immed {
     Wuint format;
     /// see enum flags
     zwp_linux_buffer_params_v1::flags flags;
+
+    using fields = message_fields<&zwp_linux_buffer_params_v1::request::create_immed::buffer_id,
+                                  &zwp_linux_buffer_params_v1::request::create_immed::width,
+                                  &zwp_linux_buffer_params_v1::request::create_immed::height,
+                                  &zwp_linux_buffer_params_v1::request::create_immed::format,
+                                  &zwp_linux_buffer_params_v1::request::create_immed::flags>;
 };
 
 /// buffer creation succeeded
@@ -373,8 +522,11 @@ struct zwp_linux_buffer_params_v1::request::create_immed {
 /// zwp_linux_buffer_params_v1 object.
 struct zwp_linux_buffer_params_v1::event::created {
     static constexpr Wopcode<zwp_linux_buffer_params_v1> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the newly created wl_buffer
     Wnew_id<wl_buffer> buffer;
+
+    using fields = message_fields<&zwp_linux_buffer_params_v1::event::created::buffer>;
 };
 
 /// buffer creation failed
@@ -387,6 +539,9 @@ struct zwp_linux_buffer_params_v1::event::created {
 /// zwp_linux_buffer_params_v1 object.
 struct zwp_linux_buffer_params_v1::event::failed {
     static constexpr Wopcode<zwp_linux_buffer_params_v1> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 enum class zwp_linux_dmabuf_feedback_v1::tranche_flags : Wuint::integral_type {
@@ -400,6 +555,9 @@ enum class zwp_linux_dmabuf_feedback_v1::tranche_flags : Wuint::integral_type {
 /// use the wp_linux_dmabuf_feedback object anymore.
 struct zwp_linux_dmabuf_feedback_v1::request::destroy {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// all feedback has been sent
@@ -411,6 +569,9 @@ struct zwp_linux_dmabuf_feedback_v1::request::destroy {
 /// seen as atomic, even if they happen via multiple events.
 struct zwp_linux_dmabuf_feedback_v1::event::done {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// format and modifier table
@@ -431,10 +592,14 @@ struct zwp_linux_dmabuf_feedback_v1::event::done {
 /// store duplicate format + modifier pairs in the table.
 struct zwp_linux_dmabuf_feedback_v1::event::format_table {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// table file descriptor
     Wfd fd;
     /// table size, in bytes
     Wuint size;
+
+    using fields = message_fields<&zwp_linux_dmabuf_feedback_v1::event::format_table::fd,
+                                  &zwp_linux_dmabuf_feedback_v1::event::format_table::size>;
 };
 
 /// preferred main device
@@ -464,8 +629,11 @@ struct zwp_linux_dmabuf_feedback_v1::event::format_table {
 /// must force the buffer to have a linear layout.
 struct zwp_linux_dmabuf_feedback_v1::event::main_device {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// device dev_t value
     Warray device;
+
+    using fields = message_fields<&zwp_linux_dmabuf_feedback_v1::event::main_device::device>;
 };
 
 /// a preference tranche has been sent
@@ -476,6 +644,9 @@ struct zwp_linux_dmabuf_feedback_v1::event::main_device {
 /// next tranche will have a lower preference.
 struct zwp_linux_dmabuf_feedback_v1::event::tranche_done {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// target device
@@ -508,8 +679,12 @@ struct zwp_linux_dmabuf_feedback_v1::event::tranche_done {
 /// This event is tied to a preference tranche, see the tranche_done event.
 struct zwp_linux_dmabuf_feedback_v1::event::tranche_target_device {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// device dev_t value
     Warray device;
+
+    using fields =
+        message_fields<&zwp_linux_dmabuf_feedback_v1::event::tranche_target_device::device>;
 };
 
 /// supported buffer format modifier
@@ -540,8 +715,11 @@ struct zwp_linux_dmabuf_feedback_v1::event::tranche_target_device {
 /// wp_linux_buffer_params.create request.
 struct zwp_linux_dmabuf_feedback_v1::event::tranche_formats {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// array of 16-bit indexes
     Warray indices;
+
+    using fields = message_fields<&zwp_linux_dmabuf_feedback_v1::event::tranche_formats::indices>;
 };
 
 /// tranche flags
@@ -556,10 +734,141 @@ struct zwp_linux_dmabuf_feedback_v1::event::tranche_formats {
 /// This event is tied to a preference tranche, see the tranche_done event.
 struct zwp_linux_dmabuf_feedback_v1::event::tranche_flags {
     static constexpr Wopcode<zwp_linux_dmabuf_feedback_v1> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
     /// tranche flags
     zwp_linux_dmabuf_feedback_v1::tranche_flags flags;
+
+    using fields = message_fields<&zwp_linux_dmabuf_feedback_v1::event::tranche_flags::flags>;
+};
+
+/// Metadata of the interfaces of the protocol, see interface_info.
+inline constexpr auto linux_dmabuf_v1_interfaces = std::array{
+    interface_info_of<zwp_linux_dmabuf_v1>,
+    interface_info_of<zwp_linux_buffer_params_v1>,
+    interface_info_of<zwp_linux_dmabuf_feedback_v1>,
 };
 
 } // namespace protocols
 } // namespace wl
 } // namespace waylander
+
+#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS
+// Instantiated in the library, see meson option explicit_instantiations.
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+
+namespace waylander {
+namespace wl {
+
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_linux_dmabuf_v1>,
+                                    const protocols::zwp_linux_dmabuf_v1::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_linux_dmabuf_v1>,
+                                    const protocols::zwp_linux_dmabuf_v1::request::create_params&);
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_linux_dmabuf_v1>,
+               const protocols::zwp_linux_dmabuf_v1::request::get_default_feedback&);
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_linux_dmabuf_v1>,
+               const protocols::zwp_linux_dmabuf_v1::request::get_surface_feedback&);
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::format, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::format;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::format, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::format;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::modifier, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::modifier;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::modifier, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::modifier;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_linux_buffer_params_v1>,
+                                    const protocols::zwp_linux_buffer_params_v1::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_linux_buffer_params_v1>,
+                                    const protocols::zwp_linux_buffer_params_v1::request::add&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_linux_buffer_params_v1>,
+                                    const protocols::zwp_linux_buffer_params_v1::request::create&);
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_linux_buffer_params_v1>,
+               const protocols::zwp_linux_buffer_params_v1::request::create_immed&);
+extern template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::created,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::created;
+extern template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::created,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::created;
+extern template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::failed,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::failed;
+extern template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::failed,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::failed;
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_linux_dmabuf_feedback_v1>,
+               const protocols::zwp_linux_dmabuf_feedback_v1::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::done,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::done,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::main_device,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::main_device;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::main_device,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::main_device;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags;
+extern template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags;
+
+} // namespace wl
+} // namespace waylander
+#endif
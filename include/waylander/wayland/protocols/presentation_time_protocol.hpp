@@ -35,6 +35,9 @@ namespace protocols {
 /// Declare everything before they might be used.
 
 struct wp_presentation {
+    static constexpr std::u8string_view name{ u8"wp_presentation" };
+    static constexpr protocol_version version{ 2 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -45,8 +48,28 @@ struct wp_presentation {
     struct event {
         struct clock_id;
     };
+
+    using request_list = message_list<request::destroy, request::feedback>;
+    using event_list   = message_list<event::clock_id>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 3>{ {
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"callback", u8'n', u8"wp_presentation_feedback" },
+        { u8"clk_id", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"destroy", u8"", {} },
+        { u8"feedback", u8"on", std::span{ message_arguments }.subspan(0, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 1>{ {
+        { u8"clock_id", u8"u", std::span{ message_arguments }.subspan(2, 1) },
+    } };
 };
 struct wp_presentation_feedback {
+    static constexpr std::u8string_view name{ u8"wp_presentation_feedback" };
+    static constexpr protocol_version version{ 2 };
+
     enum class kind : Wuint::integral_type;
 
     struct request {};
@@ -56,6 +79,27 @@ struct wp_presentation_feedback {
         struct presented;
         struct discarded;
     };
+
+    using request_list = message_list<>;
+    using event_list   = message_list<event::sync_output, event::presented, event::discarded>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 8>{ {
+        { u8"output", u8'o', u8"wl_output" },
+        { u8"tv_sec_hi", u8'u' },
+        { u8"tv_sec_lo", u8'u' },
+        { u8"tv_nsec", u8'u' },
+        { u8"refresh", u8'u' },
+        { u8"seq_hi", u8'u' },
+        { u8"seq_lo", u8'u' },
+        { u8"flags", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 0>{};
+    static constexpr auto event_infos = std::array<message_info, 3>{ {
+        { u8"sync_output", u8"o", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"presented", u8"uuuuuuu", std::span{ message_arguments }.subspan(1, 7) },
+        { u8"discarded", u8"", {} },
+    } };
 };
 /// fatal presentation errors
 ///
@@ -75,6 +119,9 @@ enum class wp_presentation::error : Wint::integral_type {
 /// are not affected.
 struct wp_presentation::request::destroy {
     static constexpr Wopcode<wp_presentation> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// request presentation feedback information
@@ -89,10 +136,14 @@ struct wp_presentation::request::destroy {
 /// presentation_feedback interface.
 struct wp_presentation::request::feedback {
     static constexpr Wopcode<wp_presentation> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// target surface
     Wobject<wl_surface> surface;
     /// new feedback object
     Wnew_id<wp_presentation_feedback> callback;
+
+    using fields = message_fields<&wp_presentation::request::feedback::surface,
+                                  &wp_presentation::request::feedback::callback>;
 };
 
 /// clock ID for timestamps
@@ -127,8 +178,11 @@ struct wp_presentation::request::feedback {
 /// value directly, not by asking the compositor.
 struct wp_presentation::event::clock_id {
     static constexpr Wopcode<wp_presentation> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// platform clock identifier
     Wuint clk_id;
+
+    using fields = message_fields<&wp_presentation::event::clock_id::clk_id>;
 };
 
 /// bitmask of flags in presented event
@@ -187,8 +241,11 @@ enum class wp_presentation_feedback::kind : Wuint::integral_type {
 /// right wl_output global at all, this event is not sent.
 struct wp_presentation_feedback::event::sync_output {
     static constexpr Wopcode<wp_presentation_feedback> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// presentation output
     Wobject<wl_output> output;
+
+    using fields = message_fields<&wp_presentation_feedback::event::sync_output::output>;
 };
 
 /// the content update was displayed
@@ -239,6 +296,7 @@ struct wp_presentation_feedback::event::sync_output {
 /// and seq_lo must be zero.
 struct wp_presentation_feedback::event::presented {
     static constexpr Wopcode<wp_presentation_feedback> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// high 32 bits of the seconds part of the presentation timestamp
     Wuint tv_sec_hi;
     /// low 32 bits of the seconds part of the presentation timestamp
@@ -253,6 +311,14 @@ struct wp_presentation_feedback::event::presented {
     Wuint seq_lo;
     /// combination of 'kind' values
     wp_presentation_feedback::kind flags;
+
+    using fields = message_fields<&wp_presentation_feedback::event::presented::tv_sec_hi,
+                                  &wp_presentation_feedback::event::presented::tv_sec_lo,
+                                  &wp_presentation_feedback::event::presented::tv_nsec,
+                                  &wp_presentation_feedback::event::presented::refresh,
+                                  &wp_presentation_feedback::event::presented::seq_hi,
+                                  &wp_presentation_feedback::event::presented::seq_lo,
+                                  &wp_presentation_feedback::event::presented::flags>;
 };
 
 /// the content update was not displayed
@@ -260,8 +326,67 @@ struct wp_presentation_feedback::event::presented {
 /// The content update was never displayed to the user.
 struct wp_presentation_feedback::event::discarded {
     static constexpr Wopcode<wp_presentation_feedback> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
+};
+
+/// Metadata of the interfaces of the protocol, see interface_info.
+inline constexpr auto presentation_time_interfaces = std::array{
+    interface_info_of<wp_presentation>,
+    interface_info_of<wp_presentation_feedback>,
 };
 
 } // namespace protocols
 } // namespace wl
 } // namespace waylander
+
+#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS
+// Instantiated in the library, see meson option explicit_instantiations.
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+
+namespace waylander {
+namespace wl {
+
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_presentation>,
+                                    const protocols::wp_presentation::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_presentation>,
+                                    const protocols::wp_presentation::request::feedback&);
+extern template auto
+decode_message_payload<protocols::wp_presentation::event::clock_id, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wp_presentation::event::clock_id;
+extern template auto
+decode_message_payload<protocols::wp_presentation::event::clock_id, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wp_presentation::event::clock_id;
+extern template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::sync_output,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::sync_output;
+extern template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::sync_output,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::sync_output;
+extern template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::presented,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::presented;
+extern template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::presented,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::presented;
+extern template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::discarded,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::discarded;
+extern template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::discarded,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::discarded;
+
+} // namespace wl
+} // namespace waylander
+#endif
@@ -115,14 +115,34 @@ namespace protocols {
 /// Declare everything before they might be used.
 
 struct zwp_tablet_manager_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_manager_v2" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct get_tablet_seat;
         struct destroy;
     };
 
     struct event {};
+
+    using request_list = message_list<request::get_tablet_seat, request::destroy>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 2>{ {
+        { u8"tablet_seat", u8'n', u8"zwp_tablet_seat_v2" },
+        { u8"seat", u8'o', u8"wl_seat" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"get_tablet_seat", u8"no", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct zwp_tablet_seat_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_seat_v2" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct destroy;
     };
@@ -132,8 +152,29 @@ struct zwp_tablet_seat_v2 {
         struct tool_added;
         struct pad_added;
     };
+
+    using request_list = message_list<request::destroy>;
+    using event_list   = message_list<event::tablet_added, event::tool_added, event::pad_added>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 3>{ {
+        { u8"id", u8'n', u8"zwp_tablet_v2" },
+        { u8"id", u8'n', u8"zwp_tablet_tool_v2" },
+        { u8"id", u8'n', u8"zwp_tablet_pad_v2" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 3>{ {
+        { u8"tablet_added", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"tool_added", u8"n", std::span{ message_arguments }.subspan(1, 1) },
+        { u8"pad_added", u8"n", std::span{ message_arguments }.subspan(2, 1) },
+    } };
 };
 struct zwp_tablet_tool_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_tool_v2" };
+    static constexpr protocol_version version{ 1 };
+
     enum class type : Wint::integral_type;
     enum class capability : Wint::integral_type;
     enum class button_state : Wint::integral_type;
@@ -165,8 +206,89 @@ struct zwp_tablet_tool_v2 {
         struct button;
         struct frame;
     };
+
+    using request_list = message_list<request::set_cursor, request::destroy>;
+    using event_list   = message_list<event::type,
+                                      event::hardware_serial,
+                                      event::hardware_id_wacom,
+                                      event::capability,
+                                      event::done,
+                                      event::removed,
+                                      event::proximity_in,
+                                      event::proximity_out,
+                                      event::down,
+                                      event::up,
+                                      event::motion,
+                                      event::pressure,
+                                      event::distance,
+                                      event::tilt,
+                                      event::rotation,
+                                      event::slider,
+                                      event::wheel,
+                                      event::button,
+                                      event::frame>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 28>{ {
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"hotspot_x", u8'i' },
+        { u8"hotspot_y", u8'i' },
+        { u8"tool_type", u8'i' },
+        { u8"hardware_serial_hi", u8'u' },
+        { u8"hardware_serial_lo", u8'u' },
+        { u8"hardware_id_hi", u8'u' },
+        { u8"hardware_id_lo", u8'u' },
+        { u8"capability", u8'i' },
+        { u8"serial", u8'u' },
+        { u8"tablet", u8'o', u8"zwp_tablet_v2" },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"serial", u8'u' },
+        { u8"x", u8'f' },
+        { u8"y", u8'f' },
+        { u8"pressure", u8'u' },
+        { u8"distance", u8'u' },
+        { u8"tilt_x", u8'f' },
+        { u8"tilt_y", u8'f' },
+        { u8"degrees", u8'f' },
+        { u8"position", u8'i' },
+        { u8"degrees", u8'f' },
+        { u8"clicks", u8'i' },
+        { u8"serial", u8'u' },
+        { u8"button", u8'u' },
+        { u8"state", u8'i' },
+        { u8"time", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"set_cursor", u8"uoii", std::span{ message_arguments }.subspan(0, 4) },
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 19>{ {
+        { u8"type", u8"i", std::span{ message_arguments }.subspan(4, 1) },
+        { u8"hardware_serial", u8"uu", std::span{ message_arguments }.subspan(5, 2) },
+        { u8"hardware_id_wacom", u8"uu", std::span{ message_arguments }.subspan(7, 2) },
+        { u8"capability", u8"i", std::span{ message_arguments }.subspan(9, 1) },
+        { u8"done", u8"", {} },
+        { u8"removed", u8"", {} },
+        { u8"proximity_in", u8"uoo", std::span{ message_arguments }.subspan(10, 3) },
+        { u8"proximity_out", u8"", {} },
+        { u8"down", u8"u", std::span{ message_arguments }.subspan(13, 1) },
+        { u8"up", u8"", {} },
+        { u8"motion", u8"ff", std::span{ message_arguments }.subspan(14, 2) },
+        { u8"pressure", u8"u", std::span{ message_arguments }.subspan(16, 1) },
+        { u8"distance", u8"u", std::span{ message_arguments }.subspan(17, 1) },
+        { u8"tilt", u8"ff", std::span{ message_arguments }.subspan(18, 2) },
+        { u8"rotation", u8"f", std::span{ message_arguments }.subspan(20, 1) },
+        { u8"slider", u8"i", std::span{ message_arguments }.subspan(21, 1) },
+        { u8"wheel", u8"fi", std::span{ message_arguments }.subspan(22, 2) },
+        { u8"button", u8"uui", std::span{ message_arguments }.subspan(24, 3) },
+        { u8"frame", u8"u", std::span{ message_arguments }.subspan(27, 1) },
+    } };
 };
 struct zwp_tablet_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_v2" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct destroy;
     };
@@ -178,8 +300,36 @@ struct zwp_tablet_v2 {
         struct done;
         struct removed;
     };
+
+    using request_list = message_list<request::destroy>;
+    using event_list   = message_list<event::name,
+                                      event::id,
+                                      event::path,
+                                      event::done,
+                                      event::removed>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 4>{ {
+        { u8"name", u8's' },
+        { u8"vid", u8'u' },
+        { u8"pid", u8'u' },
+        { u8"path", u8's' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 5>{ {
+        { u8"name", u8"s", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"id", u8"uu", std::span{ message_arguments }.subspan(1, 2) },
+        { u8"path", u8"s", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"done", u8"", {} },
+        { u8"removed", u8"", {} },
+    } };
 };
 struct zwp_tablet_pad_ring_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_pad_ring_v2" };
+    static constexpr protocol_version version{ 1 };
+
     enum class source : Wint::integral_type;
 
     struct request {
@@ -193,8 +343,33 @@ struct zwp_tablet_pad_ring_v2 {
         struct stop;
         struct frame;
     };
+
+    using request_list = message_list<request::set_feedback, request::destroy>;
+    using event_list   = message_list<event::source, event::angle, event::stop, event::frame>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 5>{ {
+        { u8"description", u8's' },
+        { u8"serial", u8'u' },
+        { u8"source", u8'i' },
+        { u8"degrees", u8'f' },
+        { u8"time", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"set_feedback", u8"su", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 4>{ {
+        { u8"source", u8"i", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"angle", u8"f", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"stop", u8"", {} },
+        { u8"frame", u8"u", std::span{ message_arguments }.subspan(4, 1) },
+    } };
 };
 struct zwp_tablet_pad_strip_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_pad_strip_v2" };
+    static constexpr protocol_version version{ 1 };
+
     enum class source : Wint::integral_type;
 
     struct request {
@@ -208,8 +383,33 @@ struct zwp_tablet_pad_strip_v2 {
         struct stop;
         struct frame;
     };
+
+    using request_list = message_list<request::set_feedback, request::destroy>;
+    using event_list   = message_list<event::source, event::position, event::stop, event::frame>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 5>{ {
+        { u8"description", u8's' },
+        { u8"serial", u8'u' },
+        { u8"source", u8'i' },
+        { u8"position", u8'u' },
+        { u8"time", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"set_feedback", u8"su", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 4>{ {
+        { u8"source", u8"i", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"position", u8"u", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"stop", u8"", {} },
+        { u8"frame", u8"u", std::span{ message_arguments }.subspan(4, 1) },
+    } };
 };
 struct zwp_tablet_pad_group_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_pad_group_v2" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct destroy;
     };
@@ -222,8 +422,41 @@ struct zwp_tablet_pad_group_v2 {
         struct done;
         struct mode_switch;
     };
+
+    using request_list = message_list<request::destroy>;
+    using event_list   = message_list<event::buttons,
+                                      event::ring,
+                                      event::strip,
+                                      event::modes,
+                                      event::done,
+                                      event::mode_switch>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 7>{ {
+        { u8"buttons", u8'a' },
+        { u8"ring", u8'n', u8"zwp_tablet_pad_ring_v2" },
+        { u8"strip", u8'n', u8"zwp_tablet_pad_strip_v2" },
+        { u8"modes", u8'u' },
+        { u8"time", u8'u' },
+        { u8"serial", u8'u' },
+        { u8"mode", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 6>{ {
+        { u8"buttons", u8"a", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"ring", u8"n", std::span{ message_arguments }.subspan(1, 1) },
+        { u8"strip", u8"n", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"modes", u8"u", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"done", u8"", {} },
+        { u8"mode_switch", u8"uuu", std::span{ message_arguments }.subspan(4, 3) },
+    } };
 };
 struct zwp_tablet_pad_v2 {
+    static constexpr std::u8string_view name{ u8"zwp_tablet_pad_v2" };
+    static constexpr protocol_version version{ 1 };
+
     enum class button_state : Wint::integral_type;
 
     struct request {
@@ -241,6 +474,48 @@ struct zwp_tablet_pad_v2 {
         struct leave;
         struct removed;
     };
+
+    using request_list = message_list<request::set_feedback, request::destroy>;
+    using event_list   = message_list<event::group,
+                                      event::path,
+                                      event::buttons,
+                                      event::done,
+                                      event::button,
+                                      event::enter,
+                                      event::leave,
+                                      event::removed>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 14>{ {
+        { u8"button", u8'u' },
+        { u8"description", u8's' },
+        { u8"serial", u8'u' },
+        { u8"pad_group", u8'n', u8"zwp_tablet_pad_group_v2" },
+        { u8"path", u8's' },
+        { u8"buttons", u8'u' },
+        { u8"time", u8'u' },
+        { u8"button", u8'u' },
+        { u8"state", u8'i' },
+        { u8"serial", u8'u' },
+        { u8"tablet", u8'o', u8"zwp_tablet_v2" },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"set_feedback", u8"usu", std::span{ message_arguments }.subspan(0, 3) },
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 8>{ {
+        { u8"group", u8"n", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"path", u8"s", std::span{ message_arguments }.subspan(4, 1) },
+        { u8"buttons", u8"u", std::span{ message_arguments }.subspan(5, 1) },
+        { u8"done", u8"", {} },
+        { u8"button", u8"uui", std::span{ message_arguments }.subspan(6, 3) },
+        { u8"enter", u8"uoo", std::span{ message_arguments }.subspan(9, 3) },
+        { u8"leave", u8"uo", std::span{ message_arguments }.subspan(12, 2) },
+        { u8"removed", u8"", {} },
+    } };
 };
 /// get the tablet seat
 ///
@@ -248,9 +523,13 @@ struct zwp_tablet_pad_v2 {
 /// provides access to all graphics tablets in this seat.
 struct zwp_tablet_manager_v2::request::get_tablet_seat {
     static constexpr Wopcode<zwp_tablet_manager_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<zwp_tablet_seat_v2> tablet_seat;
     /// The wl_seat object to retrieve the tablets for
     Wobject<wl_seat> seat;
+
+    using fields = message_fields<&zwp_tablet_manager_v2::request::get_tablet_seat::tablet_seat,
+                                  &zwp_tablet_manager_v2::request::get_tablet_seat::seat>;
 };
 
 /// release the memory for the tablet manager object
@@ -259,6 +538,9 @@ struct zwp_tablet_manager_v2::request::get_tablet_seat {
 /// object are unaffected and should be destroyed separately.
 struct zwp_tablet_manager_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_manager_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// release the memory for the tablet seat object
@@ -267,6 +549,9 @@ struct zwp_tablet_manager_v2::request::destroy {
 /// object are unaffected and should be destroyed separately.
 struct zwp_tablet_seat_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_seat_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// new device notification
@@ -277,8 +562,11 @@ struct zwp_tablet_seat_v2::request::destroy {
 /// sent through the wp_tablet interface.
 struct zwp_tablet_seat_v2::event::tablet_added {
     static constexpr Wopcode<zwp_tablet_seat_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the newly added graphics tablet
     Wnew_id<zwp_tablet_v2> id;
+
+    using fields = message_fields<&zwp_tablet_seat_v2::event::tablet_added::id>;
 };
 
 /// a new tool has been used with a tablet
@@ -289,8 +577,11 @@ struct zwp_tablet_seat_v2::event::tablet_added {
 /// type, etc.) is sent through the wp_tablet_tool interface.
 struct zwp_tablet_seat_v2::event::tool_added {
     static constexpr Wopcode<zwp_tablet_seat_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the newly added tablet tool
     Wnew_id<zwp_tablet_tool_v2> id;
+
+    using fields = message_fields<&zwp_tablet_seat_v2::event::tool_added::id>;
 };
 
 /// new pad notification
@@ -307,8 +598,11 @@ struct zwp_tablet_seat_v2::event::tool_added {
 /// interface.
 struct zwp_tablet_seat_v2::event::pad_added {
     static constexpr Wopcode<zwp_tablet_seat_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// the newly added pad
     Wnew_id<zwp_tablet_pad_v2> id;
+
+    using fields = message_fields<&zwp_tablet_seat_v2::event::pad_added::id>;
 };
 
 /// a physical tool type
@@ -411,6 +705,7 @@ enum class zwp_tablet_tool_v2::error : Wint::integral_type {
 /// protocol error is raised.
 struct zwp_tablet_tool_v2::request::set_cursor {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial of the proximity_in event
     Wuint serial;
     Wobject<wl_surface> surface;
@@ -418,6 +713,11 @@ struct zwp_tablet_tool_v2::request::set_cursor {
     Wint hotspot_x;
     /// surface-local y coordinate
     Wint hotspot_y;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::request::set_cursor::serial,
+                                  &zwp_tablet_tool_v2::request::set_cursor::surface,
+                                  &zwp_tablet_tool_v2::request::set_cursor::hotspot_x,
+                                  &zwp_tablet_tool_v2::request::set_cursor::hotspot_y>;
 };
 
 /// destroy the tool object
@@ -425,6 +725,9 @@ struct zwp_tablet_tool_v2::request::set_cursor {
 /// This destroys the client's resource for this tool object.
 struct zwp_tablet_tool_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// tool type
@@ -436,8 +739,11 @@ struct zwp_tablet_tool_v2::request::destroy {
 /// wp_tablet_tool.done event.
 struct zwp_tablet_tool_v2::event::type {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the physical tool type
     zwp_tablet_tool_v2::type tool_type;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::type::tool_type>;
 };
 
 /// unique hardware serial number of the tool
@@ -459,10 +765,14 @@ struct zwp_tablet_tool_v2::event::type {
 /// wp_tablet_tool.done event.
 struct zwp_tablet_tool_v2::event::hardware_serial {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the unique serial number of the tool, most significant bits
     Wuint hardware_serial_hi;
     /// the unique serial number of the tool, least significant bits
     Wuint hardware_serial_lo;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::hardware_serial::hardware_serial_hi,
+                                  &zwp_tablet_tool_v2::event::hardware_serial::hardware_serial_lo>;
 };
 
 /// hardware id notification in Wacom's format
@@ -479,10 +789,14 @@ struct zwp_tablet_tool_v2::event::hardware_serial {
 /// wp_tablet_tool.done event.
 struct zwp_tablet_tool_v2::event::hardware_id_wacom {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// the hardware id, most significant bits
     Wuint hardware_id_hi;
     /// the hardware id, least significant bits
     Wuint hardware_id_lo;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::hardware_id_wacom::hardware_id_hi,
+                                  &zwp_tablet_tool_v2::event::hardware_id_wacom::hardware_id_lo>;
 };
 
 /// tool capability notification
@@ -496,8 +810,11 @@ struct zwp_tablet_tool_v2::event::hardware_id_wacom {
 /// wp_tablet_tool.done event.
 struct zwp_tablet_tool_v2::event::capability {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// the capability
     zwp_tablet_tool_v2::capability capability;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::capability::capability>;
 };
 
 /// tool description events sequence complete
@@ -507,6 +824,9 @@ struct zwp_tablet_tool_v2::event::capability {
 /// be complete and finalize initialization of the tool.
 struct zwp_tablet_tool_v2::event::done {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// tool removed
@@ -527,6 +847,9 @@ struct zwp_tablet_tool_v2::event::done {
 /// the object.
 struct zwp_tablet_tool_v2::event::removed {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// proximity in event
@@ -542,11 +865,16 @@ struct zwp_tablet_tool_v2::event::removed {
 /// within the same frame as the proximity_in event.
 struct zwp_tablet_tool_v2::event::proximity_in {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
     Wuint serial;
     /// The tablet the tool is in proximity of
     Wobject<zwp_tablet_v2> tablet;
     /// The current surface the tablet tool is over
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::proximity_in::serial,
+                                  &zwp_tablet_tool_v2::event::proximity_in::tablet,
+                                  &zwp_tablet_tool_v2::event::proximity_in::surface>;
 };
 
 /// proximity out event
@@ -565,6 +893,9 @@ struct zwp_tablet_tool_v2::event::proximity_in {
 /// proximity of the tablet.
 struct zwp_tablet_tool_v2::event::proximity_out {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 7 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// tablet tool is making contact
@@ -583,7 +914,10 @@ struct zwp_tablet_tool_v2::event::proximity_out {
 /// exceeded.
 struct zwp_tablet_tool_v2::event::down {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 8 };
+    static constexpr protocol_version since{ 1 };
     Wuint serial;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::down::serial>;
 };
 
 /// tablet tool is no longer making contact
@@ -606,6 +940,9 @@ struct zwp_tablet_tool_v2::event::down {
 /// threshold.
 struct zwp_tablet_tool_v2::event::up {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 9 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// motion event
@@ -613,10 +950,14 @@ struct zwp_tablet_tool_v2::event::up {
 /// Sent whenever a tablet tool moves.
 struct zwp_tablet_tool_v2::event::motion {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 10 };
+    static constexpr protocol_version since{ 1 };
     /// surface-local x coordinate
     Wfixed x;
     /// surface-local y coordinate
     Wfixed y;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::motion::x,
+                                  &zwp_tablet_tool_v2::event::motion::y>;
 };
 
 /// pressure change event
@@ -628,8 +969,11 @@ struct zwp_tablet_tool_v2::event::motion {
 /// contact. See the down and up events for more details.
 struct zwp_tablet_tool_v2::event::pressure {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 11 };
+    static constexpr protocol_version since{ 1 };
     /// The current pressure value
     Wuint pressure;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::pressure::pressure>;
 };
 
 /// distance change event
@@ -641,8 +985,11 @@ struct zwp_tablet_tool_v2::event::pressure {
 /// contact. See the down and up events for more details.
 struct zwp_tablet_tool_v2::event::distance {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 12 };
+    static constexpr protocol_version since{ 1 };
     /// The current distance value
     Wuint distance;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::distance::distance>;
 };
 
 /// tilt change event
@@ -653,10 +1000,14 @@ struct zwp_tablet_tool_v2::event::distance {
 /// positive x or y axis.
 struct zwp_tablet_tool_v2::event::tilt {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 13 };
+    static constexpr protocol_version since{ 1 };
     /// The current value of the X tilt axis
     Wfixed tilt_x;
     /// The current value of the Y tilt axis
     Wfixed tilt_y;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::tilt::tilt_x,
+                                  &zwp_tablet_tool_v2::event::tilt::tilt_y>;
 };
 
 /// z-rotation change event
@@ -666,8 +1017,11 @@ struct zwp_tablet_tool_v2::event::tilt {
 /// logical neutral position.
 struct zwp_tablet_tool_v2::event::rotation {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 14 };
+    static constexpr protocol_version since{ 1 };
     /// The current rotation of the Z axis
     Wfixed degrees;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::rotation::degrees>;
 };
 
 /// Slider position change event
@@ -679,8 +1033,11 @@ struct zwp_tablet_tool_v2::event::rotation {
 /// The slider is available on e.g. the Wacom Airbrush tool.
 struct zwp_tablet_tool_v2::event::slider {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 15 };
+    static constexpr protocol_version since{ 1 };
     /// The current position of slider
     Wint position;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::slider::position>;
 };
 
 /// Wheel delta event
@@ -699,10 +1056,14 @@ struct zwp_tablet_tool_v2::event::slider {
 /// have different degrees values.
 struct zwp_tablet_tool_v2::event::wheel {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 16 };
+    static constexpr protocol_version since{ 1 };
     /// The wheel delta in degrees
     Wfixed degrees;
     /// The wheel delta in discrete clicks
     Wint clicks;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::wheel::degrees,
+                                  &zwp_tablet_tool_v2::event::wheel::clicks>;
 };
 
 /// button event
@@ -715,11 +1076,16 @@ struct zwp_tablet_tool_v2::event::wheel {
 /// details.
 struct zwp_tablet_tool_v2::event::button {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 17 };
+    static constexpr protocol_version since{ 1 };
     Wuint serial;
     /// The button whose state has changed
     Wuint button;
     /// Whether the button was pressed or released
     zwp_tablet_tool_v2::button_state state;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::button::serial,
+                                  &zwp_tablet_tool_v2::event::button::button,
+                                  &zwp_tablet_tool_v2::event::button::state>;
 };
 
 /// frame event
@@ -730,8 +1096,11 @@ struct zwp_tablet_tool_v2::event::button {
 /// one hardware event.
 struct zwp_tablet_tool_v2::event::frame {
     static constexpr Wopcode<zwp_tablet_tool_v2> opcode{ 18 };
+    static constexpr protocol_version since{ 1 };
     /// The time of the event with millisecond granularity
     Wuint time;
+
+    using fields = message_fields<&zwp_tablet_tool_v2::event::frame::time>;
 };
 
 /// destroy the tablet object
@@ -739,6 +1108,9 @@ struct zwp_tablet_tool_v2::event::frame {
 /// This destroys the client's resource for this tablet object.
 struct zwp_tablet_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// tablet device name
@@ -751,8 +1123,11 @@ struct zwp_tablet_v2::request::destroy {
 /// wp_tablet.done event.
 struct zwp_tablet_v2::event::name {
     static constexpr Wopcode<zwp_tablet_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the device name
     Wstring name;
+
+    using fields = message_fields<&zwp_tablet_v2::event::name::name>;
 };
 
 /// tablet device USB vendor/product id
@@ -766,10 +1141,13 @@ struct zwp_tablet_v2::event::name {
 /// wp_tablet.done event.
 struct zwp_tablet_v2::event::id {
     static constexpr Wopcode<zwp_tablet_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// USB vendor id
     Wuint vid;
     /// USB product id
     Wuint pid;
+
+    using fields = message_fields<&zwp_tablet_v2::event::id::vid, &zwp_tablet_v2::event::id::pid>;
 };
 
 /// path to the device
@@ -790,8 +1168,11 @@ struct zwp_tablet_v2::event::id {
 /// wp_tablet.done event.
 struct zwp_tablet_v2::event::path {
     static constexpr Wopcode<zwp_tablet_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// path to local device
     Wstring path;
+
+    using fields = message_fields<&zwp_tablet_v2::event::path::path>;
 };
 
 /// tablet description events sequence complete
@@ -802,6 +1183,9 @@ struct zwp_tablet_v2::event::path {
 /// of the tablet.
 struct zwp_tablet_v2::event::done {
     static constexpr Wopcode<zwp_tablet_v2> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// tablet removed event
@@ -813,6 +1197,9 @@ struct zwp_tablet_v2::event::done {
 /// the object.
 struct zwp_tablet_v2::event::removed {
     static constexpr Wopcode<zwp_tablet_v2> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// ring axis source
@@ -849,10 +1236,14 @@ enum class zwp_tablet_pad_ring_v2::source : Wint::integral_type {
 /// ignored.
 struct zwp_tablet_pad_ring_v2::request::set_feedback {
     static constexpr Wopcode<zwp_tablet_pad_ring_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// ring description
     Wstring description;
     /// serial of the mode switch event
     Wuint serial;
+
+    using fields = message_fields<&zwp_tablet_pad_ring_v2::request::set_feedback::description,
+                                  &zwp_tablet_pad_ring_v2::request::set_feedback::serial>;
 };
 
 /// destroy the ring object
@@ -860,6 +1251,9 @@ struct zwp_tablet_pad_ring_v2::request::set_feedback {
 /// This destroys the client's resource for this ring object.
 struct zwp_tablet_pad_ring_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_pad_ring_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// ring event source
@@ -878,8 +1272,11 @@ struct zwp_tablet_pad_ring_v2::request::destroy {
 /// no event is sent.
 struct zwp_tablet_pad_ring_v2::event::source {
     static constexpr Wopcode<zwp_tablet_pad_ring_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the event source
     zwp_tablet_pad_ring_v2::source source;
+
+    using fields = message_fields<&zwp_tablet_pad_ring_v2::event::source::source>;
 };
 
 /// angle changed
@@ -890,8 +1287,11 @@ struct zwp_tablet_pad_ring_v2::event::source {
 /// north of the ring in the pad's current rotation.
 struct zwp_tablet_pad_ring_v2::event::angle {
     static constexpr Wopcode<zwp_tablet_pad_ring_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the current angle in degrees
     Wfixed degrees;
+
+    using fields = message_fields<&zwp_tablet_pad_ring_v2::event::angle::degrees>;
 };
 
 /// interaction stopped
@@ -908,6 +1308,9 @@ struct zwp_tablet_pad_ring_v2::event::angle {
 /// event should be considered as the start of a new interaction.
 struct zwp_tablet_pad_ring_v2::event::stop {
     static constexpr Wopcode<zwp_tablet_pad_ring_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// end of a ring event sequence
@@ -927,8 +1330,11 @@ struct zwp_tablet_pad_ring_v2::event::stop {
 /// angle, frame, etc.
 struct zwp_tablet_pad_ring_v2::event::frame {
     static constexpr Wopcode<zwp_tablet_pad_ring_v2> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// timestamp with millisecond granularity
     Wuint time;
+
+    using fields = message_fields<&zwp_tablet_pad_ring_v2::event::frame::time>;
 };
 
 /// strip axis source
@@ -965,10 +1371,14 @@ enum class zwp_tablet_pad_strip_v2::source : Wint::integral_type {
 /// ignored.
 struct zwp_tablet_pad_strip_v2::request::set_feedback {
     static constexpr Wopcode<zwp_tablet_pad_strip_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// strip description
     Wstring description;
     /// serial of the mode switch event
     Wuint serial;
+
+    using fields = message_fields<&zwp_tablet_pad_strip_v2::request::set_feedback::description,
+                                  &zwp_tablet_pad_strip_v2::request::set_feedback::serial>;
 };
 
 /// destroy the strip object
@@ -976,6 +1386,9 @@ struct zwp_tablet_pad_strip_v2::request::set_feedback {
 /// This destroys the client's resource for this strip object.
 struct zwp_tablet_pad_strip_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_pad_strip_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// strip event source
@@ -994,8 +1407,11 @@ struct zwp_tablet_pad_strip_v2::request::destroy {
 /// no event is sent.
 struct zwp_tablet_pad_strip_v2::event::source {
     static constexpr Wopcode<zwp_tablet_pad_strip_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the event source
     zwp_tablet_pad_strip_v2::source source;
+
+    using fields = message_fields<&zwp_tablet_pad_strip_v2::event::source::source>;
 };
 
 /// position changed
@@ -1007,8 +1423,11 @@ struct zwp_tablet_pad_strip_v2::event::source {
 /// the pad's current rotation.
 struct zwp_tablet_pad_strip_v2::event::position {
     static constexpr Wopcode<zwp_tablet_pad_strip_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the current position
     Wuint position;
+
+    using fields = message_fields<&zwp_tablet_pad_strip_v2::event::position::position>;
 };
 
 /// interaction stopped
@@ -1025,6 +1444,9 @@ struct zwp_tablet_pad_strip_v2::event::position {
 /// event should be considered as the start of a new interaction.
 struct zwp_tablet_pad_strip_v2::event::stop {
     static constexpr Wopcode<zwp_tablet_pad_strip_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// end of a strip event sequence
@@ -1045,8 +1467,11 @@ struct zwp_tablet_pad_strip_v2::event::stop {
 /// position, frame, etc.
 struct zwp_tablet_pad_strip_v2::event::frame {
     static constexpr Wopcode<zwp_tablet_pad_strip_v2> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// timestamp with millisecond granularity
     Wuint time;
+
+    using fields = message_fields<&zwp_tablet_pad_strip_v2::event::frame::time>;
 };
 
 /// destroy the pad object
@@ -1055,6 +1480,9 @@ struct zwp_tablet_pad_strip_v2::event::frame {
 /// are unaffected and should be destroyed separately.
 struct zwp_tablet_pad_group_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// buttons announced
@@ -1073,8 +1501,11 @@ struct zwp_tablet_pad_group_v2::request::destroy {
 /// will be sent with an empty array.
 struct zwp_tablet_pad_group_v2::event::buttons {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// buttons in this group
     Warray buttons;
+
+    using fields = message_fields<&zwp_tablet_pad_group_v2::event::buttons::buttons>;
 };
 
 /// ring announced
@@ -1086,7 +1517,10 @@ struct zwp_tablet_pad_group_v2::event::buttons {
 /// wp_tablet_pad_group.done event.
 struct zwp_tablet_pad_group_v2::event::ring {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<zwp_tablet_pad_ring_v2> ring;
+
+    using fields = message_fields<&zwp_tablet_pad_group_v2::event::ring::ring>;
 };
 
 /// strip announced
@@ -1098,7 +1532,10 @@ struct zwp_tablet_pad_group_v2::event::ring {
 /// wp_tablet_pad_group.done event.
 struct zwp_tablet_pad_group_v2::event::strip {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<zwp_tablet_pad_strip_v2> strip;
+
+    using fields = message_fields<&zwp_tablet_pad_group_v2::event::strip::strip>;
 };
 
 /// mode-switch ability announced
@@ -1117,8 +1554,11 @@ struct zwp_tablet_pad_group_v2::event::strip {
 /// more than one mode is available.
 struct zwp_tablet_pad_group_v2::event::modes {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// the number of modes
     Wuint modes;
+
+    using fields = message_fields<&zwp_tablet_pad_group_v2::event::modes::modes>;
 };
 
 /// tablet group description events sequence complete
@@ -1129,6 +1569,9 @@ struct zwp_tablet_pad_group_v2::event::modes {
 /// of the tablet group.
 struct zwp_tablet_pad_group_v2::event::done {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// mode switch event
@@ -1162,11 +1605,16 @@ struct zwp_tablet_pad_group_v2::event::done {
 /// for each changed ring or strip.
 struct zwp_tablet_pad_group_v2::event::mode_switch {
     static constexpr Wopcode<zwp_tablet_pad_group_v2> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// the time of the event with millisecond granularity
     Wuint time;
     Wuint serial;
     /// the new mode of the pad
     Wuint mode;
+
+    using fields = message_fields<&zwp_tablet_pad_group_v2::event::mode_switch::time,
+                                  &zwp_tablet_pad_group_v2::event::mode_switch::serial,
+                                  &zwp_tablet_pad_group_v2::event::mode_switch::mode>;
 };
 
 /// physical button state
@@ -1208,12 +1656,17 @@ enum class zwp_tablet_pad_v2::button_state : Wint::integral_type {
 /// be ignored.
 struct zwp_tablet_pad_v2::request::set_feedback {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// button index
     Wuint button;
     /// button description
     Wstring description;
     /// serial of the mode switch event
     Wuint serial;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::request::set_feedback::button,
+                                  &zwp_tablet_pad_v2::request::set_feedback::description,
+                                  &zwp_tablet_pad_v2::request::set_feedback::serial>;
 };
 
 /// destroy the pad object
@@ -1222,6 +1675,9 @@ struct zwp_tablet_pad_v2::request::set_feedback {
 /// are unaffected and should be destroyed separately.
 struct zwp_tablet_pad_v2::request::destroy {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// group announced
@@ -1233,7 +1689,10 @@ struct zwp_tablet_pad_v2::request::destroy {
 /// wp_tablet_pad.done event. At least one group will be announced.
 struct zwp_tablet_pad_v2::event::group {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<zwp_tablet_pad_group_v2> pad_group;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::event::group::pad_group>;
 };
 
 /// path to the device
@@ -1250,8 +1709,11 @@ struct zwp_tablet_pad_v2::event::group {
 /// wp_tablet_pad.done event.
 struct zwp_tablet_pad_v2::event::path {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// path to local device
     Wstring path;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::event::path::path>;
 };
 
 /// buttons announced
@@ -1264,8 +1726,11 @@ struct zwp_tablet_pad_v2::event::path {
 /// button is available.
 struct zwp_tablet_pad_v2::event::buttons {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// the number of buttons
     Wuint buttons;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::event::buttons::buttons>;
 };
 
 /// pad description event sequence complete
@@ -1275,6 +1740,9 @@ struct zwp_tablet_pad_v2::event::buttons {
 /// be complete and finalize initialization of the pad.
 struct zwp_tablet_pad_v2::event::done {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// physical button state
@@ -1282,11 +1750,16 @@ struct zwp_tablet_pad_v2::event::done {
 /// Sent whenever the physical state of a button changes.
 struct zwp_tablet_pad_v2::event::button {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// the time of the event with millisecond granularity
     Wuint time;
     /// the index of the button that changed state
     Wuint button;
     zwp_tablet_pad_v2::button_state state;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::event::button::time,
+                                  &zwp_tablet_pad_v2::event::button::button,
+                                  &zwp_tablet_pad_v2::event::button::state>;
 };
 
 /// enter event
@@ -1294,12 +1767,17 @@ struct zwp_tablet_pad_v2::event::button {
 /// Notification that this pad is focused on the specified surface.
 struct zwp_tablet_pad_v2::event::enter {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the enter event
     Wuint serial;
     /// the tablet the pad is attached to
     Wobject<zwp_tablet_v2> tablet;
     /// surface the pad is focused on
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::event::enter::serial,
+                                  &zwp_tablet_pad_v2::event::enter::tablet,
+                                  &zwp_tablet_pad_v2::event::enter::surface>;
 };
 
 /// leave event
@@ -1308,10 +1786,14 @@ struct zwp_tablet_pad_v2::event::enter {
 /// surface.
 struct zwp_tablet_pad_v2::event::leave {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the leave event
     Wuint serial;
     /// surface the pad is no longer focused on
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&zwp_tablet_pad_v2::event::leave::serial,
+                                  &zwp_tablet_pad_v2::event::leave::surface>;
 };
 
 /// pad removed event
@@ -1324,8 +1806,379 @@ struct zwp_tablet_pad_v2::event::leave {
 /// the pad itself.
 struct zwp_tablet_pad_v2::event::removed {
     static constexpr Wopcode<zwp_tablet_pad_v2> opcode{ 7 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
+};
+
+/// Metadata of the interfaces of the protocol, see interface_info.
+inline constexpr auto tablet_v2_interfaces = std::array{
+    interface_info_of<zwp_tablet_manager_v2>,
+    interface_info_of<zwp_tablet_seat_v2>,
+    interface_info_of<zwp_tablet_tool_v2>,
+    interface_info_of<zwp_tablet_v2>,
+    interface_info_of<zwp_tablet_pad_ring_v2>,
+    interface_info_of<zwp_tablet_pad_strip_v2>,
+    interface_info_of<zwp_tablet_pad_group_v2>,
+    interface_info_of<zwp_tablet_pad_v2>,
 };
 
 } // namespace protocols
 } // namespace wl
 } // namespace waylander
+
+#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS
+// Instantiated in the library, see meson option explicit_instantiations.
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+
+namespace waylander {
+namespace wl {
+
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_tablet_manager_v2>,
+               const protocols::zwp_tablet_manager_v2::request::get_tablet_seat&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_manager_v2>,
+                                    const protocols::zwp_tablet_manager_v2::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_seat_v2>,
+                                    const protocols::zwp_tablet_seat_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tablet_added, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tablet_added;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tablet_added, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tablet_added;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tool_added, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tool_added;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tool_added, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tool_added;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::pad_added, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::pad_added;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::pad_added, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::pad_added;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_tool_v2>,
+                                    const protocols::zwp_tablet_tool_v2::request::set_cursor&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_tool_v2>,
+                                    const protocols::zwp_tablet_tool_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::type, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::type;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::type, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::type;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_serial,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_serial;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_serial,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_serial;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_id_wacom,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_id_wacom;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_id_wacom,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_id_wacom;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::capability, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::capability;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::capability, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::capability;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::removed, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::removed;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::removed, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::removed;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_in, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_in;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_in, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_in;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_out, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_out;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_out, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_out;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::down, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::down;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::down, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::down;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::up, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::up;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::up, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::up;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::motion;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::motion;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::pressure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::pressure;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::pressure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::pressure;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::distance, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::distance;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::distance, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::distance;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::tilt, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::tilt;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::tilt, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::tilt;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::rotation, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::rotation;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::rotation, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::rotation;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::slider, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::slider;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::slider, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::slider;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::wheel, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::wheel;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::wheel, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::wheel;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::button, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::button;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::button, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::button;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::frame;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::frame;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_v2>,
+                                    const protocols::zwp_tablet_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::name, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::name;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::name, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::name;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::id, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::id;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::id, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::id;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::path, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::path;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::path, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::path;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::removed, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::removed;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::removed, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::removed;
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_tablet_pad_ring_v2>,
+               const protocols::zwp_tablet_pad_ring_v2::request::set_feedback&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_pad_ring_v2>,
+                                    const protocols::zwp_tablet_pad_ring_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::source, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::source;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::source, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::source;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::angle, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::angle;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::angle, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::angle;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::stop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::stop;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::stop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::stop;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::frame;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::frame;
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::zwp_tablet_pad_strip_v2>,
+               const protocols::zwp_tablet_pad_strip_v2::request::set_feedback&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_pad_strip_v2>,
+                                    const protocols::zwp_tablet_pad_strip_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::source, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::source;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::source, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::source;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::position, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::position;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::position, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::position;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::stop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::stop;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::stop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::stop;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::frame;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::frame;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_pad_group_v2>,
+                                    const protocols::zwp_tablet_pad_group_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::buttons, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::buttons;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::buttons, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::buttons;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::ring, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::ring;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::ring, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::ring;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::strip, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::strip;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::strip, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::strip;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::modes, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::modes;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::modes, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::modes;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::mode_switch,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_pad_group_v2::event::mode_switch;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::mode_switch,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_pad_group_v2::event::mode_switch;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_pad_v2>,
+                                    const protocols::zwp_tablet_pad_v2::request::set_feedback&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::zwp_tablet_pad_v2>,
+                                    const protocols::zwp_tablet_pad_v2::request::destroy&);
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::group, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::group;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::group, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::group;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::path, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::path;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::path, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::path;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::buttons, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::buttons;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::buttons, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::buttons;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::done;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::button, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::button;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::button, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::button;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::enter;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::enter;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::leave;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::leave;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::removed, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::removed;
+extern template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::removed, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::removed;
+
+} // namespace wl
+} // namespace waylander
+#endif
@@ -35,6 +35,9 @@ namespace protocols {
 /// Declare everything before they might be used.
 
 struct wp_viewporter {
+    static constexpr std::u8string_view name{ u8"wp_viewporter" };
+    static constexpr protocol_version version{ 1 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -43,8 +46,25 @@ struct wp_viewporter {
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy, request::get_viewport>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 2>{ {
+        { u8"id", u8'n', u8"wp_viewport" },
+        { u8"surface", u8'o', u8"wl_surface" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"destroy", u8"", {} },
+        { u8"get_viewport", u8"no", std::span{ message_arguments }.subspan(0, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wp_viewport {
+    static constexpr std::u8string_view name{ u8"wp_viewport" };
+    static constexpr protocol_version version{ 1 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -54,6 +74,27 @@ struct wp_viewport {
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy,
+                                      request::set_source,
+                                      request::set_destination>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 6>{ {
+        { u8"x", u8'f' },
+        { u8"y", u8'f' },
+        { u8"width", u8'f' },
+        { u8"height", u8'f' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 3>{ {
+        { u8"destroy", u8"", {} },
+        { u8"set_source", u8"ffff", std::span{ message_arguments }.subspan(0, 4) },
+        { u8"set_destination", u8"ii", std::span{ message_arguments }.subspan(4, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 enum class wp_viewporter::error : Wint::integral_type {
     /// the surface already has a viewport object associated
@@ -67,6 +108,9 @@ enum class wp_viewporter::error : Wint::integral_type {
 /// wp_viewport objects included.
 struct wp_viewporter::request::destroy {
     static constexpr Wopcode<wp_viewporter> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// extend surface interface for crop and scale
@@ -77,10 +121,14 @@ struct wp_viewporter::request::destroy {
 /// protocol error is raised.
 struct wp_viewporter::request::get_viewport {
     static constexpr Wopcode<wp_viewporter> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the new viewport interface id
     Wnew_id<wp_viewport> id;
     /// the surface
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&wp_viewporter::request::get_viewport::id,
+                                  &wp_viewporter::request::get_viewport::surface>;
 };
 
 enum class wp_viewport::error : Wint::integral_type {
@@ -100,6 +148,9 @@ enum class wp_viewport::error : Wint::integral_type {
 /// The change is applied on the next wl_surface.commit.
 struct wp_viewport::request::destroy {
     static constexpr Wopcode<wp_viewport> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the source rectangle for cropping
@@ -116,6 +167,7 @@ struct wp_viewport::request::destroy {
 /// The crop and scale state is double-buffered, see wl_surface.commit.
 struct wp_viewport::request::set_source {
     static constexpr Wopcode<wp_viewport> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// source rectangle x
     Wfixed x;
     /// source rectangle y
@@ -124,6 +176,11 @@ struct wp_viewport::request::set_source {
     Wfixed width;
     /// source rectangle height
     Wfixed height;
+
+    using fields = message_fields<&wp_viewport::request::set_source::x,
+                                  &wp_viewport::request::set_source::y,
+                                  &wp_viewport::request::set_source::width,
+                                  &wp_viewport::request::set_source::height>;
 };
 
 /// set the surface size for scaling
@@ -140,12 +197,51 @@ struct wp_viewport::request::set_source {
 /// The crop and scale state is double-buffered, see wl_surface.commit.
 struct wp_viewport::request::set_destination {
     static constexpr Wopcode<wp_viewport> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// surface width
     Wint width;
     /// surface height
     Wint height;
+
+    using fields = message_fields<&wp_viewport::request::set_destination::width,
+                                  &wp_viewport::request::set_destination::height>;
+};
+
+/// Metadata of the interfaces of the protocol, see interface_info.
+inline constexpr auto viewporter_interfaces = std::array{
+    interface_info_of<wp_viewporter>,
+    interface_info_of<wp_viewport>,
 };
 
 } // namespace protocols
 } // namespace wl
 } // namespace waylander
+
+#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS
+// Instantiated in the library, see meson option explicit_instantiations.
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+
+namespace waylander {
+namespace wl {
+
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_viewporter>,
+                                    const protocols::wp_viewporter::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_viewporter>,
+                                    const protocols::wp_viewporter::request::get_viewport&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_viewport>,
+                                    const protocols::wp_viewport::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_viewport>,
+                                    const protocols::wp_viewport::request::set_source&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wp_viewport>,
+                                    const protocols::wp_viewport::request::set_destination&);
+
+} // namespace wl
+} // namespace waylander
+#endif
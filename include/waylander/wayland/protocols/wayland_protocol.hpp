@@ -39,6 +39,9 @@ namespace protocols {
 /// Declare everything before they might be used.
 
 struct wl_display {
+    static constexpr std::u8string_view name{ u8"wl_display" };
+    static constexpr protocol_version version{ 1 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -50,8 +53,32 @@ struct wl_display {
         struct error;
         struct delete_id;
     };
+
+    using request_list = message_list<request::sync, request::get_registry>;
+    using event_list   = message_list<event::error, event::delete_id>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 6>{ {
+        { u8"callback", u8'n', u8"wl_callback" },
+        { u8"registry", u8'n', u8"wl_registry" },
+        { u8"object_id", u8'o' },
+        { u8"code", u8'u' },
+        { u8"message", u8's' },
+        { u8"id", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"sync", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"get_registry", u8"n", std::span{ message_arguments }.subspan(1, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 2>{ {
+        { u8"error", u8"ous", std::span{ message_arguments }.subspan(2, 3) },
+        { u8"delete_id", u8"u", std::span{ message_arguments }.subspan(5, 1) },
+    } };
 };
 struct wl_registry {
+    static constexpr std::u8string_view name{ u8"wl_registry" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct bind;
     };
@@ -60,23 +87,80 @@ struct wl_registry {
         struct global;
         struct global_remove;
     };
+
+    using request_list = message_list<request::bind>;
+    using event_list   = message_list<event::global, event::global_remove>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 8>{ {
+        { u8"name", u8'u' },
+        { u8"new_id_interface", u8's' },
+        { u8"new_id_interface_version", u8'u' },
+        { u8"id", u8'n' },
+        { u8"name", u8'u' },
+        { u8"interface", u8's' },
+        { u8"version", u8'u' },
+        { u8"name", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"bind", u8"usun", std::span{ message_arguments }.subspan(0, 4) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 2>{ {
+        { u8"global", u8"usu", std::span{ message_arguments }.subspan(4, 3) },
+        { u8"global_remove", u8"u", std::span{ message_arguments }.subspan(7, 1) },
+    } };
 };
 struct wl_callback {
+    static constexpr std::u8string_view name{ u8"wl_callback" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {};
 
     struct event {
         struct done;
     };
+
+    using request_list = message_list<>;
+    using event_list   = message_list<event::done>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 1>{ {
+        { u8"callback_data", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 0>{};
+    static constexpr auto event_infos = std::array<message_info, 1>{ {
+        { u8"done", u8"u", std::span{ message_arguments }.subspan(0, 1) },
+    } };
 };
 struct wl_compositor {
+    static constexpr std::u8string_view name{ u8"wl_compositor" };
+    static constexpr protocol_version version{ 6 };
+
     struct request {
         struct create_surface;
         struct create_region;
     };
 
     struct event {};
+
+    using request_list = message_list<request::create_surface, request::create_region>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 2>{ {
+        { u8"id", u8'n', u8"wl_surface" },
+        { u8"id", u8'n', u8"wl_region" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"create_surface", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"create_region", u8"n", std::span{ message_arguments }.subspan(1, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_shm_pool {
+    static constexpr std::u8string_view name{ u8"wl_shm_pool" };
+    static constexpr protocol_version version{ 2 };
+
     struct request {
         struct create_buffer;
         struct destroy;
@@ -84,8 +168,31 @@ struct wl_shm_pool {
     };
 
     struct event {};
+
+    using request_list = message_list<request::create_buffer, request::destroy, request::resize>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 7>{ {
+        { u8"id", u8'n', u8"wl_buffer" },
+        { u8"offset", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"stride", u8'i' },
+        { u8"format", u8'i' },
+        { u8"size", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 3>{ {
+        { u8"create_buffer", u8"niiiii", std::span{ message_arguments }.subspan(0, 6) },
+        { u8"destroy", u8"", {} },
+        { u8"resize", u8"i", std::span{ message_arguments }.subspan(6, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_shm {
+    static constexpr std::u8string_view name{ u8"wl_shm" };
+    static constexpr protocol_version version{ 2 };
+
     enum class error : Wint::integral_type;
     enum class format : Wint::integral_type;
 
@@ -97,8 +204,29 @@ struct wl_shm {
     struct event {
         struct format;
     };
+
+    using request_list = message_list<request::create_pool, request::release>;
+    using event_list   = message_list<event::format>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 4>{ {
+        { u8"id", u8'n', u8"wl_shm_pool" },
+        { u8"fd", u8'h' },
+        { u8"size", u8'i' },
+        { u8"format", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"create_pool", u8"nhi", std::span{ message_arguments }.subspan(0, 3) },
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 1>{ {
+        { u8"format", u8"i", std::span{ message_arguments }.subspan(3, 1) },
+    } };
 };
 struct wl_buffer {
+    static constexpr std::u8string_view name{ u8"wl_buffer" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct destroy;
     };
@@ -106,8 +234,23 @@ struct wl_buffer {
     struct event {
         struct release;
     };
+
+    using request_list = message_list<request::destroy>;
+    using event_list   = message_list<event::release>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 0>{};
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"destroy", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 1>{ {
+        { u8"release", u8"", {} },
+    } };
 };
 struct wl_data_offer {
+    static constexpr std::u8string_view name{ u8"wl_data_offer" };
+    static constexpr protocol_version version{ 3 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -123,8 +266,43 @@ struct wl_data_offer {
         struct source_actions;
         struct action;
     };
+
+    using request_list = message_list<request::accept,
+                                      request::receive,
+                                      request::destroy,
+                                      request::finish,
+                                      request::set_actions>;
+    using event_list   = message_list<event::offer, event::source_actions, event::action>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 9>{ {
+        { u8"serial", u8'u' },
+        { u8"mime_type", u8's' },
+        { u8"mime_type", u8's' },
+        { u8"fd", u8'h' },
+        { u8"dnd_actions", u8'u' },
+        { u8"preferred_action", u8'u' },
+        { u8"mime_type", u8's' },
+        { u8"source_actions", u8'u' },
+        { u8"dnd_action", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 5>{ {
+        { u8"accept", u8"us", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"receive", u8"sh", std::span{ message_arguments }.subspan(2, 2) },
+        { u8"destroy", u8"", {} },
+        { u8"finish", u8"", {} },
+        { u8"set_actions", u8"uu", std::span{ message_arguments }.subspan(4, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 3>{ {
+        { u8"offer", u8"s", std::span{ message_arguments }.subspan(6, 1) },
+        { u8"source_actions", u8"u", std::span{ message_arguments }.subspan(7, 1) },
+        { u8"action", u8"u", std::span{ message_arguments }.subspan(8, 1) },
+    } };
 };
 struct wl_data_source {
+    static constexpr std::u8string_view name{ u8"wl_data_source" };
+    static constexpr protocol_version version{ 3 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -141,8 +319,42 @@ struct wl_data_source {
         struct dnd_finished;
         struct action;
     };
+
+    using request_list = message_list<request::offer, request::destroy, request::set_actions>;
+    using event_list   = message_list<event::target,
+                                      event::send,
+                                      event::cancelled,
+                                      event::dnd_drop_performed,
+                                      event::dnd_finished,
+                                      event::action>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 6>{ {
+        { u8"mime_type", u8's' },
+        { u8"dnd_actions", u8'u' },
+        { u8"mime_type", u8's' },
+        { u8"mime_type", u8's' },
+        { u8"fd", u8'h' },
+        { u8"dnd_action", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 3>{ {
+        { u8"offer", u8"s", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"destroy", u8"", {} },
+        { u8"set_actions", u8"u", std::span{ message_arguments }.subspan(1, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 6>{ {
+        { u8"target", u8"s", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"send", u8"sh", std::span{ message_arguments }.subspan(3, 2) },
+        { u8"cancelled", u8"", {} },
+        { u8"dnd_drop_performed", u8"", {} },
+        { u8"dnd_finished", u8"", {} },
+        { u8"action", u8"u", std::span{ message_arguments }.subspan(5, 1) },
+    } };
 };
 struct wl_data_device {
+    static constexpr std::u8string_view name{ u8"wl_data_device" };
+    static constexpr protocol_version version{ 3 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -159,8 +371,54 @@ struct wl_data_device {
         struct drop;
         struct selection;
     };
+
+    using request_list = message_list<request::start_drag,
+                                      request::set_selection,
+                                      request::release>;
+    using event_list   = message_list<event::data_offer,
+                                      event::enter,
+                                      event::leave,
+                                      event::motion,
+                                      event::drop,
+                                      event::selection>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 16>{ {
+        { u8"source", u8'o', u8"wl_data_source" },
+        { u8"origin", u8'o', u8"wl_surface" },
+        { u8"icon", u8'o', u8"wl_surface" },
+        { u8"serial", u8'u' },
+        { u8"source", u8'o', u8"wl_data_source" },
+        { u8"serial", u8'u' },
+        { u8"id", u8'n', u8"wl_data_offer" },
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"x", u8'f' },
+        { u8"y", u8'f' },
+        { u8"id", u8'o', u8"wl_data_offer" },
+        { u8"time", u8'u' },
+        { u8"x", u8'f' },
+        { u8"y", u8'f' },
+        { u8"id", u8'o', u8"wl_data_offer" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 3>{ {
+        { u8"start_drag", u8"ooou", std::span{ message_arguments }.subspan(0, 4) },
+        { u8"set_selection", u8"ou", std::span{ message_arguments }.subspan(4, 2) },
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 6>{ {
+        { u8"data_offer", u8"n", std::span{ message_arguments }.subspan(6, 1) },
+        { u8"enter", u8"uoffo", std::span{ message_arguments }.subspan(7, 5) },
+        { u8"leave", u8"", {} },
+        { u8"motion", u8"uff", std::span{ message_arguments }.subspan(12, 3) },
+        { u8"drop", u8"", {} },
+        { u8"selection", u8"o", std::span{ message_arguments }.subspan(15, 1) },
+    } };
 };
 struct wl_data_device_manager {
+    static constexpr std::u8string_view name{ u8"wl_data_device_manager" };
+    static constexpr protocol_version version{ 3 };
+
     enum class dnd_action : Wuint::integral_type;
 
     struct request {
@@ -169,8 +427,26 @@ struct wl_data_device_manager {
     };
 
     struct event {};
+
+    using request_list = message_list<request::create_data_source, request::get_data_device>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 3>{ {
+        { u8"id", u8'n', u8"wl_data_source" },
+        { u8"id", u8'n', u8"wl_data_device" },
+        { u8"seat", u8'o', u8"wl_seat" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"create_data_source", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"get_data_device", u8"no", std::span{ message_arguments }.subspan(1, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_shell {
+    static constexpr std::u8string_view name{ u8"wl_shell" };
+    static constexpr protocol_version version{ 1 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -178,8 +454,24 @@ struct wl_shell {
     };
 
     struct event {};
+
+    using request_list = message_list<request::get_shell_surface>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 2>{ {
+        { u8"id", u8'n', u8"wl_shell_surface" },
+        { u8"surface", u8'o', u8"wl_surface" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"get_shell_surface", u8"no", std::span{ message_arguments }.subspan(0, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_shell_surface {
+    static constexpr std::u8string_view name{ u8"wl_shell_surface" };
+    static constexpr protocol_version version{ 1 };
+
     enum class resize : Wuint::integral_type;
     enum class transient : Wuint::integral_type;
     enum class fullscreen_method : Wint::integral_type;
@@ -202,8 +494,70 @@ struct wl_shell_surface {
         struct configure;
         struct popup_done;
     };
+
+    using request_list = message_list<request::pong,
+                                      request::move,
+                                      request::resize,
+                                      request::set_toplevel,
+                                      request::set_transient,
+                                      request::set_fullscreen,
+                                      request::set_popup,
+                                      request::set_maximized,
+                                      request::set_title,
+                                      request::set_class>;
+    using event_list   = message_list<event::ping, event::configure, event::popup_done>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 26>{ {
+        { u8"serial", u8'u' },
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"edges", u8'u' },
+        { u8"parent", u8'o', u8"wl_surface" },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"flags", u8'u' },
+        { u8"method", u8'i' },
+        { u8"framerate", u8'u' },
+        { u8"output", u8'o', u8"wl_output" },
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"parent", u8'o', u8"wl_surface" },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"flags", u8'u' },
+        { u8"output", u8'o', u8"wl_output" },
+        { u8"title", u8's' },
+        { u8"class_", u8's' },
+        { u8"serial", u8'u' },
+        { u8"edges", u8'u' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 10>{ {
+        { u8"pong", u8"u", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"move", u8"ou", std::span{ message_arguments }.subspan(1, 2) },
+        { u8"resize", u8"ouu", std::span{ message_arguments }.subspan(3, 3) },
+        { u8"set_toplevel", u8"", {} },
+        { u8"set_transient", u8"oiiu", std::span{ message_arguments }.subspan(6, 4) },
+        { u8"set_fullscreen", u8"iuo", std::span{ message_arguments }.subspan(10, 3) },
+        { u8"set_popup", u8"ouoiiu", std::span{ message_arguments }.subspan(13, 6) },
+        { u8"set_maximized", u8"o", std::span{ message_arguments }.subspan(19, 1) },
+        { u8"set_title", u8"s", std::span{ message_arguments }.subspan(20, 1) },
+        { u8"set_class", u8"s", std::span{ message_arguments }.subspan(21, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 3>{ {
+        { u8"ping", u8"u", std::span{ message_arguments }.subspan(22, 1) },
+        { u8"configure", u8"uii", std::span{ message_arguments }.subspan(23, 3) },
+        { u8"popup_done", u8"", {} },
+    } };
 };
 struct wl_surface {
+    static constexpr std::u8string_view name{ u8"wl_surface" };
+    static constexpr protocol_version version{ 6 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -226,8 +580,72 @@ struct wl_surface {
         struct preferred_buffer_scale;
         struct preferred_buffer_transform;
     };
+
+    using request_list = message_list<request::destroy,
+                                      request::attach,
+                                      request::damage,
+                                      request::frame,
+                                      request::set_opaque_region,
+                                      request::set_input_region,
+                                      request::commit,
+                                      request::set_buffer_transform,
+                                      request::set_buffer_scale,
+                                      request::damage_buffer,
+                                      request::offset>;
+    using event_list   = message_list<event::enter,
+                                      event::leave,
+                                      event::preferred_buffer_scale,
+                                      event::preferred_buffer_transform>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 22>{ {
+        { u8"buffer", u8'o', u8"wl_buffer" },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"callback", u8'n', u8"wl_callback" },
+        { u8"region", u8'o', u8"wl_region" },
+        { u8"region", u8'o', u8"wl_region" },
+        { u8"transform", u8'i' },
+        { u8"scale", u8'i' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"output", u8'o', u8"wl_output" },
+        { u8"output", u8'o', u8"wl_output" },
+        { u8"factor", u8'i' },
+        { u8"transform", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 11>{ {
+        { u8"destroy", u8"", {} },
+        { u8"attach", u8"oii", std::span{ message_arguments }.subspan(0, 3) },
+        { u8"damage", u8"iiii", std::span{ message_arguments }.subspan(3, 4) },
+        { u8"frame", u8"n", std::span{ message_arguments }.subspan(7, 1) },
+        { u8"set_opaque_region", u8"o", std::span{ message_arguments }.subspan(8, 1) },
+        { u8"set_input_region", u8"o", std::span{ message_arguments }.subspan(9, 1) },
+        { u8"commit", u8"", {} },
+        { u8"set_buffer_transform", u8"i", std::span{ message_arguments }.subspan(10, 1) },
+        { u8"set_buffer_scale", u8"i", std::span{ message_arguments }.subspan(11, 1) },
+        { u8"damage_buffer", u8"iiii", std::span{ message_arguments }.subspan(12, 4) },
+        { u8"offset", u8"ii", std::span{ message_arguments }.subspan(16, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 4>{ {
+        { u8"enter", u8"o", std::span{ message_arguments }.subspan(18, 1) },
+        { u8"leave", u8"o", std::span{ message_arguments }.subspan(19, 1) },
+        { u8"preferred_buffer_scale", u8"i", std::span{ message_arguments }.subspan(20, 1) },
+        { u8"preferred_buffer_transform", u8"i", std::span{ message_arguments }.subspan(21, 1) },
+    } };
 };
 struct wl_seat {
+    static constexpr std::u8string_view name{ u8"wl_seat" };
+    static constexpr protocol_version version{ 10 };
+
     enum class capability : Wuint::integral_type;
     enum class error : Wint::integral_type;
 
@@ -242,8 +660,36 @@ struct wl_seat {
         struct capabilities;
         struct name;
     };
+
+    using request_list = message_list<request::get_pointer,
+                                      request::get_keyboard,
+                                      request::get_touch,
+                                      request::release>;
+    using event_list   = message_list<event::capabilities, event::name>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 5>{ {
+        { u8"id", u8'n', u8"wl_pointer" },
+        { u8"id", u8'n', u8"wl_keyboard" },
+        { u8"id", u8'n', u8"wl_touch" },
+        { u8"capabilities", u8'u' },
+        { u8"name", u8's' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 4>{ {
+        { u8"get_pointer", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"get_keyboard", u8"n", std::span{ message_arguments }.subspan(1, 1) },
+        { u8"get_touch", u8"n", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 2>{ {
+        { u8"capabilities", u8"u", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"name", u8"s", std::span{ message_arguments }.subspan(4, 1) },
+    } };
 };
 struct wl_pointer {
+    static constexpr std::u8string_view name{ u8"wl_pointer" };
+    static constexpr protocol_version version{ 10 };
+
     enum class error : Wint::integral_type;
     enum class button_state : Wint::integral_type;
     enum class axis : Wint::integral_type;
@@ -268,8 +714,74 @@ struct wl_pointer {
         struct axis_value120;
         struct axis_relative_direction;
     };
+
+    using request_list = message_list<request::set_cursor, request::release>;
+    using event_list   = message_list<event::enter,
+                                      event::leave,
+                                      event::motion,
+                                      event::button,
+                                      event::axis,
+                                      event::frame,
+                                      event::axis_source,
+                                      event::axis_stop,
+                                      event::axis_discrete,
+                                      event::axis_value120,
+                                      event::axis_relative_direction>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 29>{ {
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"hotspot_x", u8'i' },
+        { u8"hotspot_y", u8'i' },
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"surface_x", u8'f' },
+        { u8"surface_y", u8'f' },
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"time", u8'u' },
+        { u8"surface_x", u8'f' },
+        { u8"surface_y", u8'f' },
+        { u8"serial", u8'u' },
+        { u8"time", u8'u' },
+        { u8"button", u8'u' },
+        { u8"state", u8'i' },
+        { u8"time", u8'u' },
+        { u8"axis", u8'i' },
+        { u8"value", u8'f' },
+        { u8"axis_source", u8'i' },
+        { u8"time", u8'u' },
+        { u8"axis", u8'i' },
+        { u8"axis", u8'i' },
+        { u8"discrete", u8'i' },
+        { u8"axis", u8'i' },
+        { u8"value120", u8'i' },
+        { u8"axis", u8'i' },
+        { u8"direction", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"set_cursor", u8"uoii", std::span{ message_arguments }.subspan(0, 4) },
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 11>{ {
+        { u8"enter", u8"uoff", std::span{ message_arguments }.subspan(4, 4) },
+        { u8"leave", u8"uo", std::span{ message_arguments }.subspan(8, 2) },
+        { u8"motion", u8"uff", std::span{ message_arguments }.subspan(10, 3) },
+        { u8"button", u8"uuui", std::span{ message_arguments }.subspan(13, 4) },
+        { u8"axis", u8"uif", std::span{ message_arguments }.subspan(17, 3) },
+        { u8"frame", u8"", {} },
+        { u8"axis_source", u8"i", std::span{ message_arguments }.subspan(20, 1) },
+        { u8"axis_stop", u8"ui", std::span{ message_arguments }.subspan(21, 2) },
+        { u8"axis_discrete", u8"ii", std::span{ message_arguments }.subspan(23, 2) },
+        { u8"axis_value120", u8"ii", std::span{ message_arguments }.subspan(25, 2) },
+        { u8"axis_relative_direction", u8"ii", std::span{ message_arguments }.subspan(27, 2) },
+    } };
 };
 struct wl_keyboard {
+    static constexpr std::u8string_view name{ u8"wl_keyboard" };
+    static constexpr protocol_version version{ 10 };
+
     enum class keymap_format : Wint::integral_type;
     enum class key_state : Wint::integral_type;
 
@@ -285,8 +797,53 @@ struct wl_keyboard {
         struct modifiers;
         struct repeat_info;
     };
+
+    using request_list = message_list<request::release>;
+    using event_list   = message_list<event::keymap,
+                                      event::enter,
+                                      event::leave,
+                                      event::key,
+                                      event::modifiers,
+                                      event::repeat_info>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 19>{ {
+        { u8"format", u8'i' },
+        { u8"fd", u8'h' },
+        { u8"size", u8'u' },
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"keys", u8'a' },
+        { u8"serial", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"serial", u8'u' },
+        { u8"time", u8'u' },
+        { u8"key", u8'u' },
+        { u8"state", u8'i' },
+        { u8"serial", u8'u' },
+        { u8"mods_depressed", u8'u' },
+        { u8"mods_latched", u8'u' },
+        { u8"mods_locked", u8'u' },
+        { u8"group", u8'u' },
+        { u8"rate", u8'i' },
+        { u8"delay", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 6>{ {
+        { u8"keymap", u8"ihu", std::span{ message_arguments }.subspan(0, 3) },
+        { u8"enter", u8"uoa", std::span{ message_arguments }.subspan(3, 3) },
+        { u8"leave", u8"uo", std::span{ message_arguments }.subspan(6, 2) },
+        { u8"key", u8"uuui", std::span{ message_arguments }.subspan(8, 4) },
+        { u8"modifiers", u8"uuuuu", std::span{ message_arguments }.subspan(12, 5) },
+        { u8"repeat_info", u8"ii", std::span{ message_arguments }.subspan(17, 2) },
+    } };
 };
 struct wl_touch {
+    static constexpr std::u8string_view name{ u8"wl_touch" };
+    static constexpr protocol_version version{ 10 };
+
     struct request {
         struct release;
     };
@@ -300,8 +857,54 @@ struct wl_touch {
         struct shape;
         struct orientation;
     };
+
+    using request_list = message_list<request::release>;
+    using event_list   = message_list<event::down,
+                                      event::up,
+                                      event::motion,
+                                      event::frame,
+                                      event::cancel,
+                                      event::shape,
+                                      event::orientation>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 18>{ {
+        { u8"serial", u8'u' },
+        { u8"time", u8'u' },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"id", u8'i' },
+        { u8"x", u8'f' },
+        { u8"y", u8'f' },
+        { u8"serial", u8'u' },
+        { u8"time", u8'u' },
+        { u8"id", u8'i' },
+        { u8"time", u8'u' },
+        { u8"id", u8'i' },
+        { u8"x", u8'f' },
+        { u8"y", u8'f' },
+        { u8"id", u8'i' },
+        { u8"major", u8'f' },
+        { u8"minor", u8'f' },
+        { u8"id", u8'i' },
+        { u8"orientation", u8'f' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 7>{ {
+        { u8"down", u8"uuoiff", std::span{ message_arguments }.subspan(0, 6) },
+        { u8"up", u8"uui", std::span{ message_arguments }.subspan(6, 3) },
+        { u8"motion", u8"uiff", std::span{ message_arguments }.subspan(9, 4) },
+        { u8"frame", u8"", {} },
+        { u8"cancel", u8"", {} },
+        { u8"shape", u8"iff", std::span{ message_arguments }.subspan(13, 3) },
+        { u8"orientation", u8"if", std::span{ message_arguments }.subspan(16, 2) },
+    } };
 };
 struct wl_output {
+    static constexpr std::u8string_view name{ u8"wl_output" };
+    static constexpr protocol_version version{ 4 };
+
     enum class subpixel : Wint::integral_type;
     enum class transform : Wint::integral_type;
     enum class mode : Wuint::integral_type;
@@ -318,8 +921,49 @@ struct wl_output {
         struct name;
         struct description;
     };
+
+    using request_list = message_list<request::release>;
+    using event_list   = message_list<event::geometry,
+                                      event::mode,
+                                      event::done,
+                                      event::scale,
+                                      event::name,
+                                      event::description>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 15>{ {
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"physical_width", u8'i' },
+        { u8"physical_height", u8'i' },
+        { u8"subpixel", u8'i' },
+        { u8"make", u8's' },
+        { u8"model", u8's' },
+        { u8"transform", u8'i' },
+        { u8"flags", u8'u' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"refresh", u8'i' },
+        { u8"factor", u8'i' },
+        { u8"name", u8's' },
+        { u8"description", u8's' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 1>{ {
+        { u8"release", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 6>{ {
+        { u8"geometry", u8"iiiiissi", std::span{ message_arguments }.subspan(0, 8) },
+        { u8"mode", u8"uiii", std::span{ message_arguments }.subspan(8, 4) },
+        { u8"done", u8"", {} },
+        { u8"scale", u8"i", std::span{ message_arguments }.subspan(12, 1) },
+        { u8"name", u8"s", std::span{ message_arguments }.subspan(13, 1) },
+        { u8"description", u8"s", std::span{ message_arguments }.subspan(14, 1) },
+    } };
 };
 struct wl_region {
+    static constexpr std::u8string_view name{ u8"wl_region" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct destroy;
         struct add;
@@ -327,8 +971,32 @@ struct wl_region {
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy, request::add, request::subtract>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 8>{ {
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 3>{ {
+        { u8"destroy", u8"", {} },
+        { u8"add", u8"iiii", std::span{ message_arguments }.subspan(0, 4) },
+        { u8"subtract", u8"iiii", std::span{ message_arguments }.subspan(4, 4) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_subcompositor {
+    static constexpr std::u8string_view name{ u8"wl_subcompositor" };
+    static constexpr protocol_version version{ 1 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -337,8 +1005,26 @@ struct wl_subcompositor {
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy, request::get_subsurface>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 3>{ {
+        { u8"id", u8'n', u8"wl_subsurface" },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"parent", u8'o', u8"wl_surface" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"destroy", u8"", {} },
+        { u8"get_subsurface", u8"noo", std::span{ message_arguments }.subspan(0, 3) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_subsurface {
+    static constexpr std::u8string_view name{ u8"wl_subsurface" };
+    static constexpr protocol_version version{ 1 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -351,14 +1037,55 @@ struct wl_subsurface {
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy,
+                                      request::set_position,
+                                      request::place_above,
+                                      request::place_below,
+                                      request::set_sync,
+                                      request::set_desync>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 4>{ {
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"sibling", u8'o', u8"wl_surface" },
+        { u8"sibling", u8'o', u8"wl_surface" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 6>{ {
+        { u8"destroy", u8"", {} },
+        { u8"set_position", u8"ii", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"place_above", u8"o", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"place_below", u8"o", std::span{ message_arguments }.subspan(3, 1) },
+        { u8"set_sync", u8"", {} },
+        { u8"set_desync", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct wl_fixes {
+    static constexpr std::u8string_view name{ u8"wl_fixes" };
+    static constexpr protocol_version version{ 1 };
+
     struct request {
         struct destroy;
         struct destroy_registry;
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy, request::destroy_registry>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 1>{ {
+        { u8"registry", u8'o', u8"wl_registry" },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 2>{ {
+        { u8"destroy", u8"", {} },
+        { u8"destroy_registry", u8"o", std::span{ message_arguments }.subspan(0, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 /// global error values
 ///
@@ -390,8 +1117,11 @@ enum class wl_display::error : Wint::integral_type {
 /// The callback_data passed in the callback is undefined and should be ignored.
 struct wl_display::request::sync {
     static constexpr Wopcode<wl_display> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// callback object for the sync request
     Wnew_id<wl_callback> callback;
+
+    using fields = message_fields<&wl_display::request::sync::callback>;
 };
 
 /// get global registry object
@@ -407,8 +1137,11 @@ struct wl_display::request::sync {
 /// possible to avoid wasting memory.
 struct wl_display::request::get_registry {
     static constexpr Wopcode<wl_display> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// global registry object
     Wnew_id<wl_registry> registry;
+
+    using fields = message_fields<&wl_display::request::get_registry::registry>;
 };
 
 /// fatal error event
@@ -422,12 +1155,17 @@ struct wl_display::request::get_registry {
 /// of the error, for (debugging) convenience.
 struct wl_display::event::error {
     static constexpr Wopcode<wl_display> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// object where the error occurred
     Wobject<> object_id;
     /// error code
     Wuint code;
     /// error description
     Wstring message;
+
+    using fields = message_fields<&wl_display::event::error::object_id,
+                                  &wl_display::event::error::code,
+                                  &wl_display::event::error::message>;
 };
 
 /// acknowledge object ID deletion
@@ -439,8 +1177,11 @@ struct wl_display::event::error {
 /// it will know that it can safely reuse the object ID.
 struct wl_display::event::delete_id {
     static constexpr Wopcode<wl_display> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// deleted object ID
     Wuint id;
+
+    using fields = message_fields<&wl_display::event::delete_id::id>;
 };
 
 /// bind an object to the display
@@ -449,6 +1190,7 @@ struct wl_display::event::delete_id {
 /// specified name as the identifier.
 struct wl_registry::request::bind {
     static constexpr Wopcode<wl_registry> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// unique numeric name of the object
     Wuint name;
     /// Interface name, e.g. from registry::global event, for following Wnew_id<>.
@@ -457,6 +1199,11 @@ struct wl_registry::request::bind {
     Wuint new_id_interface_version;
     /// bounded object
     Wnew_id<> id;
+
+    using fields = message_fields<&wl_registry::request::bind::name,
+                                  &wl_registry::request::bind::new_id_interface,
+                                  &wl_registry::request::bind::new_id_interface_version,
+                                  &wl_registry::request::bind::id>;
 };
 
 /// announce global object
@@ -468,12 +1215,17 @@ struct wl_registry::request::bind {
 /// given version of the given interface.
 struct wl_registry::event::global {
     static constexpr Wopcode<wl_registry> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// numeric name of the global object
     Wuint name;
     /// interface implemented by the object
     Wstring interface;
     /// interface version
     Wuint version;
+
+    using fields = message_fields<&wl_registry::event::global::name,
+                                  &wl_registry::event::global::interface,
+                                  &wl_registry::event::global::version>;
 };
 
 /// announce removal of global object
@@ -490,8 +1242,11 @@ struct wl_registry::event::global {
 /// the global going away and a client sending a request to it.
 struct wl_registry::event::global_remove {
     static constexpr Wopcode<wl_registry> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// numeric name of the global object
     Wuint name;
+
+    using fields = message_fields<&wl_registry::event::global_remove::name>;
 };
 
 /// done event
@@ -499,8 +1254,11 @@ struct wl_registry::event::global_remove {
 /// Notify the client when the related request is done.
 struct wl_callback::event::done {
     static constexpr Wopcode<wl_callback> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// request-specific data for the callback
     Wuint callback_data;
+
+    using fields = message_fields<&wl_callback::event::done::callback_data>;
 };
 
 /// create new surface
@@ -508,8 +1266,11 @@ struct wl_callback::event::done {
 /// Ask the compositor to create a new surface.
 struct wl_compositor::request::create_surface {
     static constexpr Wopcode<wl_compositor> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the new surface
     Wnew_id<wl_surface> id;
+
+    using fields = message_fields<&wl_compositor::request::create_surface::id>;
 };
 
 /// create new region
@@ -517,8 +1278,11 @@ struct wl_compositor::request::create_surface {
 /// Ask the compositor to create a new region.
 struct wl_compositor::request::create_region {
     static constexpr Wopcode<wl_compositor> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the new region
     Wnew_id<wl_region> id;
+
+    using fields = message_fields<&wl_compositor::request::create_region::id>;
 };
 
 /// create a buffer from the pool
@@ -536,6 +1300,7 @@ struct wl_compositor::request::create_region {
 /// a buffer from it.
 struct wl_shm_pool::request::create_buffer {
     static constexpr Wopcode<wl_shm_pool> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// buffer to create
     Wnew_id<wl_buffer> id;
     /// buffer byte offset within the pool
@@ -548,6 +1313,13 @@ struct wl_shm_pool::request::create_buffer {
     Wint stride;
     /// buffer pixel format
     wl_shm::format format;
+
+    using fields = message_fields<&wl_shm_pool::request::create_buffer::id,
+                                  &wl_shm_pool::request::create_buffer::offset,
+                                  &wl_shm_pool::request::create_buffer::width,
+                                  &wl_shm_pool::request::create_buffer::height,
+                                  &wl_shm_pool::request::create_buffer::stride,
+                                  &wl_shm_pool::request::create_buffer::format>;
 };
 
 /// destroy the pool
@@ -559,6 +1331,9 @@ struct wl_shm_pool::request::create_buffer {
 /// are gone.
 struct wl_shm_pool::request::destroy {
     static constexpr Wopcode<wl_shm_pool> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// change the size of the pool mapping
@@ -575,8 +1350,11 @@ struct wl_shm_pool::request::destroy {
 /// the new pool size.
 struct wl_shm_pool::request::resize {
     static constexpr Wopcode<wl_shm_pool> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// new size of the pool, in bytes
     Wint size;
+
+    using fields = message_fields<&wl_shm_pool::request::resize::size>;
 };
 
 /// wl_shm error values
@@ -851,12 +1629,17 @@ enum class wl_shm::format : Wint::integral_type {
 /// descriptor, to use as backing memory for the pool.
 struct wl_shm::request::create_pool {
     static constexpr Wopcode<wl_shm> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// pool to create
     Wnew_id<wl_shm_pool> id;
     /// file descriptor for the pool
     Wfd fd;
     /// pool size, in bytes
     Wint size;
+
+    using fields = message_fields<&wl_shm::request::create_pool::id,
+                                  &wl_shm::request::create_pool::fd,
+                                  &wl_shm::request::create_pool::size>;
 };
 
 /// release the shm object
@@ -867,6 +1650,9 @@ struct wl_shm::request::create_pool {
 /// Objects created via this interface remain unaffected.
 struct wl_shm::request::release {
     static constexpr Wopcode<wl_shm> opcode{ 1 };
+    static constexpr protocol_version since{ 2 };
+
+    using fields = message_fields<>;
 };
 
 /// pixel format description
@@ -876,8 +1662,11 @@ struct wl_shm::request::release {
 /// argb8888 and xrgb8888.
 struct wl_shm::event::format {
     static constexpr Wopcode<wl_shm> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// buffer pixel format
     wl_shm::format format;
+
+    using fields = message_fields<&wl_shm::event::format::format>;
 };
 
 /// destroy a buffer
@@ -888,6 +1677,9 @@ struct wl_shm::event::format {
 /// For possible side-effects to a surface, see wl_surface.attach.
 struct wl_buffer::request::destroy {
     static constexpr Wopcode<wl_buffer> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// compositor releases buffer
@@ -906,6 +1698,9 @@ struct wl_buffer::request::destroy {
 /// optimization for GL(ES) compositors with wl_shm clients.
 struct wl_buffer::event::release {
     static constexpr Wopcode<wl_buffer> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 enum class wl_data_offer::error : Wint::integral_type {
@@ -937,10 +1732,14 @@ enum class wl_data_offer::error : Wint::integral_type {
 /// conjunction with wl_data_source.action for feedback.
 struct wl_data_offer::request::accept {
     static constexpr Wopcode<wl_data_offer> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the accept request
     Wuint serial;
     /// mime type accepted by the client
     Wstring mime_type;
+
+    using fields = message_fields<&wl_data_offer::request::accept::serial,
+                                  &wl_data_offer::request::accept::mime_type>;
 };
 
 /// request that the data is transferred
@@ -962,10 +1761,14 @@ struct wl_data_offer::request::accept {
 /// determine acceptance.
 struct wl_data_offer::request::receive {
     static constexpr Wopcode<wl_data_offer> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// mime type desired by receiver
     Wstring mime_type;
     /// file descriptor for data transfer
     Wfd fd;
+
+    using fields = message_fields<&wl_data_offer::request::receive::mime_type,
+                                  &wl_data_offer::request::receive::fd>;
 };
 
 /// destroy data offer
@@ -973,6 +1776,9 @@ struct wl_data_offer::request::receive {
 /// Destroy the data offer.
 struct wl_data_offer::request::destroy {
     static constexpr Wopcode<wl_data_offer> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// the offer will no longer be used
@@ -993,6 +1799,9 @@ struct wl_data_offer::request::destroy {
 /// operation, the invalid_finish protocol error is raised.
 struct wl_data_offer::request::finish {
     static constexpr Wopcode<wl_data_offer> opcode{ 3 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// set the available/preferred drag-and-drop actions
@@ -1030,10 +1839,14 @@ struct wl_data_offer::request::finish {
 /// will be raised otherwise.
 struct wl_data_offer::request::set_actions {
     static constexpr Wopcode<wl_data_offer> opcode{ 4 };
+    static constexpr protocol_version since{ 3 };
     /// actions supported by the destination client
     wl_data_device_manager::dnd_action dnd_actions;
     /// action preferred by the destination client
     wl_data_device_manager::dnd_action preferred_action;
+
+    using fields = message_fields<&wl_data_offer::request::set_actions::dnd_actions,
+                                  &wl_data_offer::request::set_actions::preferred_action>;
 };
 
 /// advertise offered mime type
@@ -1042,8 +1855,11 @@ struct wl_data_offer::request::set_actions {
 /// event per offered mime type.
 struct wl_data_offer::event::offer {
     static constexpr Wopcode<wl_data_offer> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// offered mime type
     Wstring mime_type;
+
+    using fields = message_fields<&wl_data_offer::event::offer::mime_type>;
 };
 
 /// notify the source-side available actions
@@ -1054,8 +1870,11 @@ struct wl_data_offer::event::offer {
 /// wl_data_source.set_actions.
 struct wl_data_offer::event::source_actions {
     static constexpr Wopcode<wl_data_offer> opcode{ 1 };
+    static constexpr protocol_version since{ 3 };
     /// actions offered by the data source
     wl_data_device_manager::dnd_action source_actions;
+
+    using fields = message_fields<&wl_data_offer::event::source_actions::source_actions>;
 };
 
 /// notify the selected action
@@ -1097,8 +1916,11 @@ struct wl_data_offer::event::source_actions {
 /// must happen before the call to wl_data_offer.finish.
 struct wl_data_offer::event::action {
     static constexpr Wopcode<wl_data_offer> opcode{ 2 };
+    static constexpr protocol_version since{ 3 };
     /// action selected by the compositor
     wl_data_device_manager::dnd_action dnd_action;
+
+    using fields = message_fields<&wl_data_offer::event::action::dnd_action>;
 };
 
 enum class wl_data_source::error : Wint::integral_type {
@@ -1115,8 +1937,11 @@ enum class wl_data_source::error : Wint::integral_type {
 /// multiple types.
 struct wl_data_source::request::offer {
     static constexpr Wopcode<wl_data_source> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// mime type offered by the data source
     Wstring mime_type;
+
+    using fields = message_fields<&wl_data_source::request::offer::mime_type>;
 };
 
 /// destroy the data source
@@ -1124,6 +1949,9 @@ struct wl_data_source::request::offer {
 /// Destroy the data source.
 struct wl_data_source::request::destroy {
     static constexpr Wopcode<wl_data_source> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the available drag-and-drop actions
@@ -1143,8 +1971,11 @@ struct wl_data_source::request::destroy {
 /// for drag-and-drop will raise a protocol error.
 struct wl_data_source::request::set_actions {
     static constexpr Wopcode<wl_data_source> opcode{ 2 };
+    static constexpr protocol_version since{ 3 };
     /// actions supported by the data source
     wl_data_device_manager::dnd_action dnd_actions;
+
+    using fields = message_fields<&wl_data_source::request::set_actions::dnd_actions>;
 };
 
 /// a target accepts an offered mime type
@@ -1155,8 +1986,11 @@ struct wl_data_source::request::set_actions {
 /// Used for feedback during drag-and-drop.
 struct wl_data_source::event::target {
     static constexpr Wopcode<wl_data_source> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// mime type accepted by the target
     Wstring mime_type;
+
+    using fields = message_fields<&wl_data_source::event::target::mime_type>;
 };
 
 /// send the data
@@ -1166,10 +2000,14 @@ struct wl_data_source::event::target {
 /// close it.
 struct wl_data_source::event::send {
     static constexpr Wopcode<wl_data_source> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// mime type for the data
     Wstring mime_type;
     /// file descriptor for the data
     Wfd fd;
+
+    using fields = message_fields<&wl_data_source::event::send::mime_type,
+                                  &wl_data_source::event::send::fd>;
 };
 
 /// selection was cancelled
@@ -1196,6 +2034,9 @@ struct wl_data_source::event::send {
 /// source.
 struct wl_data_source::event::cancelled {
     static constexpr Wopcode<wl_data_source> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// the drag-and-drop operation physically finished
@@ -1211,6 +2052,9 @@ struct wl_data_source::event::cancelled {
 /// not be destroyed here.
 struct wl_data_source::event::dnd_drop_performed {
     static constexpr Wopcode<wl_data_source> opcode{ 3 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// the drag-and-drop operation concluded
@@ -1223,6 +2067,9 @@ struct wl_data_source::event::dnd_drop_performed {
 /// source can now delete the transferred data.
 struct wl_data_source::event::dnd_finished {
     static constexpr Wopcode<wl_data_source> opcode{ 4 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// notify the selected action
@@ -1254,8 +2101,11 @@ struct wl_data_source::event::dnd_finished {
 /// they reflect the current action.
 struct wl_data_source::event::action {
     static constexpr Wopcode<wl_data_source> opcode{ 5 };
+    static constexpr protocol_version since{ 3 };
     /// action selected by the compositor
     wl_data_device_manager::dnd_action dnd_action;
+
+    using fields = message_fields<&wl_data_source::event::action::dnd_action>;
 };
 
 enum class wl_data_device::error : Wint::integral_type {
@@ -1298,6 +2148,7 @@ enum class wl_data_device::error : Wint::integral_type {
 /// may send a used_source error.
 struct wl_data_device::request::start_drag {
     static constexpr Wopcode<wl_data_device> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// data source for the eventual transfer
     Wobject<wl_data_source> source;
     /// surface where the drag originates
@@ -1306,6 +2157,11 @@ struct wl_data_device::request::start_drag {
     Wobject<wl_surface> icon;
     /// serial number of the implicit grab on the origin
     Wuint serial;
+
+    using fields = message_fields<&wl_data_device::request::start_drag::source,
+                                  &wl_data_device::request::start_drag::origin,
+                                  &wl_data_device::request::start_drag::icon,
+                                  &wl_data_device::request::start_drag::serial>;
 };
 
 /// copy data to the selection
@@ -1320,10 +2176,14 @@ struct wl_data_device::request::start_drag {
 /// may send a used_source error.
 struct wl_data_device::request::set_selection {
     static constexpr Wopcode<wl_data_device> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// data source for the selection
     Wobject<wl_data_source> source;
     /// serial number of the event that triggered this request
     Wuint serial;
+
+    using fields = message_fields<&wl_data_device::request::set_selection::source,
+                                  &wl_data_device::request::set_selection::serial>;
 };
 
 /// destroy data device
@@ -1331,6 +2191,9 @@ struct wl_data_device::request::set_selection {
 /// This request destroys the data device.
 struct wl_data_device::request::release {
     static constexpr Wopcode<wl_data_device> opcode{ 2 };
+    static constexpr protocol_version since{ 2 };
+
+    using fields = message_fields<>;
 };
 
 /// introduce a new wl_data_offer
@@ -1344,8 +2207,11 @@ struct wl_data_device::request::release {
 /// mime types it offers.
 struct wl_data_device::event::data_offer {
     static constexpr Wopcode<wl_data_device> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// the new data_offer object
     Wnew_id<wl_data_offer> id;
+
+    using fields = message_fields<&wl_data_device::event::data_offer::id>;
 };
 
 /// initiate drag-and-drop session
@@ -1356,6 +2222,7 @@ struct wl_data_device::event::data_offer {
 /// coordinates.
 struct wl_data_device::event::enter {
     static constexpr Wopcode<wl_data_device> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the enter event
     Wuint serial;
     /// client surface entered
@@ -1366,6 +2233,12 @@ struct wl_data_device::event::enter {
     Wfixed y;
     /// source data_offer object
     Wobject<wl_data_offer> id;
+
+    using fields = message_fields<&wl_data_device::event::enter::serial,
+                                  &wl_data_device::event::enter::surface,
+                                  &wl_data_device::event::enter::x,
+                                  &wl_data_device::event::enter::y,
+                                  &wl_data_device::event::enter::id>;
 };
 
 /// end drag-and-drop session
@@ -1375,6 +2248,9 @@ struct wl_data_device::event::enter {
 /// wl_data_offer introduced at enter time at this point.
 struct wl_data_device::event::leave {
     static constexpr Wopcode<wl_data_device> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// drag-and-drop session motion
@@ -1385,12 +2261,17 @@ struct wl_data_device::event::leave {
 /// coordinates.
 struct wl_data_device::event::motion {
     static constexpr Wopcode<wl_data_device> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// timestamp with millisecond granularity
     Wuint time;
     /// surface-local x coordinate
     Wfixed x;
     /// surface-local y coordinate
     Wfixed y;
+
+    using fields = message_fields<&wl_data_device::event::motion::time,
+                                  &wl_data_device::event::motion::x,
+                                  &wl_data_device::event::motion::y>;
 };
 
 /// end drag-and-drop session successfully
@@ -1410,6 +2291,9 @@ struct wl_data_device::event::motion {
 /// to cancel the operation.
 struct wl_data_device::event::drop {
     static constexpr Wopcode<wl_data_device> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// advertise new selection
@@ -1428,8 +2312,11 @@ struct wl_data_device::event::drop {
 /// data_offer, if any, upon receiving this event.
 struct wl_data_device::event::selection {
     static constexpr Wopcode<wl_data_device> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// selection data_offer object
     Wobject<wl_data_offer> id;
+
+    using fields = message_fields<&wl_data_device::event::selection::id>;
 };
 
 /// drag and drop actions
@@ -1473,8 +2360,11 @@ enum class wl_data_device_manager::dnd_action : Wuint::integral_type {
 /// Create a new data source.
 struct wl_data_device_manager::request::create_data_source {
     static constexpr Wopcode<wl_data_device_manager> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// data source to create
     Wnew_id<wl_data_source> id;
+
+    using fields = message_fields<&wl_data_device_manager::request::create_data_source::id>;
 };
 
 /// create a new data device
@@ -1482,10 +2372,14 @@ struct wl_data_device_manager::request::create_data_source {
 /// Create a new data device for a given seat.
 struct wl_data_device_manager::request::get_data_device {
     static constexpr Wopcode<wl_data_device_manager> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// data device to create
     Wnew_id<wl_data_device> id;
     /// seat associated with the data device
     Wobject<wl_seat> seat;
+
+    using fields = message_fields<&wl_data_device_manager::request::get_data_device::id,
+                                  &wl_data_device_manager::request::get_data_device::seat>;
 };
 
 enum class wl_shell::error : Wint::integral_type {
@@ -1502,10 +2396,14 @@ enum class wl_shell::error : Wint::integral_type {
 /// Only one shell surface can be associated with a given surface.
 struct wl_shell::request::get_shell_surface {
     static constexpr Wopcode<wl_shell> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// shell surface to create
     Wnew_id<wl_shell_surface> id;
     /// surface to be given the shell surface role
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&wl_shell::request::get_shell_surface::id,
+                                  &wl_shell::request::get_shell_surface::surface>;
 };
 
 /// edge values for resizing
@@ -1566,8 +2464,11 @@ enum class wl_shell_surface::fullscreen_method : Wint::integral_type {
 /// the client may be deemed unresponsive.
 struct wl_shell_surface::request::pong {
     static constexpr Wopcode<wl_shell_surface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the ping event
     Wuint serial;
+
+    using fields = message_fields<&wl_shell_surface::request::pong::serial>;
 };
 
 /// start an interactive move
@@ -1579,10 +2480,14 @@ struct wl_shell_surface::request::pong {
 /// the surface (e.g. fullscreen or maximized).
 struct wl_shell_surface::request::move {
     static constexpr Wopcode<wl_shell_surface> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// seat whose pointer is used
     Wobject<wl_seat> seat;
     /// serial number of the implicit grab on the pointer
     Wuint serial;
+
+    using fields = message_fields<&wl_shell_surface::request::move::seat,
+                                  &wl_shell_surface::request::move::serial>;
 };
 
 /// start an interactive resize
@@ -1594,12 +2499,17 @@ struct wl_shell_surface::request::move {
 /// the surface (e.g. fullscreen or maximized).
 struct wl_shell_surface::request::resize {
     static constexpr Wopcode<wl_shell_surface> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// seat whose pointer is used
     Wobject<wl_seat> seat;
     /// serial number of the implicit grab on the pointer
     Wuint serial;
     /// which edge or corner is being dragged
     wl_shell_surface::resize edges;
+
+    using fields = message_fields<&wl_shell_surface::request::resize::seat,
+                                  &wl_shell_surface::request::resize::serial,
+                                  &wl_shell_surface::request::resize::edges>;
 };
 
 /// make the surface a toplevel surface
@@ -1609,6 +2519,9 @@ struct wl_shell_surface::request::resize {
 /// A toplevel surface is not fullscreen, maximized or transient.
 struct wl_shell_surface::request::set_toplevel {
     static constexpr Wopcode<wl_shell_surface> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// make the surface a transient surface
@@ -1622,6 +2535,7 @@ struct wl_shell_surface::request::set_toplevel {
 /// The flags argument controls details of the transient behaviour.
 struct wl_shell_surface::request::set_transient {
     static constexpr Wopcode<wl_shell_surface> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// parent surface
     Wobject<wl_surface> parent;
     /// surface-local x coordinate
@@ -1630,6 +2544,11 @@ struct wl_shell_surface::request::set_transient {
     Wint y;
     /// transient surface behavior
     wl_shell_surface::transient flags;
+
+    using fields = message_fields<&wl_shell_surface::request::set_transient::parent,
+                                  &wl_shell_surface::request::set_transient::x,
+                                  &wl_shell_surface::request::set_transient::y,
+                                  &wl_shell_surface::request::set_transient::flags>;
 };
 
 /// make the surface a fullscreen surface
@@ -1669,12 +2588,17 @@ struct wl_shell_surface::request::set_transient {
 /// be made fullscreen.
 struct wl_shell_surface::request::set_fullscreen {
     static constexpr Wopcode<wl_shell_surface> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// method for resolving size conflict
     wl_shell_surface::fullscreen_method method;
     /// framerate in mHz
     Wuint framerate;
     /// output on which the surface is to be fullscreen
     Wobject<wl_output> output;
+
+    using fields = message_fields<&wl_shell_surface::request::set_fullscreen::method,
+                                  &wl_shell_surface::request::set_fullscreen::framerate,
+                                  &wl_shell_surface::request::set_fullscreen::output>;
 };
 
 /// make the surface a popup surface
@@ -1700,6 +2624,7 @@ struct wl_shell_surface::request::set_fullscreen {
 /// parent surface, in surface-local coordinates.
 struct wl_shell_surface::request::set_popup {
     static constexpr Wopcode<wl_shell_surface> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
     /// seat whose pointer is used
     Wobject<wl_seat> seat;
     /// serial number of the implicit grab on the pointer
@@ -1712,6 +2637,13 @@ struct wl_shell_surface::request::set_popup {
     Wint y;
     /// transient surface behavior
     wl_shell_surface::transient flags;
+
+    using fields = message_fields<&wl_shell_surface::request::set_popup::seat,
+                                  &wl_shell_surface::request::set_popup::serial,
+                                  &wl_shell_surface::request::set_popup::parent,
+                                  &wl_shell_surface::request::set_popup::x,
+                                  &wl_shell_surface::request::set_popup::y,
+                                  &wl_shell_surface::request::set_popup::flags>;
 };
 
 /// make the surface a maximized surface
@@ -1736,8 +2668,11 @@ struct wl_shell_surface::request::set_popup {
 /// The details depend on the compositor implementation.
 struct wl_shell_surface::request::set_maximized {
     static constexpr Wopcode<wl_shell_surface> opcode{ 7 };
+    static constexpr protocol_version since{ 1 };
     /// output on which the surface is to be maximized
     Wobject<wl_output> output;
+
+    using fields = message_fields<&wl_shell_surface::request::set_maximized::output>;
 };
 
 /// set surface title
@@ -1751,8 +2686,11 @@ struct wl_shell_surface::request::set_maximized {
 /// The string must be encoded in UTF-8.
 struct wl_shell_surface::request::set_title {
     static constexpr Wopcode<wl_shell_surface> opcode{ 8 };
+    static constexpr protocol_version since{ 1 };
     /// surface title
     Wstring title;
+
+    using fields = message_fields<&wl_shell_surface::request::set_title::title>;
 };
 
 /// set surface class
@@ -1765,8 +2703,11 @@ struct wl_shell_surface::request::set_title {
 /// the application's .desktop file as the class.
 struct wl_shell_surface::request::set_class {
     static constexpr Wopcode<wl_shell_surface> opcode{ 9 };
+    static constexpr protocol_version since{ 1 };
     /// surface class
     Wstring class_;
+
+    using fields = message_fields<&wl_shell_surface::request::set_class::class_>;
 };
 
 /// ping client
@@ -1775,8 +2716,11 @@ struct wl_shell_surface::request::set_class {
 /// requests. A client is expected to reply with a pong request.
 struct wl_shell_surface::event::ping {
     static constexpr Wopcode<wl_shell_surface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the ping
     Wuint serial;
+
+    using fields = message_fields<&wl_shell_surface::event::ping::serial>;
 };
 
 /// suggest resize
@@ -1800,12 +2744,17 @@ struct wl_shell_surface::event::ping {
 /// in surface-local coordinates.
 struct wl_shell_surface::event::configure {
     static constexpr Wopcode<wl_shell_surface> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// how the surface was resized
     wl_shell_surface::resize edges;
     /// new width of the surface
     Wint width;
     /// new height of the surface
     Wint height;
+
+    using fields = message_fields<&wl_shell_surface::event::configure::edges,
+                                  &wl_shell_surface::event::configure::width,
+                                  &wl_shell_surface::event::configure::height>;
 };
 
 /// popup interaction is done
@@ -1815,6 +2764,9 @@ struct wl_shell_surface::event::configure {
 /// to the client owning the popup surface.
 struct wl_shell_surface::event::popup_done {
     static constexpr Wopcode<wl_shell_surface> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// wl_surface error values
@@ -1838,6 +2790,9 @@ enum class wl_surface::error : Wint::integral_type {
 /// Deletes the surface and invalidates its object ID.
 struct wl_surface::request::destroy {
     static constexpr Wopcode<wl_surface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the surface contents
@@ -1908,12 +2863,17 @@ struct wl_surface::request::destroy {
 /// destroying buffers.
 struct wl_surface::request::attach {
     static constexpr Wopcode<wl_surface> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// buffer of surface contents
     Wobject<wl_buffer> buffer;
     /// surface-local x coordinate
     Wint x;
     /// surface-local y coordinate
     Wint y;
+
+    using fields = message_fields<&wl_surface::request::attach::buffer,
+                                  &wl_surface::request::attach::x,
+                                  &wl_surface::request::attach::y>;
 };
 
 /// mark part of the surface damaged
@@ -1941,6 +2901,7 @@ struct wl_surface::request::attach {
 /// instead of surface coordinates.
 struct wl_surface::request::damage {
     static constexpr Wopcode<wl_surface> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// surface-local x coordinate
     Wint x;
     /// surface-local y coordinate
@@ -1949,6 +2910,11 @@ struct wl_surface::request::damage {
     Wint width;
     /// height of damage rectangle
     Wint height;
+
+    using fields = message_fields<&wl_surface::request::damage::x,
+                                  &wl_surface::request::damage::y,
+                                  &wl_surface::request::damage::width,
+                                  &wl_surface::request::damage::height>;
 };
 
 /// request a frame throttling hint
@@ -1987,8 +2953,11 @@ struct wl_surface::request::damage {
 /// milliseconds, with an undefined base.
 struct wl_surface::request::frame {
     static constexpr Wopcode<wl_surface> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// callback object for the frame request
     Wnew_id<wl_callback> callback;
+
+    using fields = message_fields<&wl_surface::request::frame::callback>;
 };
 
 /// set opaque region
@@ -2019,8 +2988,11 @@ struct wl_surface::request::frame {
 /// region to be set to empty.
 struct wl_surface::request::set_opaque_region {
     static constexpr Wopcode<wl_surface> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// opaque region of the surface
     Wobject<wl_region> region;
+
+    using fields = message_fields<&wl_surface::request::set_opaque_region::region>;
 };
 
 /// set input region
@@ -2049,8 +3021,11 @@ struct wl_surface::request::set_opaque_region {
 /// to infinite.
 struct wl_surface::request::set_input_region {
     static constexpr Wopcode<wl_surface> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// input region of the surface
     Wobject<wl_region> region;
+
+    using fields = message_fields<&wl_surface::request::set_input_region::region>;
 };
 
 /// commit pending surface state
@@ -2076,6 +3051,9 @@ struct wl_surface::request::set_input_region {
 /// Other interfaces may add further double-buffered surface state.
 struct wl_surface::request::commit {
     static constexpr Wopcode<wl_surface> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// sets the buffer transformation
@@ -2113,8 +3091,11 @@ struct wl_surface::request::commit {
 /// is raised.
 struct wl_surface::request::set_buffer_transform {
     static constexpr Wopcode<wl_surface> opcode{ 7 };
+    static constexpr protocol_version since{ 2 };
     /// transform for interpreting buffer contents
     wl_output::transform transform;
+
+    using fields = message_fields<&wl_surface::request::set_buffer_transform::transform>;
 };
 
 /// sets the buffer scaling factor
@@ -2144,8 +3125,11 @@ struct wl_surface::request::set_buffer_transform {
 /// raised.
 struct wl_surface::request::set_buffer_scale {
     static constexpr Wopcode<wl_surface> opcode{ 8 };
+    static constexpr protocol_version since{ 3 };
     /// scale for interpreting buffer contents
     Wint scale;
+
+    using fields = message_fields<&wl_surface::request::set_buffer_scale::scale>;
 };
 
 /// mark part of the surface damaged using buffer coordinates
@@ -2184,6 +3168,7 @@ struct wl_surface::request::set_buffer_scale {
 /// after receiving the wl_surface.commit.
 struct wl_surface::request::damage_buffer {
     static constexpr Wopcode<wl_surface> opcode{ 9 };
+    static constexpr protocol_version since{ 4 };
     /// buffer-local x coordinate
     Wint x;
     /// buffer-local y coordinate
@@ -2192,6 +3177,11 @@ struct wl_surface::request::damage_buffer {
     Wint width;
     /// height of damage rectangle
     Wint height;
+
+    using fields = message_fields<&wl_surface::request::damage_buffer::x,
+                                  &wl_surface::request::damage_buffer::y,
+                                  &wl_surface::request::damage_buffer::width,
+                                  &wl_surface::request::damage_buffer::height>;
 };
 
 /// set the surface contents offset
@@ -2213,10 +3203,13 @@ struct wl_surface::request::damage_buffer {
 /// to 5. See wl_surface.attach for details.
 struct wl_surface::request::offset {
     static constexpr Wopcode<wl_surface> opcode{ 10 };
+    static constexpr protocol_version since{ 5 };
     /// surface-local x coordinate
     Wint x;
     /// surface-local y coordinate
     Wint y;
+
+    using fields = message_fields<&wl_surface::request::offset::x, &wl_surface::request::offset::y>;
 };
 
 /// surface enters an output
@@ -2228,8 +3221,11 @@ struct wl_surface::request::offset {
 /// Note that a surface may be overlapping with zero or more outputs.
 struct wl_surface::event::enter {
     static constexpr Wopcode<wl_surface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// output entered by the surface
     Wobject<wl_output> output;
+
+    using fields = message_fields<&wl_surface::event::enter::output>;
 };
 
 /// surface leaves an output
@@ -2245,8 +3241,11 @@ struct wl_surface::event::enter {
 /// used instead.
 struct wl_surface::event::leave {
     static constexpr Wopcode<wl_surface> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// output left by the surface
     Wobject<wl_output> output;
+
+    using fields = message_fields<&wl_surface::event::leave::output>;
 };
 
 /// preferred buffer scale for the surface
@@ -2265,8 +3264,11 @@ struct wl_surface::event::leave {
 /// The compositor shall emit a scale value greater than 0.
 struct wl_surface::event::preferred_buffer_scale {
     static constexpr Wopcode<wl_surface> opcode{ 2 };
+    static constexpr protocol_version since{ 6 };
     /// preferred scaling factor
     Wint factor;
+
+    using fields = message_fields<&wl_surface::event::preferred_buffer_scale::factor>;
 };
 
 /// preferred buffer transform for the surface
@@ -2282,8 +3284,11 @@ struct wl_surface::event::preferred_buffer_scale {
 /// surface buffer more efficiently.
 struct wl_surface::event::preferred_buffer_transform {
     static constexpr Wopcode<wl_surface> opcode{ 3 };
+    static constexpr protocol_version since{ 6 };
     /// preferred transform
     wl_output::transform transform;
+
+    using fields = message_fields<&wl_surface::event::preferred_buffer_transform::transform>;
 };
 
 /// seat capability bitmask
@@ -2319,8 +3324,11 @@ enum class wl_seat::error : Wint::integral_type {
 /// be sent in this case.
 struct wl_seat::request::get_pointer {
     static constexpr Wopcode<wl_seat> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// seat pointer
     Wnew_id<wl_pointer> id;
+
+    using fields = message_fields<&wl_seat::request::get_pointer::id>;
 };
 
 /// return keyboard object
@@ -2335,8 +3343,11 @@ struct wl_seat::request::get_pointer {
 /// be sent in this case.
 struct wl_seat::request::get_keyboard {
     static constexpr Wopcode<wl_seat> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// seat keyboard
     Wnew_id<wl_keyboard> id;
+
+    using fields = message_fields<&wl_seat::request::get_keyboard::id>;
 };
 
 /// return touch object
@@ -2351,8 +3362,11 @@ struct wl_seat::request::get_keyboard {
 /// be sent in this case.
 struct wl_seat::request::get_touch {
     static constexpr Wopcode<wl_seat> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// seat touch interface
     Wnew_id<wl_touch> id;
+
+    using fields = message_fields<&wl_seat::request::get_touch::id>;
 };
 
 /// release the seat object
@@ -2361,6 +3375,9 @@ struct wl_seat::request::get_touch {
 /// use the seat object anymore.
 struct wl_seat::request::release {
     static constexpr Wopcode<wl_seat> opcode{ 3 };
+    static constexpr protocol_version since{ 5 };
+
+    using fields = message_fields<>;
 };
 
 /// seat capabilities changed
@@ -2391,8 +3408,11 @@ struct wl_seat::request::release {
 /// keyboard and touch capabilities, respectively.
 struct wl_seat::event::capabilities {
     static constexpr Wopcode<wl_seat> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// capabilities of the seat
     wl_seat::capability capabilities;
+
+    using fields = message_fields<&wl_seat::event::capabilities::capabilities>;
 };
 
 /// unique identifier for this seat
@@ -2415,8 +3435,11 @@ struct wl_seat::event::capabilities {
 /// destroyed and re-created later.
 struct wl_seat::event::name {
     static constexpr Wopcode<wl_seat> opcode{ 1 };
+    static constexpr protocol_version since{ 2 };
     /// seat identifier
     Wstring name;
+
+    using fields = message_fields<&wl_seat::event::name::name>;
 };
 
 enum class wl_pointer::error : Wint::integral_type {
@@ -2522,6 +3545,7 @@ enum class wl_pointer::axis_relative_direction : Wint::integral_type {
 /// ignored.
 struct wl_pointer::request::set_cursor {
     static constexpr Wopcode<wl_pointer> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the enter event
     Wuint serial;
     /// pointer surface
@@ -2530,6 +3554,11 @@ struct wl_pointer::request::set_cursor {
     Wint hotspot_x;
     /// surface-local y coordinate
     Wint hotspot_y;
+
+    using fields = message_fields<&wl_pointer::request::set_cursor::serial,
+                                  &wl_pointer::request::set_cursor::surface,
+                                  &wl_pointer::request::set_cursor::hotspot_x,
+                                  &wl_pointer::request::set_cursor::hotspot_y>;
 };
 
 /// release the pointer object
@@ -2541,6 +3570,9 @@ struct wl_pointer::request::set_cursor {
 /// wl_pointer_destroy() after using this request.
 struct wl_pointer::request::release {
     static constexpr Wopcode<wl_pointer> opcode{ 1 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// enter event
@@ -2553,6 +3585,7 @@ struct wl_pointer::request::release {
 /// an appropriate pointer image with the set_cursor request.
 struct wl_pointer::event::enter {
     static constexpr Wopcode<wl_pointer> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the enter event
     Wuint serial;
     /// surface entered by the pointer
@@ -2561,6 +3594,11 @@ struct wl_pointer::event::enter {
     Wfixed surface_x;
     /// surface-local y coordinate
     Wfixed surface_y;
+
+    using fields = message_fields<&wl_pointer::event::enter::serial,
+                                  &wl_pointer::event::enter::surface,
+                                  &wl_pointer::event::enter::surface_x,
+                                  &wl_pointer::event::enter::surface_y>;
 };
 
 /// leave event
@@ -2572,10 +3610,14 @@ struct wl_pointer::event::enter {
 /// for the new focus.
 struct wl_pointer::event::leave {
     static constexpr Wopcode<wl_pointer> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the leave event
     Wuint serial;
     /// surface left by the pointer
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&wl_pointer::event::leave::serial,
+                                  &wl_pointer::event::leave::surface>;
 };
 
 /// pointer motion event
@@ -2585,12 +3627,17 @@ struct wl_pointer::event::leave {
 /// focused surface.
 struct wl_pointer::event::motion {
     static constexpr Wopcode<wl_pointer> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// timestamp with millisecond granularity
     Wuint time;
     /// surface-local x coordinate
     Wfixed surface_x;
     /// surface-local y coordinate
     Wfixed surface_y;
+
+    using fields = message_fields<&wl_pointer::event::motion::time,
+                                  &wl_pointer::event::motion::surface_x,
+                                  &wl_pointer::event::motion::surface_y>;
 };
 
 /// pointer button event
@@ -2611,6 +3658,7 @@ struct wl_pointer::event::motion {
 /// protocol.
 struct wl_pointer::event::button {
     static constexpr Wopcode<wl_pointer> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the button event
     Wuint serial;
     /// timestamp with millisecond granularity
@@ -2619,6 +3667,11 @@ struct wl_pointer::event::button {
     Wuint button;
     /// physical state of the button
     wl_pointer::button_state state;
+
+    using fields = message_fields<&wl_pointer::event::button::serial,
+                                  &wl_pointer::event::button::time,
+                                  &wl_pointer::event::button::button,
+                                  &wl_pointer::event::button::state>;
 };
 
 /// axis event
@@ -2641,12 +3694,17 @@ struct wl_pointer::event::button {
 /// scroll distance.
 struct wl_pointer::event::axis {
     static constexpr Wopcode<wl_pointer> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// timestamp with millisecond granularity
     Wuint time;
     /// axis type
     wl_pointer::axis axis;
     /// length of vector in surface-local coordinate space
     Wfixed value;
+
+    using fields = message_fields<&wl_pointer::event::axis::time,
+                                  &wl_pointer::event::axis::axis,
+                                  &wl_pointer::event::axis::value>;
 };
 
 /// end of a pointer event sequence
@@ -2687,6 +3745,9 @@ struct wl_pointer::event::axis {
 /// groups.
 struct wl_pointer::event::frame {
     static constexpr Wopcode<wl_pointer> opcode{ 5 };
+    static constexpr protocol_version since{ 5 };
+
+    using fields = message_fields<>;
 };
 
 /// axis source event
@@ -2718,8 +3779,11 @@ struct wl_pointer::event::frame {
 /// not guaranteed.
 struct wl_pointer::event::axis_source {
     static constexpr Wopcode<wl_pointer> opcode{ 6 };
+    static constexpr protocol_version since{ 5 };
     /// source of the axis event
     wl_pointer::axis_source axis_source;
+
+    using fields = message_fields<&wl_pointer::event::axis_source::axis_source>;
 };
 
 /// axis stop event
@@ -2740,10 +3804,14 @@ struct wl_pointer::event::axis_source {
 /// preceding wl_pointer.axis event.
 struct wl_pointer::event::axis_stop {
     static constexpr Wopcode<wl_pointer> opcode{ 7 };
+    static constexpr protocol_version since{ 5 };
     /// timestamp with millisecond granularity
     Wuint time;
     /// the axis stopped with this event
     wl_pointer::axis axis;
+
+    using fields = message_fields<&wl_pointer::event::axis_stop::time,
+                                  &wl_pointer::event::axis_stop::axis>;
 };
 
 /// axis click event
@@ -2780,10 +3848,15 @@ struct wl_pointer::event::axis_stop {
 /// not guaranteed.
 struct wl_pointer::event::axis_discrete {
     static constexpr Wopcode<wl_pointer> opcode{ 8 };
+    static constexpr protocol_version since{ 5 };
+    static constexpr protocol_version deprecated_since{ 8 };
     /// axis type
     wl_pointer::axis axis;
     /// number of steps
     Wint discrete;
+
+    using fields = message_fields<&wl_pointer::event::axis_discrete::axis,
+                                  &wl_pointer::event::axis_discrete::discrete>;
 };
 
 /// axis high-resolution scroll event
@@ -2811,10 +3884,14 @@ struct wl_pointer::event::axis_discrete {
 /// not guaranteed.
 struct wl_pointer::event::axis_value120 {
     static constexpr Wopcode<wl_pointer> opcode{ 9 };
+    static constexpr protocol_version since{ 8 };
     /// axis type
     wl_pointer::axis axis;
     /// scroll distance as fraction of 120
     Wint value120;
+
+    using fields = message_fields<&wl_pointer::event::axis_value120::axis,
+                                  &wl_pointer::event::axis_value120::value120>;
 };
 
 /// axis relative physical direction event
@@ -2856,10 +3933,14 @@ struct wl_pointer::event::axis_value120 {
 /// guaranteed.
 struct wl_pointer::event::axis_relative_direction {
     static constexpr Wopcode<wl_pointer> opcode{ 10 };
+    static constexpr protocol_version since{ 9 };
     /// axis type
     wl_pointer::axis axis;
     /// physical direction relative to axis motion
     wl_pointer::axis_relative_direction direction;
+
+    using fields = message_fields<&wl_pointer::event::axis_relative_direction::axis,
+                                  &wl_pointer::event::axis_relative_direction::direction>;
 };
 
 /// keyboard mapping format
@@ -2896,6 +3977,9 @@ enum class wl_keyboard::key_state : Wint::integral_type {
 /// release the keyboard object
 struct wl_keyboard::request::release {
     static constexpr Wopcode<wl_keyboard> opcode{ 0 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// keyboard mapping
@@ -2908,12 +3992,17 @@ struct wl_keyboard::request::release {
 /// the recipient, as MAP_SHARED may fail.
 struct wl_keyboard::event::keymap {
     static constexpr Wopcode<wl_keyboard> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// keymap format
     wl_keyboard::keymap_format format;
     /// keymap file descriptor
     Wfd fd;
     /// keymap size, in bytes
     Wuint size;
+
+    using fields = message_fields<&wl_keyboard::event::keymap::format,
+                                  &wl_keyboard::event::keymap::fd,
+                                  &wl_keyboard::event::keymap::size>;
 };
 
 /// enter event
@@ -2933,12 +4022,17 @@ struct wl_keyboard::event::keymap {
 /// events. The order of keys in the list is unspecified.
 struct wl_keyboard::event::enter {
     static constexpr Wopcode<wl_keyboard> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the enter event
     Wuint serial;
     /// surface gaining keyboard focus
     Wobject<wl_surface> surface;
     /// the keys currently logically down
     Warray keys;
+
+    using fields = message_fields<&wl_keyboard::event::enter::serial,
+                                  &wl_keyboard::event::enter::surface,
+                                  &wl_keyboard::event::enter::keys>;
 };
 
 /// leave event
@@ -2955,10 +4049,14 @@ struct wl_keyboard::event::enter {
 /// before this event.
 struct wl_keyboard::event::leave {
     static constexpr Wopcode<wl_keyboard> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the leave event
     Wuint serial;
     /// surface that lost keyboard focus
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&wl_keyboard::event::leave::serial,
+                                  &wl_keyboard::event::leave::surface>;
 };
 
 /// key event
@@ -2988,6 +4086,7 @@ struct wl_keyboard::event::leave {
 /// responsibility of key repetition.
 struct wl_keyboard::event::key {
     static constexpr Wopcode<wl_keyboard> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the key event
     Wuint serial;
     /// timestamp with millisecond granularity
@@ -2996,6 +4095,11 @@ struct wl_keyboard::event::key {
     Wuint key;
     /// physical state of the key
     wl_keyboard::key_state state;
+
+    using fields = message_fields<&wl_keyboard::event::key::serial,
+                                  &wl_keyboard::event::key::time,
+                                  &wl_keyboard::event::key::key,
+                                  &wl_keyboard::event::key::state>;
 };
 
 /// modifier and group state
@@ -3015,6 +4119,7 @@ struct wl_keyboard::event::key {
 /// group.
 struct wl_keyboard::event::modifiers {
     static constexpr Wopcode<wl_keyboard> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the modifiers event
     Wuint serial;
     /// depressed modifiers
@@ -3025,6 +4130,12 @@ struct wl_keyboard::event::modifiers {
     Wuint mods_locked;
     /// keyboard layout
     Wuint group;
+
+    using fields = message_fields<&wl_keyboard::event::modifiers::serial,
+                                  &wl_keyboard::event::modifiers::mods_depressed,
+                                  &wl_keyboard::event::modifiers::mods_latched,
+                                  &wl_keyboard::event::modifiers::mods_locked,
+                                  &wl_keyboard::event::modifiers::group>;
 };
 
 /// repeat rate and delay
@@ -3043,15 +4154,22 @@ struct wl_keyboard::event::modifiers {
 /// of wl_keyboard.
 struct wl_keyboard::event::repeat_info {
     static constexpr Wopcode<wl_keyboard> opcode{ 5 };
+    static constexpr protocol_version since{ 4 };
     /// the rate of repeating keys in characters per second
     Wint rate;
     /// delay in milliseconds since key down until repeating starts
     Wint delay;
+
+    using fields = message_fields<&wl_keyboard::event::repeat_info::rate,
+                                  &wl_keyboard::event::repeat_info::delay>;
 };
 
 /// release the touch object
 struct wl_touch::request::release {
     static constexpr Wopcode<wl_touch> opcode{ 0 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// touch down event and beginning of a touch sequence
@@ -3062,6 +4180,7 @@ struct wl_touch::request::release {
 /// reused in the future.
 struct wl_touch::event::down {
     static constexpr Wopcode<wl_touch> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the touch down event
     Wuint serial;
     /// timestamp with millisecond granularity
@@ -3074,6 +4193,13 @@ struct wl_touch::event::down {
     Wfixed x;
     /// surface-local y coordinate
     Wfixed y;
+
+    using fields = message_fields<&wl_touch::event::down::serial,
+                                  &wl_touch::event::down::time,
+                                  &wl_touch::event::down::surface,
+                                  &wl_touch::event::down::id,
+                                  &wl_touch::event::down::x,
+                                  &wl_touch::event::down::y>;
 };
 
 /// end of a touch event sequence
@@ -3083,12 +4209,17 @@ struct wl_touch::event::down {
 /// reused in a future touch down event.
 struct wl_touch::event::up {
     static constexpr Wopcode<wl_touch> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// serial number of the touch up event
     Wuint serial;
     /// timestamp with millisecond granularity
     Wuint time;
     /// the unique ID of this touch point
     Wint id;
+
+    using fields = message_fields<&wl_touch::event::up::serial,
+                                  &wl_touch::event::up::time,
+                                  &wl_touch::event::up::id>;
 };
 
 /// update of touch point coordinates
@@ -3096,6 +4227,7 @@ struct wl_touch::event::up {
 /// A touch point has changed coordinates.
 struct wl_touch::event::motion {
     static constexpr Wopcode<wl_touch> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// timestamp with millisecond granularity
     Wuint time;
     /// the unique ID of this touch point
@@ -3104,6 +4236,11 @@ struct wl_touch::event::motion {
     Wfixed x;
     /// surface-local y coordinate
     Wfixed y;
+
+    using fields = message_fields<&wl_touch::event::motion::time,
+                                  &wl_touch::event::motion::id,
+                                  &wl_touch::event::motion::x,
+                                  &wl_touch::event::motion::y>;
 };
 
 /// end of touch frame event
@@ -3118,6 +4255,9 @@ struct wl_touch::event::motion {
 /// previously known state.
 struct wl_touch::event::frame {
     static constexpr Wopcode<wl_touch> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// touch session cancelled
@@ -3132,6 +4272,9 @@ struct wl_touch::event::frame {
 /// No frame event is required after the cancel event.
 struct wl_touch::event::cancel {
     static constexpr Wopcode<wl_touch> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// update shape of touch point
@@ -3163,12 +4306,17 @@ struct wl_touch::event::cancel {
 /// shape if it did not receive this event.
 struct wl_touch::event::shape {
     static constexpr Wopcode<wl_touch> opcode{ 5 };
+    static constexpr protocol_version since{ 6 };
     /// the unique ID of this touch point
     Wint id;
     /// length of the major axis in surface-local coordinates
     Wfixed major;
     /// length of the minor axis in surface-local coordinates
     Wfixed minor;
+
+    using fields = message_fields<&wl_touch::event::shape::id,
+                                  &wl_touch::event::shape::major,
+                                  &wl_touch::event::shape::minor>;
 };
 
 /// update orientation of touch point
@@ -3198,10 +4346,14 @@ struct wl_touch::event::shape {
 /// orientation reports.
 struct wl_touch::event::orientation {
     static constexpr Wopcode<wl_touch> opcode{ 6 };
+    static constexpr protocol_version since{ 6 };
     /// the unique ID of this touch point
     Wint id;
     /// angle between major axis and positive surface y-axis in degrees
     Wfixed orientation;
+
+    using fields = message_fields<&wl_touch::event::orientation::id,
+                                  &wl_touch::event::orientation::orientation>;
 };
 
 /// subpixel geometry information
@@ -3271,6 +4423,9 @@ enum class wl_output::mode : Wuint::integral_type {
 /// use the output object anymore.
 struct wl_output::request::release {
     static constexpr Wopcode<wl_output> opcode{ 0 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 /// properties of the output
@@ -3297,6 +4452,7 @@ struct wl_output::request::release {
 /// clients should use name and description.
 struct wl_output::event::geometry {
     static constexpr Wopcode<wl_output> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// x position within the global compositor space
     Wint x;
     /// y position within the global compositor space
@@ -3313,6 +4469,15 @@ struct wl_output::event::geometry {
     Wstring model;
     /// additional transformation applied to buffer contents during presentation
     wl_output::transform transform;
+
+    using fields = message_fields<&wl_output::event::geometry::x,
+                                  &wl_output::event::geometry::y,
+                                  &wl_output::event::geometry::physical_width,
+                                  &wl_output::event::geometry::physical_height,
+                                  &wl_output::event::geometry::subpixel,
+                                  &wl_output::event::geometry::make,
+                                  &wl_output::event::geometry::model,
+                                  &wl_output::event::geometry::transform>;
 };
 
 /// advertise available modes for the output
@@ -3352,6 +4517,7 @@ struct wl_output::event::geometry {
 /// refresh rate or the size.
 struct wl_output::event::mode {
     static constexpr Wopcode<wl_output> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// bitfield of mode flags
     wl_output::mode flags;
     /// width of the mode in hardware units
@@ -3360,6 +4526,11 @@ struct wl_output::event::mode {
     Wint height;
     /// vertical refresh rate in mHz
     Wint refresh;
+
+    using fields = message_fields<&wl_output::event::mode::flags,
+                                  &wl_output::event::mode::width,
+                                  &wl_output::event::mode::height,
+                                  &wl_output::event::mode::refresh>;
 };
 
 /// sent all information about output
@@ -3371,6 +4542,9 @@ struct wl_output::event::mode {
 /// atomic, even if they happen via multiple events.
 struct wl_output::event::done {
     static constexpr Wopcode<wl_output> opcode{ 2 };
+    static constexpr protocol_version since{ 2 };
+
+    using fields = message_fields<>;
 };
 
 /// output scaling properties
@@ -3395,8 +4569,11 @@ struct wl_output::event::done {
 /// The scale event will be followed by a done event.
 struct wl_output::event::scale {
     static constexpr Wopcode<wl_output> opcode{ 3 };
+    static constexpr protocol_version since{ 2 };
     /// scaling factor of output
     Wint factor;
+
+    using fields = message_fields<&wl_output::event::scale::factor>;
 };
 
 /// name of this output
@@ -3431,8 +4608,11 @@ struct wl_output::event::scale {
 /// The name event will be followed by a done event.
 struct wl_output::event::name {
     static constexpr Wopcode<wl_output> opcode{ 4 };
+    static constexpr protocol_version since{ 4 };
     /// output name
     Wstring name;
+
+    using fields = message_fields<&wl_output::event::name::name>;
 };
 
 /// human-readable description of this output
@@ -3453,8 +4633,11 @@ struct wl_output::event::name {
 /// The description event will be followed by a done event.
 struct wl_output::event::description {
     static constexpr Wopcode<wl_output> opcode{ 5 };
+    static constexpr protocol_version since{ 4 };
     /// output description
     Wstring description;
+
+    using fields = message_fields<&wl_output::event::description::description>;
 };
 
 /// destroy region
@@ -3462,6 +4645,9 @@ struct wl_output::event::description {
 /// Destroy the region.  This will invalidate the object ID.
 struct wl_region::request::destroy {
     static constexpr Wopcode<wl_region> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// add rectangle to region
@@ -3469,6 +4655,7 @@ struct wl_region::request::destroy {
 /// Add the specified rectangle to the region.
 struct wl_region::request::add {
     static constexpr Wopcode<wl_region> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// region-local x coordinate
     Wint x;
     /// region-local y coordinate
@@ -3477,6 +4664,11 @@ struct wl_region::request::add {
     Wint width;
     /// rectangle height
     Wint height;
+
+    using fields = message_fields<&wl_region::request::add::x,
+                                  &wl_region::request::add::y,
+                                  &wl_region::request::add::width,
+                                  &wl_region::request::add::height>;
 };
 
 /// subtract rectangle from region
@@ -3484,6 +4676,7 @@ struct wl_region::request::add {
 /// Subtract the specified rectangle from the region.
 struct wl_region::request::subtract {
     static constexpr Wopcode<wl_region> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// region-local x coordinate
     Wint x;
     /// region-local y coordinate
@@ -3492,6 +4685,11 @@ struct wl_region::request::subtract {
     Wint width;
     /// rectangle height
     Wint height;
+
+    using fields = message_fields<&wl_region::request::subtract::x,
+                                  &wl_region::request::subtract::y,
+                                  &wl_region::request::subtract::width,
+                                  &wl_region::request::subtract::height>;
 };
 
 enum class wl_subcompositor::error : Wint::integral_type {
@@ -3508,6 +4706,9 @@ enum class wl_subcompositor::error : Wint::integral_type {
 /// objects, wl_subsurface objects included.
 struct wl_subcompositor::request::destroy {
     static constexpr Wopcode<wl_subcompositor> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// give a surface the role sub-surface
@@ -3533,12 +4734,17 @@ struct wl_subcompositor::request::destroy {
 /// the sub-surface, see the documentation on wl_subsurface interface.
 struct wl_subcompositor::request::get_subsurface {
     static constexpr Wopcode<wl_subcompositor> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the new sub-surface object ID
     Wnew_id<wl_subsurface> id;
     /// the surface to be turned into a sub-surface
     Wobject<wl_surface> surface;
     /// the parent surface
     Wobject<wl_surface> parent;
+
+    using fields = message_fields<&wl_subcompositor::request::get_subsurface::id,
+                                  &wl_subcompositor::request::get_subsurface::surface,
+                                  &wl_subcompositor::request::get_subsurface::parent>;
 };
 
 enum class wl_subsurface::error : Wint::integral_type {
@@ -3554,6 +4760,9 @@ enum class wl_subsurface::error : Wint::integral_type {
 /// to the parent is deleted. The wl_surface is unmapped immediately.
 struct wl_subsurface::request::destroy {
     static constexpr Wopcode<wl_subsurface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// reposition the sub-surface
@@ -3574,10 +4783,14 @@ struct wl_subsurface::request::destroy {
 /// The initial position is 0, 0.
 struct wl_subsurface::request::set_position {
     static constexpr Wopcode<wl_subsurface> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// x coordinate in the parent surface
     Wint x;
     /// y coordinate in the parent surface
     Wint y;
+
+    using fields = message_fields<&wl_subsurface::request::set_position::x,
+                                  &wl_subsurface::request::set_position::y>;
 };
 
 /// restack the sub-surface
@@ -3597,8 +4810,11 @@ struct wl_subsurface::request::set_position {
 /// of its siblings and parent.
 struct wl_subsurface::request::place_above {
     static constexpr Wopcode<wl_subsurface> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// the reference surface
     Wobject<wl_surface> sibling;
+
+    using fields = message_fields<&wl_subsurface::request::place_above::sibling>;
 };
 
 /// restack the sub-surface
@@ -3607,8 +4823,11 @@ struct wl_subsurface::request::place_above {
 /// See wl_subsurface.place_above.
 struct wl_subsurface::request::place_below {
     static constexpr Wopcode<wl_subsurface> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// the reference surface
     Wobject<wl_surface> sibling;
+
+    using fields = message_fields<&wl_subsurface::request::place_below::sibling>;
 };
 
 /// set sub-surface to synchronized mode
@@ -3628,6 +4847,9 @@ struct wl_subsurface::request::place_below {
 /// See wl_subsurface for the recursive effect of this mode.
 struct wl_subsurface::request::set_sync {
     static constexpr Wopcode<wl_subsurface> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set sub-surface to desynchronized mode
@@ -3653,11 +4875,17 @@ struct wl_subsurface::request::set_sync {
 /// the cached state is applied on set_desync.
 struct wl_subsurface::request::set_desync {
     static constexpr Wopcode<wl_subsurface> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// destroys this object
 struct wl_fixes::request::destroy {
     static constexpr Wopcode<wl_fixes> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// destroy a wl_registry
@@ -3673,10 +4901,620 @@ struct wl_fixes::request::destroy {
 /// wl_display.delete_id event.
 struct wl_fixes::request::destroy_registry {
     static constexpr Wopcode<wl_fixes> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the registry to destroy
     Wobject<wl_registry> registry;
+
+    using fields = message_fields<&wl_fixes::request::destroy_registry::registry>;
+};
+
+/// Metadata of the interfaces of the protocol, see interface_info.
+inline constexpr auto wayland_interfaces = std::array{
+    interface_info_of<wl_display>,
+    interface_info_of<wl_registry>,
+    interface_info_of<wl_callback>,
+    interface_info_of<wl_compositor>,
+    interface_info_of<wl_shm_pool>,
+    interface_info_of<wl_shm>,
+    interface_info_of<wl_buffer>,
+    interface_info_of<wl_data_offer>,
+    interface_info_of<wl_data_source>,
+    interface_info_of<wl_data_device>,
+    interface_info_of<wl_data_device_manager>,
+    interface_info_of<wl_shell>,
+    interface_info_of<wl_shell_surface>,
+    interface_info_of<wl_surface>,
+    interface_info_of<wl_seat>,
+    interface_info_of<wl_pointer>,
+    interface_info_of<wl_keyboard>,
+    interface_info_of<wl_touch>,
+    interface_info_of<wl_output>,
+    interface_info_of<wl_region>,
+    interface_info_of<wl_subcompositor>,
+    interface_info_of<wl_subsurface>,
+    interface_info_of<wl_fixes>,
 };
 
 } // namespace protocols
 } // namespace wl
 } // namespace waylander
+
+#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS
+// Instantiated in the library, see meson option explicit_instantiations.
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+
+namespace waylander {
+namespace wl {
+
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_display>,
+                                    const protocols::wl_display::request::sync&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_display>,
+                                    const protocols::wl_display::request::get_registry&);
+extern template auto
+decode_message_payload<protocols::wl_display::event::error, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_display::event::error;
+extern template auto
+decode_message_payload<protocols::wl_display::event::error, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_display::event::error;
+extern template auto
+decode_message_payload<protocols::wl_display::event::delete_id, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_display::event::delete_id;
+extern template auto
+decode_message_payload<protocols::wl_display::event::delete_id, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_display::event::delete_id;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_registry>,
+                                    const protocols::wl_registry::request::bind&);
+extern template auto
+decode_message_payload<protocols::wl_registry::event::global, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global;
+extern template auto
+decode_message_payload<protocols::wl_registry::event::global, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global;
+extern template auto
+decode_message_payload<protocols::wl_registry::event::global_remove, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global_remove;
+extern template auto
+decode_message_payload<protocols::wl_registry::event::global_remove, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global_remove;
+extern template auto
+decode_message_payload<protocols::wl_callback::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_callback::event::done;
+extern template auto
+decode_message_payload<protocols::wl_callback::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_callback::event::done;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_compositor>,
+                                    const protocols::wl_compositor::request::create_surface&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_compositor>,
+                                    const protocols::wl_compositor::request::create_region&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shm_pool>,
+                                    const protocols::wl_shm_pool::request::create_buffer&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shm_pool>,
+                                    const protocols::wl_shm_pool::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shm_pool>,
+                                    const protocols::wl_shm_pool::request::resize&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shm>,
+                                    const protocols::wl_shm::request::create_pool&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shm>,
+                                    const protocols::wl_shm::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_shm::event::format, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shm::event::format;
+extern template auto
+decode_message_payload<protocols::wl_shm::event::format, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shm::event::format;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_buffer>,
+                                    const protocols::wl_buffer::request::destroy&);
+extern template auto
+decode_message_payload<protocols::wl_buffer::event::release, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_buffer::event::release;
+extern template auto
+decode_message_payload<protocols::wl_buffer::event::release, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_buffer::event::release;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_offer>,
+                                    const protocols::wl_data_offer::request::accept&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_offer>,
+                                    const protocols::wl_data_offer::request::receive&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_offer>,
+                                    const protocols::wl_data_offer::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_offer>,
+                                    const protocols::wl_data_offer::request::finish&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_offer>,
+                                    const protocols::wl_data_offer::request::set_actions&);
+extern template auto
+decode_message_payload<protocols::wl_data_offer::event::offer, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::offer;
+extern template auto
+decode_message_payload<protocols::wl_data_offer::event::offer, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::offer;
+extern template auto
+decode_message_payload<protocols::wl_data_offer::event::source_actions, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::source_actions;
+extern template auto
+decode_message_payload<protocols::wl_data_offer::event::source_actions, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::source_actions;
+extern template auto
+decode_message_payload<protocols::wl_data_offer::event::action, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::action;
+extern template auto
+decode_message_payload<protocols::wl_data_offer::event::action, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::action;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_source>,
+                                    const protocols::wl_data_source::request::offer&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_source>,
+                                    const protocols::wl_data_source::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_source>,
+                                    const protocols::wl_data_source::request::set_actions&);
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::target, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::target;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::target, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::target;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::cancelled, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::cancelled;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::cancelled, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::cancelled;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_drop_performed,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_data_source::event::dnd_drop_performed;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_drop_performed,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_data_source::event::dnd_drop_performed;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_finished, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::dnd_finished;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_finished, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::dnd_finished;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::action, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::action;
+extern template auto
+decode_message_payload<protocols::wl_data_source::event::action, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::action;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_device>,
+                                    const protocols::wl_data_device::request::start_drag&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_device>,
+                                    const protocols::wl_data_device::request::set_selection&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_data_device>,
+                                    const protocols::wl_data_device::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::data_offer, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::data_offer;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::data_offer, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::data_offer;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::motion;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::motion;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::drop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::drop;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::drop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::drop;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::selection, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::selection;
+extern template auto
+decode_message_payload<protocols::wl_data_device::event::selection, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::selection;
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::wl_data_device_manager>,
+               const protocols::wl_data_device_manager::request::create_data_source&);
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::wl_data_device_manager>,
+               const protocols::wl_data_device_manager::request::get_data_device&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell>,
+                                    const protocols::wl_shell::request::get_shell_surface&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::pong&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::move&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::resize&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_toplevel&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_transient&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_fullscreen&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_popup&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_maximized&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_title&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_shell_surface>,
+                                    const protocols::wl_shell_surface::request::set_class&);
+extern template auto
+decode_message_payload<protocols::wl_shell_surface::event::ping, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::ping;
+extern template auto
+decode_message_payload<protocols::wl_shell_surface::event::ping, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::ping;
+extern template auto
+decode_message_payload<protocols::wl_shell_surface::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::configure;
+extern template auto
+decode_message_payload<protocols::wl_shell_surface::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::configure;
+extern template auto
+decode_message_payload<protocols::wl_shell_surface::event::popup_done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::popup_done;
+extern template auto
+decode_message_payload<protocols::wl_shell_surface::event::popup_done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::popup_done;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::attach&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::damage&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::frame&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::set_opaque_region&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::set_input_region&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::commit&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::set_buffer_transform&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::set_buffer_scale&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::damage_buffer&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_surface>,
+                                    const protocols::wl_surface::request::offset&);
+extern template auto
+decode_message_payload<protocols::wl_surface::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_scale,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_scale;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_scale,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_scale;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_transform,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_transform;
+extern template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_transform,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_transform;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_seat>,
+                                    const protocols::wl_seat::request::get_pointer&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_seat>,
+                                    const protocols::wl_seat::request::get_keyboard&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_seat>,
+                                    const protocols::wl_seat::request::get_touch&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_seat>,
+                                    const protocols::wl_seat::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_seat::event::capabilities, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::capabilities;
+extern template auto
+decode_message_payload<protocols::wl_seat::event::capabilities, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::capabilities;
+extern template auto
+decode_message_payload<protocols::wl_seat::event::name, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::name;
+extern template auto
+decode_message_payload<protocols::wl_seat::event::name, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::name;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_pointer>,
+                                    const protocols::wl_pointer::request::set_cursor&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_pointer>,
+                                    const protocols::wl_pointer::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::motion;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::motion;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::button, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::button;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::button, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::button;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::frame;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::frame;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_source, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_source;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_source, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_source;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_stop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_stop;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_stop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_stop;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_discrete, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_discrete;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_discrete, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_discrete;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_value120, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_value120;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_value120, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_value120;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_relative_direction,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_pointer::event::axis_relative_direction;
+extern template auto
+decode_message_payload<protocols::wl_pointer::event::axis_relative_direction,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_pointer::event::axis_relative_direction;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_keyboard>,
+                                    const protocols::wl_keyboard::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::enter;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::leave;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::key, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::key;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::key, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::key;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::modifiers, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::modifiers;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::modifiers, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::modifiers;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::repeat_info, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::repeat_info;
+extern template auto
+decode_message_payload<protocols::wl_keyboard::event::repeat_info, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::repeat_info;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_touch>,
+                                    const protocols::wl_touch::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_touch::event::down, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::down;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::down, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::down;
+extern template auto decode_message_payload<protocols::wl_touch::event::up, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::up;
+extern template auto decode_message_payload<protocols::wl_touch::event::up, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::up;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::motion;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::motion;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::frame;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::frame;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::cancel, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::cancel;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::cancel, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::cancel;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::shape, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::shape;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::shape, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::shape;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::orientation, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::orientation;
+extern template auto
+decode_message_payload<protocols::wl_touch::event::orientation, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::orientation;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_output>,
+                                    const protocols::wl_output::request::release&);
+extern template auto
+decode_message_payload<protocols::wl_output::event::geometry, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::geometry;
+extern template auto
+decode_message_payload<protocols::wl_output::event::geometry, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::geometry;
+extern template auto
+decode_message_payload<protocols::wl_output::event::mode, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::mode;
+extern template auto
+decode_message_payload<protocols::wl_output::event::mode, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::mode;
+extern template auto
+decode_message_payload<protocols::wl_output::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::done;
+extern template auto
+decode_message_payload<protocols::wl_output::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::done;
+extern template auto
+decode_message_payload<protocols::wl_output::event::scale, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::scale;
+extern template auto
+decode_message_payload<protocols::wl_output::event::scale, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::scale;
+extern template auto
+decode_message_payload<protocols::wl_output::event::name, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::name;
+extern template auto
+decode_message_payload<protocols::wl_output::event::name, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::name;
+extern template auto
+decode_message_payload<protocols::wl_output::event::description, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::description;
+extern template auto
+decode_message_payload<protocols::wl_output::event::description, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::description;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_region>,
+                                    const protocols::wl_region::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_region>,
+                                    const protocols::wl_region::request::add&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_region>,
+                                    const protocols::wl_region::request::subtract&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subcompositor>,
+                                    const protocols::wl_subcompositor::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subcompositor>,
+                                    const protocols::wl_subcompositor::request::get_subsurface&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subsurface>,
+                                    const protocols::wl_subsurface::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subsurface>,
+                                    const protocols::wl_subsurface::request::set_position&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subsurface>,
+                                    const protocols::wl_subsurface::request::place_above&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subsurface>,
+                                    const protocols::wl_subsurface::request::place_below&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subsurface>,
+                                    const protocols::wl_subsurface::request::set_sync&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_subsurface>,
+                                    const protocols::wl_subsurface::request::set_desync&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_fixes>,
+                                    const protocols::wl_fixes::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::wl_fixes>,
+                                    const protocols::wl_fixes::request::destroy_registry&);
+
+} // namespace wl
+} // namespace waylander
+#endif
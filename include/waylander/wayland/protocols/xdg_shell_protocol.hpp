@@ -40,6 +40,9 @@ namespace protocols {
 /// Declare everything before they might be used.
 
 struct xdg_wm_base {
+    static constexpr std::u8string_view name{ u8"xdg_wm_base" };
+    static constexpr protocol_version version{ 6 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -52,8 +55,35 @@ struct xdg_wm_base {
     struct event {
         struct ping;
     };
+
+    using request_list = message_list<request::destroy,
+                                      request::create_positioner,
+                                      request::get_xdg_surface,
+                                      request::pong>;
+    using event_list   = message_list<event::ping>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 5>{ {
+        { u8"id", u8'n', u8"xdg_positioner" },
+        { u8"id", u8'n', u8"xdg_surface" },
+        { u8"surface", u8'o', u8"wl_surface" },
+        { u8"serial", u8'u' },
+        { u8"serial", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 4>{ {
+        { u8"destroy", u8"", {} },
+        { u8"create_positioner", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"get_xdg_surface", u8"no", std::span{ message_arguments }.subspan(1, 2) },
+        { u8"pong", u8"u", std::span{ message_arguments }.subspan(3, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 1>{ {
+        { u8"ping", u8"u", std::span{ message_arguments }.subspan(4, 1) },
+    } };
 };
 struct xdg_positioner {
+    static constexpr std::u8string_view name{ u8"xdg_positioner" };
+    static constexpr protocol_version version{ 6 };
+
     enum class error : Wint::integral_type;
     enum class anchor : Wint::integral_type;
     enum class gravity : Wint::integral_type;
@@ -73,8 +103,54 @@ struct xdg_positioner {
     };
 
     struct event {};
+
+    using request_list = message_list<request::destroy,
+                                      request::set_size,
+                                      request::set_anchor_rect,
+                                      request::set_anchor,
+                                      request::set_gravity,
+                                      request::set_constraint_adjustment,
+                                      request::set_offset,
+                                      request::set_reactive,
+                                      request::set_parent_size,
+                                      request::set_parent_configure>;
+    using event_list   = message_list<>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 14>{ {
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"anchor", u8'i' },
+        { u8"gravity", u8'i' },
+        { u8"constraint_adjustment", u8'u' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"parent_width", u8'i' },
+        { u8"parent_height", u8'i' },
+        { u8"serial", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 10>{ {
+        { u8"destroy", u8"", {} },
+        { u8"set_size", u8"ii", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"set_anchor_rect", u8"iiii", std::span{ message_arguments }.subspan(2, 4) },
+        { u8"set_anchor", u8"i", std::span{ message_arguments }.subspan(6, 1) },
+        { u8"set_gravity", u8"i", std::span{ message_arguments }.subspan(7, 1) },
+        { u8"set_constraint_adjustment", u8"u", std::span{ message_arguments }.subspan(8, 1) },
+        { u8"set_offset", u8"ii", std::span{ message_arguments }.subspan(9, 2) },
+        { u8"set_reactive", u8"", {} },
+        { u8"set_parent_size", u8"ii", std::span{ message_arguments }.subspan(11, 2) },
+        { u8"set_parent_configure", u8"u", std::span{ message_arguments }.subspan(13, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 0>{};
 };
 struct xdg_surface {
+    static constexpr std::u8string_view name{ u8"xdg_surface" };
+    static constexpr protocol_version version{ 6 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -88,8 +164,42 @@ struct xdg_surface {
     struct event {
         struct configure;
     };
+
+    using request_list = message_list<request::destroy,
+                                      request::get_toplevel,
+                                      request::get_popup,
+                                      request::set_window_geometry,
+                                      request::ack_configure>;
+    using event_list   = message_list<event::configure>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 10>{ {
+        { u8"id", u8'n', u8"xdg_toplevel" },
+        { u8"id", u8'n', u8"xdg_popup" },
+        { u8"parent", u8'o', u8"xdg_surface" },
+        { u8"positioner", u8'o', u8"xdg_positioner" },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"serial", u8'u' },
+        { u8"serial", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 5>{ {
+        { u8"destroy", u8"", {} },
+        { u8"get_toplevel", u8"n", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"get_popup", u8"noo", std::span{ message_arguments }.subspan(1, 3) },
+        { u8"set_window_geometry", u8"iiii", std::span{ message_arguments }.subspan(4, 4) },
+        { u8"ack_configure", u8"u", std::span{ message_arguments }.subspan(8, 1) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 1>{ {
+        { u8"configure", u8"u", std::span{ message_arguments }.subspan(9, 1) },
+    } };
 };
 struct xdg_toplevel {
+    static constexpr std::u8string_view name{ u8"xdg_toplevel" };
+    static constexpr protocol_version version{ 6 };
+
     enum class error : Wint::integral_type;
     enum class resize_edge : Wint::integral_type;
     enum class state : Wint::integral_type;
@@ -118,8 +228,79 @@ struct xdg_toplevel {
         struct configure_bounds;
         struct wm_capabilities;
     };
+
+    using request_list = message_list<request::destroy,
+                                      request::set_parent,
+                                      request::set_title,
+                                      request::set_app_id,
+                                      request::show_window_menu,
+                                      request::move,
+                                      request::resize,
+                                      request::set_max_size,
+                                      request::set_min_size,
+                                      request::set_maximized,
+                                      request::unset_maximized,
+                                      request::set_fullscreen,
+                                      request::unset_fullscreen,
+                                      request::set_minimized>;
+    using event_list   = message_list<event::configure,
+                                      event::close,
+                                      event::configure_bounds,
+                                      event::wm_capabilities>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 23>{ {
+        { u8"parent", u8'o', u8"xdg_toplevel" },
+        { u8"title", u8's' },
+        { u8"app_id", u8's' },
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"edges", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"output", u8'o', u8"wl_output" },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"states", u8'a' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"capabilities", u8'a' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 14>{ {
+        { u8"destroy", u8"", {} },
+        { u8"set_parent", u8"o", std::span{ message_arguments }.subspan(0, 1) },
+        { u8"set_title", u8"s", std::span{ message_arguments }.subspan(1, 1) },
+        { u8"set_app_id", u8"s", std::span{ message_arguments }.subspan(2, 1) },
+        { u8"show_window_menu", u8"ouii", std::span{ message_arguments }.subspan(3, 4) },
+        { u8"move", u8"ou", std::span{ message_arguments }.subspan(7, 2) },
+        { u8"resize", u8"oui", std::span{ message_arguments }.subspan(9, 3) },
+        { u8"set_max_size", u8"ii", std::span{ message_arguments }.subspan(12, 2) },
+        { u8"set_min_size", u8"ii", std::span{ message_arguments }.subspan(14, 2) },
+        { u8"set_maximized", u8"", {} },
+        { u8"unset_maximized", u8"", {} },
+        { u8"set_fullscreen", u8"o", std::span{ message_arguments }.subspan(16, 1) },
+        { u8"unset_fullscreen", u8"", {} },
+        { u8"set_minimized", u8"", {} },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 4>{ {
+        { u8"configure", u8"iia", std::span{ message_arguments }.subspan(17, 3) },
+        { u8"close", u8"", {} },
+        { u8"configure_bounds", u8"ii", std::span{ message_arguments }.subspan(20, 2) },
+        { u8"wm_capabilities", u8"a", std::span{ message_arguments }.subspan(22, 1) },
+    } };
 };
 struct xdg_popup {
+    static constexpr std::u8string_view name{ u8"xdg_popup" };
+    static constexpr protocol_version version{ 6 };
+
     enum class error : Wint::integral_type;
 
     struct request {
@@ -133,6 +314,32 @@ struct xdg_popup {
         struct popup_done;
         struct repositioned;
     };
+
+    using request_list = message_list<request::destroy, request::grab, request::reposition>;
+    using event_list   = message_list<event::configure, event::popup_done, event::repositioned>;
+
+    /// Names and signatures of the messages indexed by opcode, see message_info.
+    static constexpr auto message_arguments = std::array<argument_info, 9>{ {
+        { u8"seat", u8'o', u8"wl_seat" },
+        { u8"serial", u8'u' },
+        { u8"positioner", u8'o', u8"xdg_positioner" },
+        { u8"token", u8'u' },
+        { u8"x", u8'i' },
+        { u8"y", u8'i' },
+        { u8"width", u8'i' },
+        { u8"height", u8'i' },
+        { u8"token", u8'u' },
+    } };
+    static constexpr auto request_infos = std::array<message_info, 3>{ {
+        { u8"destroy", u8"", {} },
+        { u8"grab", u8"ou", std::span{ message_arguments }.subspan(0, 2) },
+        { u8"reposition", u8"ou", std::span{ message_arguments }.subspan(2, 2) },
+    } };
+    static constexpr auto event_infos = std::array<message_info, 3>{ {
+        { u8"configure", u8"iiii", std::span{ message_arguments }.subspan(4, 4) },
+        { u8"popup_done", u8"", {} },
+        { u8"repositioned", u8"u", std::span{ message_arguments }.subspan(8, 1) },
+    } };
 };
 enum class xdg_wm_base::error : Wint::integral_type {
     /// given wl_surface has another role
@@ -160,6 +367,9 @@ enum class xdg_wm_base::error : Wint::integral_type {
 /// and will result in a defunct_surfaces error.
 struct xdg_wm_base::request::destroy {
     static constexpr Wopcode<xdg_wm_base> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// create a positioner object
@@ -169,7 +379,10 @@ struct xdg_wm_base::request::destroy {
 /// and xdg_surface.get_popup for details.
 struct xdg_wm_base::request::create_positioner {
     static constexpr Wopcode<xdg_wm_base> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<xdg_positioner> id;
+
+    using fields = message_fields<&xdg_wm_base::request::create_positioner::id>;
 };
 
 /// create a shell surface from a surface
@@ -189,8 +402,12 @@ struct xdg_wm_base::request::create_positioner {
 /// xdg_surface is and how it is used.
 struct xdg_wm_base::request::get_xdg_surface {
     static constexpr Wopcode<xdg_wm_base> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<xdg_surface> id;
     Wobject<wl_surface> surface;
+
+    using fields = message_fields<&xdg_wm_base::request::get_xdg_surface::id,
+                                  &xdg_wm_base::request::get_xdg_surface::surface>;
 };
 
 /// respond to a ping event
@@ -200,8 +417,11 @@ struct xdg_wm_base::request::get_xdg_surface {
 /// and xdg_wm_base.error.unresponsive.
 struct xdg_wm_base::request::pong {
     static constexpr Wopcode<xdg_wm_base> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// serial of the ping event
     Wuint serial;
+
+    using fields = message_fields<&xdg_wm_base::request::pong::serial>;
 };
 
 /// check if the client is alive
@@ -221,8 +441,11 @@ struct xdg_wm_base::request::pong {
 /// always respond to any xdg_wm_base object it created.
 struct xdg_wm_base::event::ping {
     static constexpr Wopcode<xdg_wm_base> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// pass this to the pong request
     Wuint serial;
+
+    using fields = message_fields<&xdg_wm_base::event::ping::serial>;
 };
 
 enum class xdg_positioner::error : Wint::integral_type {
@@ -350,6 +573,9 @@ enum class xdg_positioner::constraint_adjustment : Wuint::integral_type {
 /// Notify the compositor that the xdg_positioner will no longer be used.
 struct xdg_positioner::request::destroy {
     static constexpr Wopcode<xdg_positioner> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the size of the to-be positioned rectangle
@@ -361,10 +587,14 @@ struct xdg_positioner::request::destroy {
 /// If a zero or negative size is set the invalid_input error is raised.
 struct xdg_positioner::request::set_size {
     static constexpr Wopcode<xdg_positioner> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// width of positioned rectangle
     Wint width;
     /// height of positioned rectangle
     Wint height;
+
+    using fields = message_fields<&xdg_positioner::request::set_size::width,
+                                  &xdg_positioner::request::set_size::height>;
 };
 
 /// set the anchor rectangle within the parent surface
@@ -381,6 +611,7 @@ struct xdg_positioner::request::set_size {
 /// If a negative size is set the invalid_input error is raised.
 struct xdg_positioner::request::set_anchor_rect {
     static constexpr Wopcode<xdg_positioner> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     /// x position of anchor rectangle
     Wint x;
     /// y position of anchor rectangle
@@ -389,6 +620,11 @@ struct xdg_positioner::request::set_anchor_rect {
     Wint width;
     /// height of anchor rectangle
     Wint height;
+
+    using fields = message_fields<&xdg_positioner::request::set_anchor_rect::x,
+                                  &xdg_positioner::request::set_anchor_rect::y,
+                                  &xdg_positioner::request::set_anchor_rect::width,
+                                  &xdg_positioner::request::set_anchor_rect::height>;
 };
 
 /// set anchor rectangle anchor
@@ -401,8 +637,11 @@ struct xdg_positioner::request::set_anchor_rect {
 /// edge, or in the center of the anchor rectangle if no edge is specified.
 struct xdg_positioner::request::set_anchor {
     static constexpr Wopcode<xdg_positioner> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     /// anchor
     xdg_positioner::anchor anchor;
+
+    using fields = message_fields<&xdg_positioner::request::set_anchor::anchor>;
 };
 
 /// set child surface gravity
@@ -416,8 +655,11 @@ struct xdg_positioner::request::set_anchor {
 /// invalid_input error is raised.
 struct xdg_positioner::request::set_gravity {
     static constexpr Wopcode<xdg_positioner> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// gravity direction
     xdg_positioner::gravity gravity;
+
+    using fields = message_fields<&xdg_positioner::request::set_gravity::gravity>;
 };
 
 /// set the adjustment to be done when constrained
@@ -437,8 +679,12 @@ struct xdg_positioner::request::set_gravity {
 /// The default adjustment is none.
 struct xdg_positioner::request::set_constraint_adjustment {
     static constexpr Wopcode<xdg_positioner> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// bit mask of constraint adjustments
     xdg_positioner::constraint_adjustment constraint_adjustment;
+
+    using fields =
+        message_fields<&xdg_positioner::request::set_constraint_adjustment::constraint_adjustment>;
 };
 
 /// set surface position offset
@@ -456,10 +702,14 @@ struct xdg_positioner::request::set_constraint_adjustment {
 /// with some user interface element placed somewhere in the popup surface.
 struct xdg_positioner::request::set_offset {
     static constexpr Wopcode<xdg_positioner> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
     /// surface position x offset
     Wint x;
     /// surface position y offset
     Wint y;
+
+    using fields = message_fields<&xdg_positioner::request::set_offset::x,
+                                  &xdg_positioner::request::set_offset::y>;
 };
 
 /// continuously reconstrain the surface
@@ -472,6 +722,9 @@ struct xdg_positioner::request::set_offset {
 /// xdg_surface.configure event.
 struct xdg_positioner::request::set_reactive {
     static constexpr Wopcode<xdg_positioner> opcode{ 7 };
+    static constexpr protocol_version since{ 3 };
+
+    using fields = message_fields<>;
 };
 
 ///
@@ -485,10 +738,14 @@ struct xdg_positioner::request::set_reactive {
 /// The arguments are given in the surface-local coordinate space.
 struct xdg_positioner::request::set_parent_size {
     static constexpr Wopcode<xdg_positioner> opcode{ 8 };
+    static constexpr protocol_version since{ 3 };
     /// future window geometry width of parent
     Wint parent_width;
     /// future window geometry height of parent
     Wint parent_height;
+
+    using fields = message_fields<&xdg_positioner::request::set_parent_size::parent_width,
+                                  &xdg_positioner::request::set_parent_size::parent_height>;
 };
 
 /// set parent configure this is a response to
@@ -499,8 +756,11 @@ struct xdg_positioner::request::set_parent_size {
 /// constrained using.
 struct xdg_positioner::request::set_parent_configure {
     static constexpr Wopcode<xdg_positioner> opcode{ 9 };
+    static constexpr protocol_version since{ 3 };
     /// serial of parent configure event
     Wuint serial;
+
+    using fields = message_fields<&xdg_positioner::request::set_parent_configure::serial>;
 };
 
 enum class xdg_surface::error : Wint::integral_type {
@@ -525,6 +785,9 @@ enum class xdg_surface::error : Wint::integral_type {
 /// a defunct_role_object error is raised.
 struct xdg_surface::request::destroy {
     static constexpr Wopcode<xdg_surface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// assign the xdg_toplevel surface role
@@ -536,7 +799,10 @@ struct xdg_surface::request::destroy {
 /// xdg_toplevel is and how it is used.
 struct xdg_surface::request::get_toplevel {
     static constexpr Wopcode<xdg_surface> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<xdg_toplevel> id;
+
+    using fields = message_fields<&xdg_surface::request::get_toplevel::id>;
 };
 
 /// assign the xdg_popup surface role
@@ -551,9 +817,14 @@ struct xdg_surface::request::get_toplevel {
 /// xdg_popup is and how it is used.
 struct xdg_surface::request::get_popup {
     static constexpr Wopcode<xdg_surface> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     Wnew_id<xdg_popup> id;
     Wobject<xdg_surface> parent;
     Wobject<xdg_positioner> positioner;
+
+    using fields = message_fields<&xdg_surface::request::get_popup::id,
+                                  &xdg_surface::request::get_popup::parent,
+                                  &xdg_surface::request::get_popup::positioner>;
 };
 
 /// set the new window geometry
@@ -597,10 +868,16 @@ struct xdg_surface::request::get_popup {
 /// invalid_size error.
 struct xdg_surface::request::set_window_geometry {
     static constexpr Wopcode<xdg_surface> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     Wint x;
     Wint y;
     Wint width;
     Wint height;
+
+    using fields = message_fields<&xdg_surface::request::set_window_geometry::x,
+                                  &xdg_surface::request::set_window_geometry::y,
+                                  &xdg_surface::request::set_window_geometry::width,
+                                  &xdg_surface::request::set_window_geometry::height>;
 };
 
 /// ack a configure event
@@ -639,8 +916,11 @@ struct xdg_surface::request::set_window_geometry {
 /// xdg_surface. Doing so will raise an invalid_serial error.
 struct xdg_surface::request::ack_configure {
     static constexpr Wopcode<xdg_surface> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// the serial from the configure event
     Wuint serial;
+
+    using fields = message_fields<&xdg_surface::request::ack_configure::serial>;
 };
 
 /// suggest a surface change
@@ -663,8 +943,11 @@ struct xdg_surface::request::ack_configure {
 /// to one, it is free to discard all but the last event it received.
 struct xdg_surface::event::configure {
     static constexpr Wopcode<xdg_surface> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// serial of the configure event
     Wuint serial;
+
+    using fields = message_fields<&xdg_surface::event::configure::serial>;
 };
 
 enum class xdg_toplevel::error : Wint::integral_type {
@@ -797,6 +1080,9 @@ enum class xdg_toplevel::wm_capabilities : Wint::integral_type {
 /// see "Unmapping" behavior in interface section for details.
 struct xdg_toplevel::request::destroy {
     static constexpr Wopcode<xdg_toplevel> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the parent of this surface
@@ -823,7 +1109,10 @@ struct xdg_toplevel::request::destroy {
 /// otherwise the invalid_parent protocol error is raised.
 struct xdg_toplevel::request::set_parent {
     static constexpr Wopcode<xdg_toplevel> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     Wobject<xdg_toplevel> parent;
+
+    using fields = message_fields<&xdg_toplevel::request::set_parent::parent>;
 };
 
 /// set surface title
@@ -837,7 +1126,10 @@ struct xdg_toplevel::request::set_parent {
 /// The string must be encoded in UTF-8.
 struct xdg_toplevel::request::set_title {
     static constexpr Wopcode<xdg_toplevel> opcode{ 2 };
+    static constexpr protocol_version since{ 1 };
     Wstring title;
+
+    using fields = message_fields<&xdg_toplevel::request::set_title::title>;
 };
 
 /// set application ID
@@ -867,7 +1159,10 @@ struct xdg_toplevel::request::set_title {
 /// [0] https://standards.freedesktop.org/desktop-entry-spec/
 struct xdg_toplevel::request::set_app_id {
     static constexpr Wopcode<xdg_toplevel> opcode{ 3 };
+    static constexpr protocol_version since{ 1 };
     Wstring app_id;
+
+    using fields = message_fields<&xdg_toplevel::request::set_app_id::app_id>;
 };
 
 /// show the window menu
@@ -886,6 +1181,7 @@ struct xdg_toplevel::request::set_app_id {
 /// like a button press, key press, or touch down event.
 struct xdg_toplevel::request::show_window_menu {
     static constexpr Wopcode<xdg_toplevel> opcode{ 4 };
+    static constexpr protocol_version since{ 1 };
     /// the wl_seat of the user event
     Wobject<wl_seat> seat;
     /// the serial of the user event
@@ -894,6 +1190,11 @@ struct xdg_toplevel::request::show_window_menu {
     Wint x;
     /// the y position to pop up the window menu at
     Wint y;
+
+    using fields = message_fields<&xdg_toplevel::request::show_window_menu::seat,
+                                  &xdg_toplevel::request::show_window_menu::serial,
+                                  &xdg_toplevel::request::show_window_menu::x,
+                                  &xdg_toplevel::request::show_window_menu::y>;
 };
 
 /// start an interactive move
@@ -916,10 +1217,14 @@ struct xdg_toplevel::request::show_window_menu {
 /// that the device focus will return when the move is completed.
 struct xdg_toplevel::request::move {
     static constexpr Wopcode<xdg_toplevel> opcode{ 5 };
+    static constexpr protocol_version since{ 1 };
     /// the wl_seat of the user event
     Wobject<wl_seat> seat;
     /// the serial of the user event
     Wuint serial;
+
+    using fields = message_fields<&xdg_toplevel::request::move::seat,
+                                  &xdg_toplevel::request::move::serial>;
 };
 
 /// start an interactive resize
@@ -957,12 +1262,17 @@ struct xdg_toplevel::request::move {
 /// cursor image.
 struct xdg_toplevel::request::resize {
     static constexpr Wopcode<xdg_toplevel> opcode{ 6 };
+    static constexpr protocol_version since{ 1 };
     /// the wl_seat of the user event
     Wobject<wl_seat> seat;
     /// the serial of the user event
     Wuint serial;
     /// which edge or corner is being dragged
     xdg_toplevel::resize_edge edges;
+
+    using fields = message_fields<&xdg_toplevel::request::resize::seat,
+                                  &xdg_toplevel::request::resize::serial,
+                                  &xdg_toplevel::request::resize::edges>;
 };
 
 /// set the maximum size
@@ -1002,8 +1312,12 @@ struct xdg_toplevel::request::resize {
 /// invalid_size error.
 struct xdg_toplevel::request::set_max_size {
     static constexpr Wopcode<xdg_toplevel> opcode{ 7 };
+    static constexpr protocol_version since{ 1 };
     Wint width;
     Wint height;
+
+    using fields = message_fields<&xdg_toplevel::request::set_max_size::width,
+                                  &xdg_toplevel::request::set_max_size::height>;
 };
 
 /// set the minimum size
@@ -1043,8 +1357,12 @@ struct xdg_toplevel::request::set_max_size {
 /// invalid_size error.
 struct xdg_toplevel::request::set_min_size {
     static constexpr Wopcode<xdg_toplevel> opcode{ 8 };
+    static constexpr protocol_version since{ 1 };
     Wint width;
     Wint height;
+
+    using fields = message_fields<&xdg_toplevel::request::set_min_size::width,
+                                  &xdg_toplevel::request::set_min_size::height>;
 };
 
 /// maximize the window
@@ -1070,6 +1388,9 @@ struct xdg_toplevel::request::set_min_size {
 /// unmaximized unless overridden by the compositor.
 struct xdg_toplevel::request::set_maximized {
     static constexpr Wopcode<xdg_toplevel> opcode{ 9 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// unmaximize the window
@@ -1097,6 +1418,9 @@ struct xdg_toplevel::request::set_maximized {
 /// unmaximized unless overridden by the compositor.
 struct xdg_toplevel::request::unset_maximized {
     static constexpr Wopcode<xdg_toplevel> opcode{ 10 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the window as fullscreen on an output
@@ -1126,7 +1450,10 @@ struct xdg_toplevel::request::unset_maximized {
 /// visible below the fullscreened surface.
 struct xdg_toplevel::request::set_fullscreen {
     static constexpr Wopcode<xdg_toplevel> opcode{ 11 };
+    static constexpr protocol_version since{ 1 };
     Wobject<wl_output> output;
+
+    using fields = message_fields<&xdg_toplevel::request::set_fullscreen::output>;
 };
 
 /// unset the window as fullscreen
@@ -1150,6 +1477,9 @@ struct xdg_toplevel::request::set_fullscreen {
 /// content (see ack_configure).
 struct xdg_toplevel::request::unset_fullscreen {
     static constexpr Wopcode<xdg_toplevel> opcode{ 12 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// set the window as minimized
@@ -1164,6 +1494,9 @@ struct xdg_toplevel::request::unset_fullscreen {
 /// similar compositor features.
 struct xdg_toplevel::request::set_minimized {
     static constexpr Wopcode<xdg_toplevel> opcode{ 13 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// suggest a surface change
@@ -1189,9 +1522,14 @@ struct xdg_toplevel::request::set_minimized {
 /// xdg_surface.configure and xdg_surface.ack_configure for details.
 struct xdg_toplevel::event::configure {
     static constexpr Wopcode<xdg_toplevel> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     Wint width;
     Wint height;
     Warray states;
+
+    using fields = message_fields<&xdg_toplevel::event::configure::width,
+                                  &xdg_toplevel::event::configure::height,
+                                  &xdg_toplevel::event::configure::states>;
 };
 
 /// surface wants to be closed
@@ -1206,6 +1544,9 @@ struct xdg_toplevel::event::configure {
 /// a dialog to ask the user to save their data, etc.
 struct xdg_toplevel::event::close {
     static constexpr Wopcode<xdg_toplevel> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// recommended window geometry bounds
@@ -1227,8 +1568,12 @@ struct xdg_toplevel::event::close {
 /// xdg_toplevel.configure and xdg_surface.configure.
 struct xdg_toplevel::event::configure_bounds {
     static constexpr Wopcode<xdg_toplevel> opcode{ 2 };
+    static constexpr protocol_version since{ 4 };
     Wint width;
     Wint height;
+
+    using fields = message_fields<&xdg_toplevel::event::configure_bounds::width,
+                                  &xdg_toplevel::event::configure_bounds::height>;
 };
 
 /// compositor capabilities
@@ -1255,8 +1600,11 @@ struct xdg_toplevel::event::configure_bounds {
 /// native endianness.
 struct xdg_toplevel::event::wm_capabilities {
     static constexpr Wopcode<xdg_toplevel> opcode{ 3 };
+    static constexpr protocol_version since{ 5 };
     /// array of 32-bit capabilities
     Warray capabilities;
+
+    using fields = message_fields<&xdg_toplevel::event::wm_capabilities::capabilities>;
 };
 
 enum class xdg_popup::error : Wint::integral_type {
@@ -1273,6 +1621,9 @@ enum class xdg_popup::error : Wint::integral_type {
 /// xdg_wm_base.not_the_topmost_popup protocol error will be sent.
 struct xdg_popup::request::destroy {
     static constexpr Wopcode<xdg_popup> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// make the popup take an explicit grab
@@ -1316,10 +1667,14 @@ struct xdg_popup::request::destroy {
 /// will always have keyboard focus.
 struct xdg_popup::request::grab {
     static constexpr Wopcode<xdg_popup> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
     /// the wl_seat of the user event
     Wobject<wl_seat> seat;
     /// the serial of the user event
     Wuint serial;
+
+    using fields = message_fields<&xdg_popup::request::grab::seat,
+                                  &xdg_popup::request::grab::serial>;
 };
 
 /// recalculate the popup's location
@@ -1349,9 +1704,13 @@ struct xdg_popup::request::grab {
 /// send an xdg_positioner.set_parent_size request.
 struct xdg_popup::request::reposition {
     static constexpr Wopcode<xdg_popup> opcode{ 2 };
+    static constexpr protocol_version since{ 3 };
     Wobject<xdg_positioner> positioner;
     /// reposition request token
     Wuint token;
+
+    using fields = message_fields<&xdg_popup::request::reposition::positioner,
+                                  &xdg_popup::request::reposition::token>;
 };
 
 /// configure the popup surface
@@ -1370,6 +1729,7 @@ struct xdg_popup::request::reposition {
 /// set_reactive requested, or in response to xdg_popup.reposition requests.
 struct xdg_popup::event::configure {
     static constexpr Wopcode<xdg_popup> opcode{ 0 };
+    static constexpr protocol_version since{ 1 };
     /// x position relative to parent surface window geometry
     Wint x;
     /// y position relative to parent surface window geometry
@@ -1378,6 +1738,11 @@ struct xdg_popup::event::configure {
     Wint width;
     /// window geometry height
     Wint height;
+
+    using fields = message_fields<&xdg_popup::event::configure::x,
+                                  &xdg_popup::event::configure::y,
+                                  &xdg_popup::event::configure::width,
+                                  &xdg_popup::event::configure::height>;
 };
 
 /// popup interaction is done
@@ -1387,6 +1752,9 @@ struct xdg_popup::event::configure {
 /// point.
 struct xdg_popup::event::popup_done {
     static constexpr Wopcode<xdg_popup> opcode{ 1 };
+    static constexpr protocol_version since{ 1 };
+
+    using fields = message_fields<>;
 };
 
 /// signal the completion of a repositioned request
@@ -1408,10 +1776,200 @@ struct xdg_popup::event::popup_done {
 /// effect. See xdg_surface.ack_configure for details.
 struct xdg_popup::event::repositioned {
     static constexpr Wopcode<xdg_popup> opcode{ 2 };
+    static constexpr protocol_version since{ 3 };
     /// reposition request token
     Wuint token;
+
+    using fields = message_fields<&xdg_popup::event::repositioned::token>;
+};
+
+/// Metadata of the interfaces of the protocol, see interface_info.
+inline constexpr auto xdg_shell_interfaces = std::array{
+    interface_info_of<xdg_wm_base>,
+    interface_info_of<xdg_positioner>,
+    interface_info_of<xdg_surface>,
+    interface_info_of<xdg_toplevel>,
+    interface_info_of<xdg_popup>,
 };
 
 } // namespace protocols
 } // namespace wl
 } // namespace waylander
+
+#ifdef WAYLANDER_EXPLICIT_INSTANTIATIONS
+// Instantiated in the library, see meson option explicit_instantiations.
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+
+namespace waylander {
+namespace wl {
+
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_wm_base>,
+                                    const protocols::xdg_wm_base::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_wm_base>,
+                                    const protocols::xdg_wm_base::request::create_positioner&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_wm_base>,
+                                    const protocols::xdg_wm_base::request::get_xdg_surface&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_wm_base>,
+                                    const protocols::xdg_wm_base::request::pong&);
+extern template auto
+decode_message_payload<protocols::xdg_wm_base::event::ping, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_wm_base::event::ping;
+extern template auto
+decode_message_payload<protocols::xdg_wm_base::event::ping, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_wm_base::event::ping;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_size&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_anchor_rect&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_anchor&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_gravity&);
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::xdg_positioner>,
+               const protocols::xdg_positioner::request::set_constraint_adjustment&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_offset&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_reactive&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_positioner>,
+                                    const protocols::xdg_positioner::request::set_parent_size&);
+extern template void
+encode_request(message_buffer&,
+               Wobject<protocols::xdg_positioner>,
+               const protocols::xdg_positioner::request::set_parent_configure&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_surface>,
+                                    const protocols::xdg_surface::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_surface>,
+                                    const protocols::xdg_surface::request::get_toplevel&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_surface>,
+                                    const protocols::xdg_surface::request::get_popup&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_surface>,
+                                    const protocols::xdg_surface::request::set_window_geometry&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_surface>,
+                                    const protocols::xdg_surface::request::ack_configure&);
+extern template auto
+decode_message_payload<protocols::xdg_surface::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_surface::event::configure;
+extern template auto
+decode_message_payload<protocols::xdg_surface::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_surface::event::configure;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_parent&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_title&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_app_id&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::show_window_menu&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::move&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::resize&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_max_size&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_min_size&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_maximized&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::unset_maximized&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_fullscreen&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::unset_fullscreen&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_toplevel>,
+                                    const protocols::xdg_toplevel::request::set_minimized&);
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::close, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::close;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::close, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::close;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure_bounds, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure_bounds;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure_bounds, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure_bounds;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::wm_capabilities, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::wm_capabilities;
+extern template auto
+decode_message_payload<protocols::xdg_toplevel::event::wm_capabilities, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::wm_capabilities;
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_popup>,
+                                    const protocols::xdg_popup::request::destroy&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_popup>,
+                                    const protocols::xdg_popup::request::grab&);
+extern template void encode_request(message_buffer&,
+                                    Wobject<protocols::xdg_popup>,
+                                    const protocols::xdg_popup::request::reposition&);
+extern template auto
+decode_message_payload<protocols::xdg_popup::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::configure;
+extern template auto
+decode_message_payload<protocols::xdg_popup::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::configure;
+extern template auto
+decode_message_payload<protocols::xdg_popup::event::popup_done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::popup_done;
+extern template auto
+decode_message_payload<protocols::xdg_popup::event::popup_done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::popup_done;
+extern template auto
+decode_message_payload<protocols::xdg_popup::event::repositioned, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::repositioned;
+extern template auto
+decode_message_payload<protocols::xdg_popup::event::repositioned, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::repositioned;
+
+} // namespace wl
+} // namespace waylander
+#endif
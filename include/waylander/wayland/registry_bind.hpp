@@ -0,0 +1,52 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements version clamping wl_registry.bind requests.
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Creates wl_registry.bind request, which binds \p global to \p id.
+///
+/// The object is bound with the smaller of the advertised version and Version,
+/// which defaults to the version of W in the generated protocol header,
+/// so the compositor never sends \p id events which its type does not know about.
+///
+/// Throws std::logic_error if \p global is not a global of interface W.
+template<interface W, protocol_version Version>
+[[nodiscard]] constexpr auto bind_global(const protocols::wl_registry::event::global& global,
+                                         const Wobject<W, Version> id)
+    -> protocols::wl_registry::request::bind {
+    if (global.interface != W::name) {
+        throw std::logic_error{ "Global is not of the interface of the bound object." };
+    }
+    constexpr auto max_version = Version == any_version ? W::version : Version;
+    return { .name                     = global.name,
+             .new_id_interface         = { W::name },
+             .new_id_interface_version = { std::min(global.version.value, max_version) },
+             .id                       = { id.value } };
+}
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,56 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements optimization pass which coalesces redundant requests of wl_surface objects.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Upper bound for damage rectangles per surface between commits after coalescing.
+inline constexpr auto max_coalesced_damage_rectangles = 4uz;
+
+/// Coalesces redundant requests of \p surfaces in \p buff.
+///
+/// Requests are inspected per surface up to each commit (or destroy or the end of \p buff):
+///
+/// - Overlapping and touching damage rectangles are merged into their bounding box.
+///   If more than max_coalesced_damage_rectangles are left, the rectangles growing least
+///   are merged, which damages more than requested, but that is allowed by the protocol.
+///   The merged rectangles replace the last damage request. Requests damage and
+///   damage_buffer are in different coordinate spaces, so they are coalesced separately.
+/// - Only the last set_opaque_region and set_input_region is kept, as they set
+///   double-buffered state which is only applied on commit.
+///
+/// Rest of the requests are untouched and the relative order of all remaining requests
+/// is preserved, so e.g. the wl_region given to set_opaque_region is never used after
+/// it has been destroyed.
+///
+/// Precondition: \p buff consists of whole Wayland wire format messages and
+/// requests to the objects in \p surfaces are wl_surface requests.
+void coalesce_surface_requests(message_buffer& buff,
+                               std::span<const Wobject<protocols::wl_surface>> surfaces);
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,207 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements measuring of compositor roundtrip latency and detecting compositor stalls.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Histogram of durations with logarithmic buckets split to linear sub-buckets.
+///
+/// Like in HdrHistogram each power of two range is split to 2^sub_bucket_bits buckets,
+/// so recorded values are rounded down with relative error less than 2^-sub_bucket_bits.
+/// Recording never allocates.
+class latency_histogram {
+  public:
+    static constexpr auto sub_bucket_bits  = 3uz;
+    static constexpr auto sub_bucket_count = 1uz << sub_bucket_bits;
+    static constexpr auto bucket_count     = (64uz - sub_bucket_bits + 1uz) * sub_bucket_count;
+
+  private:
+    std::array<std::uint64_t, bucket_count> counts_{};
+    std::uint64_t total_count_{ 0 };
+    std::chrono::nanoseconds max_{ 0 };
+
+    [[nodiscard]] static constexpr auto bucket_of(const std::uint64_t ns) noexcept -> std::size_t {
+        if (ns < sub_bucket_count) { return ns; }
+        const auto exponent = static_cast<std::size_t>(std::bit_width(ns)) - 1uz;
+        const auto shift    = exponent - sub_bucket_bits;
+        const auto sub      = (ns >> shift) & (sub_bucket_count - 1);
+        return sub_bucket_count + shift * sub_bucket_count + sub;
+    }
+
+    [[nodiscard]] static constexpr auto lowest_of(const std::size_t bucket) noexcept
+        -> std::uint64_t {
+        if (bucket < sub_bucket_count) { return bucket; }
+        const auto shift = (bucket - sub_bucket_count) / sub_bucket_count;
+        const auto sub   = (bucket - sub_bucket_count) % sub_bucket_count;
+        return (sub_bucket_count + sub) << shift;
+    }
+
+  public:
+    /// Negative durations are recorded as zero.
+    void record(const std::chrono::nanoseconds duration) noexcept {
+        const auto ns = static_cast<std::uint64_t>(std::max(duration.count(), std::int64_t{ 0 }));
+        ++counts_[bucket_of(ns)];
+        ++total_count_;
+        max_ = std::max(max_, std::chrono::nanoseconds{ ns });
+    }
+
+    [[nodiscard]] auto count() const noexcept -> std::uint64_t { return total_count_; }
+
+    /// Largest recorded duration exactly.
+    [[nodiscard]] auto max() const noexcept -> std::chrono::nanoseconds { return max_; }
+
+    /// Smallest duration at or below which \p percent of the recorded durations are.
+    ///
+    /// The duration is rounded down to its bucket, zero if nothing is recorded.
+    [[nodiscard]] auto percentile(double percent) const noexcept -> std::chrono::nanoseconds;
+};
+
+/// Kind of a stall_event, see roundtrip_monitor_config.
+enum class stall_kind {
+    /// Compositor has not answered wl_display.sync within stall_threshold.
+    compositor,
+    /// Client answered xdg_wm_base.ping later than roundtrip_monitor_config::ping_threshold.
+    ping_response
+};
+
+struct stall_event {
+    stall_kind kind;
+    std::chrono::nanoseconds duration;
+};
+
+struct roundtrip_monitor_config {
+    /// Time between the wl_display.sync requests sent by roundtrip_monitor::poll.
+    std::chrono::nanoseconds sync_interval{ std::chrono::seconds{ 1 } };
+    /// Unanswered wl_display.sync older than this is reported as a stall.
+    std::chrono::nanoseconds stall_threshold{ std::chrono::milliseconds{ 100 } };
+    /// Pings answered slower than this are reported.
+    std::chrono::nanoseconds ping_threshold{ std::chrono::milliseconds{ 10 } };
+};
+
+/// Measures roundtrips to the compositor and tells whether slowness comes from it or the client.
+///
+/// poll sends wl_display.sync periodically and the roundtrip is the time from flushing it
+/// to reading wl_callback.done from the socket, see connected_client::last_read_time.
+/// The done events are handled by overloads which poll adds to the message_overload_set
+/// used to visit the events, so the roundtrips are measured while the client visits events.
+///
+/// Ping response is measured from connected_client::last_read_time to registering the pong,
+/// not from when the ping arrived. Time the ping waited in the socket before the client read
+/// it is not included, and if the ping was left in the client from an earlier read, e.g. by
+/// connected_client::take_messages_of, the response is measured from a later read.
+///
+/// poll has to be called from the thread using the client, but check_for_stall can be
+/// called from any thread, e.g. a watchdog thread, as the client thread can be blocked
+/// waiting for the compositor.
+class roundtrip_monitor {
+    using clock = std::chrono::steady_clock;
+
+    connected_client& client_;
+    message_overload_set& overloads_;
+    roundtrip_monitor_config config_;
+    std::move_only_function<void(const stall_event&)> on_stall_;
+
+    latency_histogram roundtrips_{};
+    latency_histogram ping_responses_{};
+
+    /// Callback of the last answered sync, whose overload is removed on the next poll.
+    std::optional<Wobject<protocols::wl_callback>> answered_callback_{};
+    clock::time_point next_sync_{};
+
+    static constexpr clock::rep no_pending_sync = -1;
+    static constexpr clock::rep stall_reported  = 1;
+
+    /// Time since clock epoch of the unanswered sync shifted left by one, with the lowest bit
+    /// telling whether its stall is already reported, or no_pending_sync if there is none.
+    ///
+    /// Packed into one atomic, so check_for_stall can not report a stall of an answered sync
+    /// or report a new sync as already reported.
+    std::atomic<clock::rep> pending_sync_{ no_pending_sync };
+
+    void report(const stall_event& event) {
+        if (on_stall_) { on_stall_(event); }
+    }
+
+  public:
+    /// Monitors \p client whose events are visited with \p overloads.
+    ///
+    /// \p on_stall is called with stall_events. Both \p client and \p overloads have to
+    /// outlive this roundtrip_monitor.
+    [[nodiscard]] roundtrip_monitor(connected_client& client,
+                                    message_overload_set& overloads,
+                                    roundtrip_monitor_config config = {},
+                                    std::move_only_function<void(const stall_event&)> on_stall = {})
+        : client_{ client },
+          overloads_{ overloads },
+          config_{ config },
+          on_stall_{ std::move(on_stall) } {}
+
+    roundtrip_monitor(const roundtrip_monitor&)            = delete;
+    roundtrip_monitor& operator=(const roundtrip_monitor&) = delete;
+
+    /// Sends and flushes wl_display.sync if the previous one is answered and
+    /// sync_interval has passed, and reports a stall if the previous one is late.
+    ///
+    /// Flushing also flushes the other registered requests.
+    void poll(clock::time_point now = clock::now());
+
+    /// Reports a stall_kind::compositor stall_event once per late wl_display.sync.
+    ///
+    /// Can be called from any thread, but then the stall callback is also called from it.
+    void check_for_stall(clock::time_point now = clock::now());
+
+    /// Answers xdg_wm_base.ping events of \p wm_base and measures the ping responses.
+    ///
+    /// The pong is flushed immediately.
+    void monitor_pings(Wobject<protocols::xdg_wm_base> wm_base);
+
+    /// True if the last wl_display.sync sent by poll is unanswered.
+    [[nodiscard]] bool awaiting_roundtrip() const noexcept {
+        return pending_sync_.load(std::memory_order::acquire) != no_pending_sync;
+    }
+
+    [[nodiscard]] auto roundtrips() const noexcept -> const latency_histogram& {
+        return roundtrips_;
+    }
+
+    [[nodiscard]] auto ping_responses() const noexcept -> const latency_histogram& {
+        return ping_responses_;
+    }
+};
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,147 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements recording of a timeline of client activity as Chrome trace-event JSON.
+///
+/// The JSON can be opened with Perfetto (ui.perfetto.dev) or chrome://tracing.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+
+namespace waylander {
+namespace wl {
+
+enum class timeline_kind : std::uint8_t {
+    /// Read from the socket, see connected_client::recv_more_data.
+    socket_read,
+    /// See connected_client::flush_registered_requests.
+    flush,
+    /// Registered request, which is an instant without duration.
+    request,
+    /// Invocation of an overload or a callback for an event.
+    dispatch,
+    /// Receiving and visiting events until a message, see connected_client::recv_and_visit_events.
+    until
+};
+
+/// Span or instant of a timeline.
+struct timeline_record {
+    timeline_kind kind;
+    Wopcode<generic_object> opcode{};
+    Wobject<generic_object> object{};
+    /// Interface of the message or nullptr if not known, see interface_info_if_known.
+    const interface_info* interface{ nullptr };
+    std::chrono::steady_clock::time_point begin{};
+    std::chrono::nanoseconds duration{};
+    /// Bytes read or flushed.
+    std::size_t bytes{ 0 };
+    /// File descriptors flushed.
+    std::size_t fds{ 0 };
+};
+
+/// Records timeline_records of several threads to per-thread ring buffers.
+///
+/// Each thread records to its own buffer, which is allocated on the first record of the thread,
+/// so recording does not contend. When a buffer is full the oldest records are overwritten,
+/// so the tracer keeps the latest history like a flight recorder.
+///
+/// The records can be read only while no thread is recording.
+class timeline_tracer {
+    struct thread_buffer {
+        int thread_id;
+        std::vector<timeline_record> ring;
+        /// Total amount of records, of which the last ring.size() are kept.
+        std::size_t recorded{ 0 };
+    };
+
+    std::uint64_t id_;
+    std::size_t records_per_thread_;
+
+    std::mutex buffers_mutex_{};
+    std::vector<std::unique_ptr<thread_buffer>> buffers_{};
+
+    [[nodiscard]] auto this_thread_buffer() -> thread_buffer&;
+
+  public:
+    /// Each thread keeps its latest \p records_per_thread records.
+    [[nodiscard]] explicit timeline_tracer(std::size_t records_per_thread = 1uz << 16);
+
+    timeline_tracer(const timeline_tracer&)            = delete;
+    timeline_tracer& operator=(const timeline_tracer&) = delete;
+
+    void record(const timeline_record& record);
+
+    /// Amount of records overwritten because the buffers were full.
+    [[nodiscard]] auto overwritten_records() -> std::size_t;
+
+    /// Kept records of all threads as Chrome trace-event JSON.
+    ///
+    /// Names of requests and dispatches are "<interface>.<message>" when the interface is known.
+    [[nodiscard]] auto chrome_trace_json() -> std::string;
+
+    /// Writes chrome_trace_json to \p path, throws std::runtime_error on failure.
+    void write_chrome_trace(const std::filesystem::path& path);
+};
+
+/// Records \p record with the lifetime of this object as its span, if the tracer is not nullptr.
+class timeline_scope {
+    timeline_tracer* tracer_;
+    timeline_record record_;
+
+  public:
+    [[nodiscard]] timeline_scope(timeline_tracer* const tracer, const timeline_record& record)
+        : tracer_{ tracer },
+          record_{ record } {
+        if (tracer_) { record_.begin = std::chrono::steady_clock::now(); }
+    }
+
+    /// Like timeline_scope(tracer, record) with record of \p kind for message \p msg.
+    [[nodiscard]] timeline_scope(timeline_tracer* const tracer,
+                                 const timeline_kind kind,
+                                 const interface_info* const interface,
+                                 const parsed_message& msg)
+        : timeline_scope(tracer,
+                         { .kind      = kind,
+                           .opcode    = msg.opcode,
+                           .object    = msg.object_id,
+                           .interface = interface }) {}
+
+    timeline_scope(const timeline_scope&)            = delete;
+    timeline_scope& operator=(const timeline_scope&) = delete;
+
+    ~timeline_scope() {
+        if (not tracer_) { return; }
+        record_.duration = std::chrono::steady_clock::now() - record_.begin;
+        tracer_->record(record_);
+    }
+
+    /// Record which is recorded at the end of the scope, e.g. to set the bytes read.
+    [[nodiscard]] auto record() noexcept -> timeline_record& { return record_; }
+};
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,262 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements recording and replaying of the raw bytes sent and received by connected_client.
+///
+/// Trace file consists of wire_trace_magic followed by records. Each record is
+/// wire_trace_record_header followed by the recorded bytes padded to multiple of 8.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+
+namespace waylander {
+namespace wl {
+
+enum class wire_direction : std::uint8_t { sent, received };
+
+/// Fixed size header of a recorded chunk.
+struct wire_trace_record_header {
+    /// std::chrono::steady_clock time since its epoch in nanoseconds.
+    std::uint64_t timestamp;
+    /// Amount of recorded bytes following the header, without the padding.
+    std::uint32_t size;
+    /// Amount of file descriptors sent or received with the bytes.
+    std::uint16_t fd_count;
+    wire_direction direction;
+    std::uint8_t reserved{ 0 };
+};
+
+static_assert(sizeof(wire_trace_record_header) == 16);
+
+/// Beginning of a trace file, ends with format version.
+inline constexpr auto wire_trace_magic = std::array<std::byte, 8>{
+    std::byte{ 'W' }, std::byte{ 'L' }, std::byte{ 'T' }, std::byte{ 'R' },
+    std::byte{ 'A' }, std::byte{ 'C' }, std::byte{ 'E' }, std::byte{ 1 },
+};
+
+/// Recorded chunk of a trace.
+struct wire_trace_record {
+    std::chrono::steady_clock::time_point timestamp;
+    wire_direction direction;
+    std::size_t fd_count;
+    std::span<const std::byte> data;
+};
+
+/// Lock-free single-producer single-consumer ring buffer of wire trace records.
+///
+/// connected_client is the producer and record never blocks nor allocates:
+/// if there is not enough space left, the record is dropped and counted in dropped_records.
+/// Consumer can run in an other thread and write the records to wire_trace_file.
+class wire_trace_ring {
+    std::size_t capacity_;
+    std::unique_ptr<std::byte[]> storage_;
+
+    /// Monotonically increasing byte positions, ring index is position modulo capacity_.
+    alignas(64) std::atomic<std::size_t> head_{ 0 };
+    alignas(64) std::atomic<std::size_t> tail_{ 0 };
+    std::atomic<std::size_t> dropped_records_{ 0 };
+
+    void copy_in(std::size_t position, std::span<const std::byte> bytes) noexcept;
+
+  public:
+    /// Ring can hold \p capacity bytes, rounded up to a power of two and at least 64.
+    [[nodiscard]] explicit wire_trace_ring(std::size_t capacity);
+
+    wire_trace_ring(const wire_trace_ring&)            = delete;
+    wire_trace_ring& operator=(const wire_trace_ring&) = delete;
+
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t { return capacity_; }
+
+    /// Records \p bytes with the current time, returns false if the record was dropped.
+    bool record(wire_direction direction,
+                std::span<const std::byte> bytes,
+                std::size_t fd_count = 0) noexcept;
+
+    /// Passes all records in the ring to \p sink and frees their space.
+    ///
+    /// \p sink is invoked with one span, or two if the records wrap around the end of the ring.
+    /// Only the concatenation of the spans holds whole records, as a record can be split
+    /// between them, so the sink has to write or copy them in order before parsing.
+    /// Returns the amount of consumed bytes.
+    auto consume(std::invocable<std::span<const std::byte>> auto&& sink) -> std::size_t {
+        const auto tail  = tail_.load(std::memory_order::relaxed);
+        const auto head  = head_.load(std::memory_order::acquire);
+        const auto begin = tail & (capacity_ - 1);
+        const auto size  = head - tail;
+        const auto first = std::min(size, capacity_ - begin);
+
+        const auto storage = std::span<const std::byte>{ storage_.get(), capacity_ };
+        if (first != 0) { std::invoke(sink, storage.subspan(begin, first)); }
+        if (first != size) { std::invoke(sink, storage.first(size - first)); }
+
+        tail_.store(head, std::memory_order::release);
+        return size;
+    }
+
+    [[nodiscard]] auto dropped_records() const noexcept -> std::size_t {
+        return dropped_records_.load(std::memory_order::relaxed);
+    }
+};
+
+/// Trace file written through a shared memory mapping.
+///
+/// The file is created or truncated and begins with wire_trace_magic.
+/// Mapping is grown as needed and the file is truncated to the written size when destroyed.
+class wire_trace_file {
+    int fd_{ -1 };
+    std::byte* mapping_{ nullptr };
+    std::size_t mapping_size_{ 0 };
+    std::size_t size_{ 0 };
+
+    void reserve(std::size_t size);
+
+  public:
+    [[nodiscard]] explicit wire_trace_file(const std::filesystem::path& path);
+    ~wire_trace_file();
+
+    wire_trace_file(const wire_trace_file&)            = delete;
+    wire_trace_file& operator=(const wire_trace_file&) = delete;
+
+    /// Appends raw bytes, e.g. records given by wire_trace_ring::consume.
+    void append(std::span<const std::byte> bytes);
+
+    /// Appends all records of \p ring to the file.
+    void flush(wire_trace_ring& ring) {
+        ring.consume([this](const std::span<const std::byte> bytes) { append(bytes); });
+    }
+
+    /// Written bytes including wire_trace_magic.
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+};
+
+/// Reads whole trace file to memory.
+[[nodiscard]] auto read_wire_trace_file(const std::filesystem::path& path) -> sstd::byte_vec;
+
+/// Forward range of the records in a trace, which begins with wire_trace_magic.
+///
+/// Throws std::logic_error if the trace does not begin with wire_trace_magic
+/// or if the iterator reaches a truncated record.
+///
+/// The range is a view, so the trace has to outlive it and its iterators.
+class wire_trace_range {
+    std::span<const std::byte> records_;
+
+  public:
+    class iterator {
+        /// Bytes starting from the current record.
+        std::span<const std::byte> unread_{};
+        wire_trace_record current_{};
+
+        void read_current();
+
+      public:
+        using value_type      = wire_trace_record;
+        using difference_type = std::ptrdiff_t;
+
+        [[nodiscard]] iterator() = default;
+        [[nodiscard]] explicit iterator(std::span<const std::byte> records);
+
+        [[nodiscard]] auto operator*() const noexcept -> const wire_trace_record& {
+            return current_;
+        }
+        [[nodiscard]] auto operator->() const noexcept -> const wire_trace_record* {
+            return &current_;
+        }
+
+        auto operator++() -> iterator&;
+        auto operator++(int) -> iterator {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        [[nodiscard]] bool operator==(const iterator& other) const noexcept {
+            return unread_.data() == other.unread_.data()
+                   and unread_.size() == other.unread_.size();
+        }
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept {
+            return unread_.empty();
+        }
+    };
+
+    [[nodiscard]] explicit wire_trace_range(std::span<const std::byte> trace);
+
+    [[nodiscard]] auto begin() const -> iterator { return iterator{ records_ }; }
+    [[nodiscard]] auto end() const noexcept -> std::default_sentinel_t { return {}; }
+};
+
+/// Feeds received bytes of \p trace through parsed_message_generator to \p visitor.
+///
+/// Messages split between records are reassembled. Returns the amount of visited messages.
+auto replay_wire_trace(const std::span<const std::byte> trace,
+                       std::invocable<const parsed_message&> auto&& visitor) -> std::size_t {
+    auto visited_messages = 0uz;
+
+    // Beginning of a message which continues in the next received record.
+    auto partial = sstd::byte_vec{};
+
+    for (const auto& record : wire_trace_range{ trace }) {
+        if (record.direction != wire_direction::received) { continue; }
+
+        // Whole messages are visited directly from the trace without copying.
+        auto bytes = record.data;
+        if (not partial.empty()) {
+            partial.insert(partial.end(), bytes.begin(), bytes.end());
+            bytes = partial;
+        }
+
+        const auto whole = whole_messages_size(bytes);
+        for (const auto& msg : parsed_message_generator(bytes.first(whole))) {
+            ++visited_messages;
+            std::invoke(visitor, msg);
+        }
+
+        const auto rest = bytes.subspan(whole);
+        if (partial.empty()) {
+            partial.assign(rest.begin(), rest.end());
+        } else {
+            partial.erase(partial.begin(), partial.begin() + static_cast<std::ptrdiff_t>(whole));
+        }
+    }
+
+    return visited_messages;
+}
+
+/// Like replay_wire_trace(trace, visitor) but the messages are passed to their \p overloads.
+///
+/// Messages without an overload are skipped.
+auto replay_wire_trace(std::span<const std::byte> trace, message_overload_set& overloads)
+    -> std::size_t;
+
+} // namespace wl
+} // namespace waylander
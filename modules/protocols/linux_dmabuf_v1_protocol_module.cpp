@@ -0,0 +1,20 @@
+// Generated from Wayland xml protocol: linux_dmabuf_v1
+
+/// @file
+/// Module interface unit of linux_dmabuf_v1 protocol.
+///
+/// Compiled to the modules library with meson option modules.
+
+module;
+
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/linux_dmabuf_v1_protocol.hpp"
+
+export module waylander.protocols.linux_dmabuf_v1;
+
+export namespace waylander::wl::protocols {
+using protocols::zwp_linux_dmabuf_v1;
+using protocols::zwp_linux_buffer_params_v1;
+using protocols::zwp_linux_dmabuf_feedback_v1;
+using protocols::linux_dmabuf_v1_interfaces;
+} // namespace waylander::wl::protocols
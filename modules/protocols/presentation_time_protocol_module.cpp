@@ -0,0 +1,19 @@
+// Generated from Wayland xml protocol: presentation_time
+
+/// @file
+/// Module interface unit of presentation_time protocol.
+///
+/// Compiled to the modules library with meson option modules.
+
+module;
+
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/presentation_time_protocol.hpp"
+
+export module waylander.protocols.presentation_time;
+
+export namespace waylander::wl::protocols {
+using protocols::wp_presentation;
+using protocols::wp_presentation_feedback;
+using protocols::presentation_time_interfaces;
+} // namespace waylander::wl::protocols
@@ -0,0 +1,25 @@
+// Generated from Wayland xml protocol: tablet_v2
+
+/// @file
+/// Module interface unit of tablet_v2 protocol.
+///
+/// Compiled to the modules library with meson option modules.
+
+module;
+
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/tablet_v2_protocol.hpp"
+
+export module waylander.protocols.tablet_v2;
+
+export namespace waylander::wl::protocols {
+using protocols::zwp_tablet_manager_v2;
+using protocols::zwp_tablet_seat_v2;
+using protocols::zwp_tablet_tool_v2;
+using protocols::zwp_tablet_v2;
+using protocols::zwp_tablet_pad_ring_v2;
+using protocols::zwp_tablet_pad_strip_v2;
+using protocols::zwp_tablet_pad_group_v2;
+using protocols::zwp_tablet_pad_v2;
+using protocols::tablet_v2_interfaces;
+} // namespace waylander::wl::protocols
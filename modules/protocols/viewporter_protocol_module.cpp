@@ -0,0 +1,19 @@
+// Generated from Wayland xml protocol: viewporter
+
+/// @file
+/// Module interface unit of viewporter protocol.
+///
+/// Compiled to the modules library with meson option modules.
+
+module;
+
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/viewporter_protocol.hpp"
+
+export module waylander.protocols.viewporter;
+
+export namespace waylander::wl::protocols {
+using protocols::wp_viewporter;
+using protocols::wp_viewport;
+using protocols::viewporter_interfaces;
+} // namespace waylander::wl::protocols
@@ -0,0 +1,39 @@
+// Generated from Wayland xml protocol: wayland
+
+/// @file
+/// Module interface unit of wayland protocol.
+///
+/// Compiled to the modules library with meson option modules.
+
+module;
+
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+export module waylander.protocols.wayland;
+
+export namespace waylander::wl::protocols {
+using protocols::wl_display;
+using protocols::wl_registry;
+using protocols::wl_callback;
+using protocols::wl_compositor;
+using protocols::wl_shm_pool;
+using protocols::wl_shm;
+using protocols::wl_buffer;
+using protocols::wl_data_offer;
+using protocols::wl_data_source;
+using protocols::wl_data_device;
+using protocols::wl_data_device_manager;
+using protocols::wl_shell;
+using protocols::wl_shell_surface;
+using protocols::wl_surface;
+using protocols::wl_seat;
+using protocols::wl_pointer;
+using protocols::wl_keyboard;
+using protocols::wl_touch;
+using protocols::wl_output;
+using protocols::wl_region;
+using protocols::wl_subcompositor;
+using protocols::wl_subsurface;
+using protocols::wl_fixes;
+using protocols::wayland_interfaces;
+} // namespace waylander::wl::protocols
@@ -0,0 +1,22 @@
+// Generated from Wayland xml protocol: xdg_shell
+
+/// @file
+/// Module interface unit of xdg_shell protocol.
+///
+/// Compiled to the modules library with meson option modules.
+
+module;
+
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+export module waylander.protocols.xdg_shell;
+
+export namespace waylander::wl::protocols {
+using protocols::xdg_wm_base;
+using protocols::xdg_positioner;
+using protocols::xdg_surface;
+using protocols::xdg_toplevel;
+using protocols::xdg_popup;
+using protocols::xdg_shell_interfaces;
+} // namespace waylander::wl::protocols
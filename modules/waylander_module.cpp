@@ -0,0 +1,269 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+/// @file
+/// Module interface unit of waylander.
+///
+/// Compiled to the modules library with meson option modules.
+/// The headers are included to the global module fragment and their declarations
+/// are exported with using-declarations, so the module and the headers can be mixed.
+/// Generated protocols are exported from modules waylander.protocols.<protocol>.
+
+module;
+
+#include "waylander/byte_array.hpp"
+#include "waylander/byte_vec.hpp"
+#include "waylander/construct_allocator_adapter.hpp"
+#include "waylander/sstd.hpp"
+#include "waylander/type_utils.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/connection_metrics.hpp"
+#include "waylander/wayland/decode_arena.hpp"
+#include "waylander/wayland/event_stream.hpp"
+#include "waylander/wayland/fixed_conversion.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_printer.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/message_view.hpp"
+#include "waylander/wayland/message_visitor.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/registry_bind.hpp"
+#include "waylander/wayland/request_coalescer.hpp"
+#include "waylander/wayland/roundtrip_monitor.hpp"
+#include "waylander/wayland/system_utils.hpp"
+#include "waylander/wayland/timeline_tracer.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+export module waylander;
+
+export namespace waylander {
+namespace sstd {
+
+// byte_array.hpp
+using sstd::byte_array;
+using sstd::total_memory_usage_is;
+
+// byte_vec.hpp
+using sstd::byte_vec;
+using sstd::byte_vec_alloc;
+
+namespace pmr {
+using pmr::byte_vec;
+using pmr::byte_vec_alloc;
+} // namespace pmr
+
+// construct_allocator_adapter.hpp
+namespace allocator {
+using allocator::allocation_counter;
+using allocator::allocator_adapter;
+using allocator::constant_construct;
+using allocator::construct_allocator_adapter;
+using allocator::counting_memory_resource;
+using allocator::default_init_construct;
+} // namespace allocator
+
+// sstd.hpp
+using sstd::plain_type;
+using sstd::round_upto_multiple_of;
+using sstd::throw_generic_system_error;
+using sstd::throw_partial_system_io_error;
+using sstd::unique_handle;
+
+// type_utils.hpp
+using sstd::arity_of_template_is;
+using sstd::indexed_type;
+using sstd::indexed_type_t;
+using sstd::is_template_invocable_with_list;
+using sstd::is_template_invocable_with_list_v;
+using sstd::is_type_list;
+using sstd::is_type_list_v;
+using sstd::make_overloadable;
+using sstd::make_overloaded;
+using sstd::nary_predicate_trait;
+using sstd::numeral_t;
+using sstd::overloaded;
+using sstd::pack_element_t;
+using sstd::predicate_type;
+using sstd::probe_type;
+using sstd::steal_template_args;
+using sstd::steal_template_args_t;
+using sstd::template_invocable;
+using sstd::template_invocable_with_list;
+using sstd::template_invocable_with_repeated_argument;
+using sstd::template_invoke;
+using sstd::template_invoke_t;
+using sstd::template_invoke_with_list;
+using sstd::template_invoke_with_list_t;
+using sstd::template_invoke_with_repeated_argument;
+using sstd::template_invoke_with_repeated_argument_t;
+using sstd::template_overload_resolution;
+using sstd::to_ref_tuple;
+using sstd::to_tuple;
+using sstd::type_fold_left;
+using sstd::type_list;
+using sstd::type_list_concat;
+using sstd::unary_predicate_trait;
+using sstd::unary_predicate_trait_fold;
+
+} // namespace sstd
+
+namespace wl {
+
+// connected_client.hpp
+using wl::connected_client;
+using wl::flush_policy;
+using wl::flush_statistics;
+using wl::global_display_object;
+
+// connection_metrics.hpp
+using wl::connection_metrics;
+using wl::connection_metrics_snapshot;
+using wl::log2_histogram;
+using wl::message_metrics_snapshot;
+using wl::metrics_enabled;
+using wl::single_writer_counter;
+
+// decode_arena.hpp
+using wl::decode_arena;
+
+// event_stream.hpp
+using wl::decode_event;
+using wl::event_range;
+using wl::event_variant;
+using wl::interface_with_events;
+using wl::received_events;
+
+// fixed_conversion.hpp
+using wl::convert_fixed;
+
+// message_buffer.hpp
+using wl::encode_request;
+using wl::message_buffer;
+
+// message_intrperter.hpp
+using wl::decode_message_payload;
+using wl::decode_policy;
+using wl::interpert_message_argument;
+using wl::interpert_message_payload;
+using wl::message_argument_wire_size;
+using wl::validate_message_payload;
+
+// message_overload_set.hpp
+using wl::message_overload_set;
+
+// message_parser.hpp
+using wl::basic_parsed_message_range;
+using wl::message_parser;
+using wl::parse_first_message;
+using wl::parse_first_message_unchecked;
+using wl::parsed_message_generator;
+using wl::parsed_message_range;
+using wl::unchecked_parsed_message_range;
+using wl::whole_messages_size;
+
+// message_printer.hpp
+using wl::format_wire_trace;
+using wl::message_printer;
+
+// message_utils.hpp
+using wl::dynamic_message_argument;
+using wl::message_args_to_tuple;
+using wl::message_args_to_type_list;
+using wl::message_argument_tuple;
+using wl::message_arguments_as_ref_tuple;
+using wl::message_payload_size;
+using wl::message_with_fields;
+using wl::static_message;
+using wl::static_message_argument;
+
+// message_view.hpp
+using wl::message_view;
+using wl::view_message_payload;
+
+// message_visitor.hpp
+using wl::message_visit;
+
+// parsed_message.hpp
+using wl::parsed_message;
+
+// protocol_primitives.hpp
+using wl::any_version;
+using wl::argument_info;
+using wl::generic_object;
+using wl::interface;
+using wl::interface_info;
+using wl::interface_info_if_known;
+using wl::interface_info_of;
+using wl::message_available_at;
+using wl::message_deprecated_at;
+using wl::message_fields;
+using wl::message_for_inteface;
+using wl::message_header;
+using wl::message_info;
+using wl::message_list;
+using wl::message_since;
+using wl::protocol_version;
+using wl::Warray;
+using wl::Wfd;
+using wl::Wfixed;
+using wl::Wint;
+using wl::Wmessage_size_t;
+using wl::Wnew_id;
+using wl::Wobject;
+using wl::Wopcode;
+using wl::Wstring;
+using wl::Wuint;
+using wl::operator==;
+
+// registry_bind.hpp
+using wl::bind_global;
+
+// request_coalescer.hpp
+using wl::coalesce_surface_requests;
+using wl::max_coalesced_damage_rectangles;
+
+// roundtrip_monitor.hpp
+using wl::latency_histogram;
+using wl::roundtrip_monitor;
+using wl::roundtrip_monitor_config;
+using wl::stall_event;
+using wl::stall_kind;
+
+// system_utils.hpp
+using wl::wayland_socket_path;
+
+// timeline_tracer.hpp
+using wl::timeline_kind;
+using wl::timeline_record;
+using wl::timeline_scope;
+using wl::timeline_tracer;
+
+// wire_trace.hpp
+using wl::read_wire_trace_file;
+using wl::replay_wire_trace;
+using wl::wire_direction;
+using wl::wire_trace_file;
+using wl::wire_trace_magic;
+using wl::wire_trace_range;
+using wl::wire_trace_record;
+using wl::wire_trace_record_header;
+using wl::wire_trace_ring;
+
+} // namespace wl
+} // namespace waylander
@@ -13,49 +13,145 @@
 // You should have received a copy of the GNU General Public License
 // along with this file.  If not, see <https://www.gnu.org/licenses/>.
 
-#include <generator>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
 #include <span>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
 #include "gnulander/local_stream_socket.hpp"
 
 #include "waylander/byte_vec.hpp"
 #include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/connection_metrics.hpp"
 #include "waylander/wayland/message_parser.hpp"
 #include "waylander/wayland/message_visitor.hpp"
+#include "waylander/wayland/timeline_tracer.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+#include "tracepoints.hpp"
 
 namespace waylander {
 namespace wl {
 
-[[nodiscard]] connected_client::connected_client(const std::filesystem::path& socket)
-    : server_sock_{ gnulander::open_local_stream_socket_connected_to(socket) } {}
+[[nodiscard]] connected_client::connected_client(const std::filesystem::path& socket,
+                                                 std::pmr::memory_resource* const resource)
+    : connected_client(gnulander::open_local_stream_socket_connected_to(socket), resource) {}
 
 [[nodiscard]] connected_client::connected_client(
-    [[maybe_unused]] gnulander::local_stream_socket&& server_sock)
-    : server_sock_{ std::move(server_sock) } {};
+    [[maybe_unused]] gnulander::local_stream_socket&& server_sock,
+    std::pmr::memory_resource* const resource)
+    : server_sock_{ std::move(server_sock) },
+      request_buff_{ resource },
+      pending_data_{ sstd::pmr::byte_vec_alloc{ resource } },
+      pending_fds_{ std::pmr::polymorphic_allocator<Wfd>{ resource } },
+      recv_buff_{ sstd::pmr::byte_vec_alloc{ resource } } {};
+
+void connected_client::set_flush_policy(const flush_policy policy,
+                                        const std::size_t size_threshold) {
+    flush_policy_         = policy;
+    flush_size_threshold_ = size_threshold;
+    flush_by_policy();
+}
+
+void connected_client::flush_by_policy() {
+    switch (flush_policy_) {
+        case flush_policy::immediate: flush_registered_requests(); return;
+        case flush_policy::size_threshold:
+            if (request_buff_.size() >= flush_size_threshold_) { flush_registered_requests(); }
+            return;
+        case flush_policy::manual:
+        case flush_policy::end_of_dispatch: return;
+    }
+}
 
-void connected_client::flush_registered_requests() {
-    if (request_buff_.empty()) return;
+bool connected_client::flush_registered_requests() {
+    auto span = timeline_scope{ timeline_, { .kind = timeline_kind::flush } };
+
+    if (not request_buff_.empty()) {
+        // Drop already written part of the pending output before appending to it,
+        // so that it does not grow without bounds under constant backpressure.
+        pending_data_.erase(pending_data_.begin(),
+                            std::ranges::next(pending_data_.begin(), pending_data_offset_));
+        pending_fds_.erase(pending_fds_.begin(),
+                           std::ranges::next(pending_fds_.begin(), pending_fds_offset_));
+        pending_data_offset_ = 0;
+        pending_fds_offset_  = 0;
+
+        // Copy instead of releasing the buffers, so that their storage is reused.
+        const auto data = request_buff_.data();
+        const auto fds  = request_buff_.fds();
+        WAYLANDER_TRACEPOINT(flush, data.size(), fds.size());
+        span.record().bytes = data.size();
+        span.record().fds   = fds.size();
+        ++flush_stats_.flushes;
+        flush_stats_.flushed_bytes += data.size();
+        flush_stats_.flushed_fds += fds.size();
+        flush_stats_.largest_flush_bytes = std::max(flush_stats_.largest_flush_bytes, data.size());
+        pending_data_.insert(pending_data_.end(), data.begin(), data.end());
+        pending_fds_.insert(pending_fds_.end(), fds.begin(), fds.end());
+#ifdef WAYLANDER_METRICS
+        if (metrics_) { metrics_->count_flush(data.size()); }
+#endif
+        request_buff_.clear();
+    }
 
-    auto data_to_write = request_buff_.release_data();
-    auto fds_to_write  = request_buff_.release_fds();
+    const auto all_written = write_pending_output();
+    if (not all_written) { ++flush_stats_.partial_flushes; }
+    return all_written;
+};
 
-    // Assume that there is more bytes to send than file descriptors.
-    assert(data_to_write.size() > fds_to_write.size());
+bool connected_client::write_pending_output() {
+    const auto unwritten_data = [&] {
+        return std::span{ pending_data_ }.subspan(pending_data_offset_);
+    };
+
+    try {
+        // Assume that there is at least as many bytes to send as file descriptors.
+        assert(pending_data_.size() - pending_data_offset_
+               >= pending_fds_.size() - pending_fds_offset_);
+
+        // Send each fd along one byte, so the fd never arrives after the message it belongs to.
+        while (pending_fds_offset_ < pending_fds_.size()) {
+            auto msg = gnulander::local_socket_msg<1, 1>{ unwritten_data().first(1),
+                                                          pending_fds_[pending_fds_offset_].value };
+            const auto bytes_sent = server_sock_.send(msg);
+#ifdef WAYLANDER_METRICS
+            if (metrics_) { metrics_->count_write(); }
+#endif
+            if (wire_trace_) {
+                wire_trace_->record(wire_direction::sent, unwritten_data().first(bytes_sent), 1);
+            }
+            pending_data_offset_ += bytes_sent;
+            ++pending_fds_offset_;
+        }
 
-    // Then send each fd along one byte.
-    auto bytes_written = 0uz;
-    for (const auto& fd : fds_to_write) {
-        auto msg =
-            gnulander::local_socket_msg<1, 1>{ std::span{ data_to_write }.subspan(bytes_written, 1),
-                                               fd.value };
-        bytes_written += server_sock_.send(msg);
+        // Then send rest of the data.
+        while (pending_data_offset_ < pending_data_.size()) {
+            const auto bytes_written = server_sock_.write_some(unwritten_data());
+#ifdef WAYLANDER_METRICS
+            if (metrics_) { metrics_->count_write(); }
+#endif
+            if (wire_trace_) {
+                wire_trace_->record(wire_direction::sent, unwritten_data().first(bytes_written));
+            }
+            pending_data_offset_ += bytes_written;
+        }
+    } catch (const std::system_error& err) {
+        const auto would_block = err.code() == std::errc::resource_unavailable_try_again
+                                 or err.code() == std::errc::operation_would_block;
+        if (not would_block) { throw; }
+        return false;
     }
 
-    // Finally send rest of the data.
-    server_sock_.write(std::span{ data_to_write }.subspan(bytes_written));
-};
+    pending_data_.clear();
+    pending_fds_.clear();
+    pending_data_offset_ = 0;
+    pending_fds_offset_  = 0;
+    return true;
+}
 
 void connected_client::recv_more_data() {
     // Let's say we are reading N bytes and U := unprocessed bytes in recv_buff_.
@@ -78,6 +174,8 @@ read_again:
     recv_buff_.resize(M + M_pad);
     const auto begin_of_read = std::ranges::next(recv_buff_.begin(), unprocessed_bytes);
     const auto where_to_read = std::span<std::byte>(begin_of_read, recv_buff_.end());
+    const auto read_begin    = timeline_ ? std::chrono::steady_clock::now()
+                                         : std::chrono::steady_clock::time_point{};
     const auto bytes_read    = server_sock_.read_some(where_to_read);
 
     if (bytes_read == 0) {
@@ -85,6 +183,20 @@ read_again:
         throw std::runtime_error{ "Encountered EOF from server socket!" };
     }
 
+    last_read_time_ = std::chrono::steady_clock::now();
+    WAYLANDER_TRACEPOINT(recv, bytes_read);
+    if (timeline_) {
+        timeline_->record({ .kind     = timeline_kind::socket_read,
+                            .begin    = read_begin,
+                            .duration = last_read_time_ - read_begin,
+                            .bytes    = bytes_read });
+    }
+    if (wire_trace_) {
+        wire_trace_->record(wire_direction::received, where_to_read.first(bytes_read));
+    }
+#ifdef WAYLANDER_METRICS
+    if (metrics_) { metrics_->count_read(bytes_read); }
+#endif
     unprocessed_bytes += bytes_read;
 
     if (bytes_read == where_to_read.size()) {
@@ -122,6 +234,11 @@ try_next_msg:
         bytes_forming_whole_messages + wl::message_header<wl::generic_object>::size_offset);
     std::memcpy(&size_of_next_msg, &*ptr_to_size, sizeof(wl::Wmessage_size_t));
 
+    // Otherwise the same message would be found again and again.
+    if (size_of_next_msg.value < sizeof(message_header<generic_object>)) {
+        throw std::logic_error{ "Wayland message size is less than 8 bytes." };
+    }
+
     const auto bytes_potentially_forming_whole_messages =
         bytes_forming_whole_messages + size_of_next_msg.value;
 
@@ -136,50 +253,160 @@ try_next_msg:
 }
 
 [[nodiscard]] auto connected_client::recv_events() -> message_parser {
-    recv_more_data();
+    // Messages left by take_messages_of are returned without waiting for more.
+    if (get_recd_bytes_forming_whole_messages().empty()) { recv_more_data(); }
     const auto bytes_to_parse = get_recd_bytes_forming_whole_messages();
-    auto parser               = message_parser{ bytes_to_parse };
+    auto parser = message_parser{ bytes_to_parse, recv_buff_.get_allocator().resource() };
+#ifdef WAYLANDER_METRICS
+    if (metrics_) {
+        // The interfaces of the objects are not known here.
+        for (const auto& msg : unchecked_parsed_message_range{ bytes_to_parse }) {
+            metrics_->count_received(nullptr,
+                                     msg.opcode,
+                                     sizeof(message_header<generic_object>) + msg.arguments.size(),
+                                     0);
+        }
+    }
+#endif
 
     recv_buff_.erase(recv_buff_.begin(),
                      std::ranges::next(recv_buff_.begin(), bytes_to_parse.size()));
     return parser;
 }
 
+[[nodiscard]] auto connected_client::take_messages_of(
+    const Wobject<generic_object> obj,
+    [[maybe_unused]] const interface_info* const interface) -> message_parser {
+    auto taken = sstd::pmr::byte_vec{ recv_buff_.get_allocator() };
+
+    while (true) {
+        const auto whole_messages = get_recd_bytes_forming_whole_messages();
+
+        // Messages of other objects are moved towards the beginning over the taken ones.
+        // They never overwrite the header of the next message, so the parsing can continue.
+        auto kept_bytes   = 0uz;
+        auto parsed_bytes = 0uz;
+        for (const auto& msg : unchecked_parsed_message_range{ whole_messages }) {
+            const auto msg_size  = sizeof(message_header<generic_object>) + msg.arguments.size();
+            const auto msg_bytes = whole_messages.subspan(parsed_bytes, msg_size);
+            if (msg.object_id == obj) {
+                taken.insert(taken.end(), msg_bytes.begin(), msg_bytes.end());
+#ifdef WAYLANDER_METRICS
+                if (metrics_) { metrics_->count_received(interface, msg.opcode, msg_size, 0); }
+#endif
+            } else {
+                if (kept_bytes != parsed_bytes) {
+                    std::ranges::copy(msg_bytes, std::ranges::next(recv_buff_.begin(), kept_bytes));
+                }
+                kept_bytes += msg_size;
+            }
+            parsed_bytes += msg_size;
+        }
+
+        recv_buff_.erase(std::ranges::next(recv_buff_.begin(), kept_bytes),
+                         std::ranges::next(recv_buff_.begin(), parsed_bytes));
+
+        if (not taken.empty()) { return message_parser{ std::move(taken) }; }
+        recv_more_data();
+    }
+}
+
 void connected_client::recvis_closure::until(
     const Wobject<generic_object> until_obj_id,
     const Wopcode<generic_object> until_opcode,
+    [[maybe_unused]] const interface_info* const until_interface,
     const std::move_only_function<void(std::span<const std::byte>) const> callback) {
+    WAYLANDER_TRACEPOINT(until_entry, until_obj_id.value, until_opcode.value);
+    const auto until_span = timeline_scope{ parent_obj_ref_.timeline_,
+                                            { .kind      = timeline_kind::until,
+                                              .opcode    = until_opcode,
+                                              .object    = until_obj_id,
+                                              .interface = until_interface } };
+
+#ifdef WAYLANDER_METRICS
+    const auto metrics = parent_obj_ref_.metrics_;
+#endif
+
+    // Invokes the handler of the message and times it, if it is counted or traced.
+    const auto invoke_handler = [&]([[maybe_unused]] const interface_info* const interface,
+                                    const parsed_message& msg,
+                                    auto& handler) {
+        const auto span = timeline_scope{ parent_obj_ref_.timeline_,
+                                          timeline_kind::dispatch,
+                                          interface,
+                                          msg };
+
+        auto timed = WAYLANDER_TRACEPOINT_ENABLED(dispatch);
+#ifdef WAYLANDER_METRICS
+        timed = timed or metrics != nullptr;
+#endif
+        if (not timed) {
+            std::invoke(handler, msg.arguments);
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        std::invoke(handler, msg.arguments);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto handler_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+        WAYLANDER_TRACEPOINT(dispatch, msg.object_id.value, msg.opcode.value, handler_ns);
+#ifdef WAYLANDER_METRICS
+        if (metrics) {
+            metrics->count_received(interface,
+                                    msg.opcode,
+                                    sizeof(message_header<generic_object>) + msg.arguments.size(),
+                                    handler_ns);
+        }
+#endif
+    };
+
 try_again:
     const auto bytes_to_parse = parent_obj_ref_.get_recd_bytes_forming_whole_messages();
-    auto parsed_messages      = parsed_message_generator(bytes_to_parse);
 
-    auto total_num_parsed_messages   = 0uz;
-    auto total_parsed_argument_bytes = 0uz;
+    // Sizes of the messages are already validated, so they can be parsed without checks.
+    // This also avoids parsed_message_generator, which would allocate its coroutine state.
+    auto total_parsed_bytes = 0uz;
 
-    for (const auto& msg : parsed_messages) {
-        ++total_num_parsed_messages;
-        total_parsed_argument_bytes += msg.arguments.size();
+    for (const auto& msg : unchecked_parsed_message_range{ bytes_to_parse }) {
+        total_parsed_bytes += sizeof(message_header<generic_object>) + msg.arguments.size();
 
         if (msg.object_id == until_obj_id and msg.opcode == until_opcode) {
             /// Found "until message".
 
-            if (callback) { callback(msg.arguments); }
-
-            const auto total_parsed_bytes =
-                sizeof(message_header<generic_object>) * total_num_parsed_messages
-                + total_parsed_argument_bytes;
+            if (callback) { invoke_handler(until_interface, msg, callback); }
+#ifdef WAYLANDER_METRICS
+            else if (metrics) {
+                metrics->count_received(until_interface,
+                                        msg.opcode,
+                                        sizeof(message_header<generic_object>)
+                                            + msg.arguments.size(),
+                                        0);
+            }
+#endif
 
             parent_obj_ref_.recv_buff_.erase(
                 parent_obj_ref_.recv_buff_.begin(),
                 std::ranges::next(parent_obj_ref_.recv_buff_.begin(), total_parsed_bytes));
 
+            if (parent_obj_ref_.flush_policy_ == flush_policy::end_of_dispatch) {
+                parent_obj_ref_.flush_registered_requests();
+            }
+            WAYLANDER_TRACEPOINT(until_exit, until_obj_id.value, until_opcode.value);
             return;
         }
 
-        const auto ov_res = mos_.overload_resolution(msg.object_id, msg.opcode);
+        const auto entry = mos_.find_overload(msg.object_id, msg.opcode);
 
         // Skip messages without overloads.
-        if (ov_res.has_value()) { std::invoke(ov_res.value(), msg.arguments); }
+        if (entry == nullptr) {
+#ifdef WAYLANDER_METRICS
+            if (metrics) { metrics->count_unhandled(); }
+#endif
+            continue;
+        }
+        invoke_handler(entry->interface, msg, entry->overload);
     }
 
     // "Until message" was not found from already recevided whole messages.
@@ -189,6 +416,11 @@ try_again:
         parent_obj_ref_.recv_buff_.begin(),
         std::ranges::next(parent_obj_ref_.recv_buff_.begin(), bytes_to_parse.size()));
 
+    // Requests registered by the overloads might be waited by the server before it sends more.
+    if (parent_obj_ref_.flush_policy_ == flush_policy::end_of_dispatch) {
+        parent_obj_ref_.flush_registered_requests();
+    }
+
     parent_obj_ref_.recv_more_data();
     goto try_again;
 }
@@ -0,0 +1,132 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "waylander/wayland/connection_metrics.hpp"
+
+namespace waylander {
+namespace wl {
+
+auto log2_histogram::snapshot() const noexcept -> snapshot_type {
+    auto counts = snapshot_type{};
+    std::ranges::transform(buckets_, counts.begin(), &single_writer_counter::load);
+    return counts;
+}
+
+auto message_metrics_snapshot::info() const noexcept -> const message_info* {
+    const auto messages_of_direction =
+        direction == wire_direction::sent ? interface->requests : interface->events;
+    if (opcode.value >= messages_of_direction.size()) { return nullptr; }
+    return &messages_of_direction[opcode.value];
+}
+
+[[nodiscard]] connection_metrics::connection_metrics(const std::size_t max_messages)
+    : slot_count_{ std::bit_ceil(std::max(max_messages, 1uz)) },
+      slots_{ std::make_unique<message_slot[]>(slot_count_) } {}
+
+auto connection_metrics::slot(const interface_info* const interface,
+                              const Wopcode<generic_object> opcode,
+                              const wire_direction direction) noexcept -> message_slot* {
+    const auto hash = std::hash<const interface_info*>{}(interface)
+                      ^ (std::size_t{ opcode.value } << 1)
+                      ^ static_cast<std::size_t>(direction);
+
+    // Linear probing, where a slot is claimed by the first message hashed to it.
+    // Only the writer claims slots, so the interface is published last for the readers.
+    for (auto i = 0uz; i < slot_count_; ++i) {
+        auto& s                          = slots_[(hash + i) & (slot_count_ - 1)];
+        const auto* const slot_interface = s.interface.load(std::memory_order::relaxed);
+
+        if (slot_interface == nullptr) {
+            s.opcode    = opcode;
+            s.direction = direction;
+            s.interface.store(interface, std::memory_order::release);
+            return &s;
+        }
+        if (slot_interface == interface and s.opcode.value == opcode.value
+            and s.direction == direction) {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+void connection_metrics::count_sent(const interface_info* const interface,
+                                    const Wopcode<generic_object> opcode,
+                                    const std::size_t bytes) noexcept {
+    sent_messages_.add(1);
+    sent_bytes_.add(bytes);
+
+    const auto s = interface ? slot(interface, opcode, wire_direction::sent) : nullptr;
+    if (s == nullptr) {
+        untracked_messages_.add(1);
+        return;
+    }
+    s->messages.add(1);
+    s->bytes.add(bytes);
+}
+
+void connection_metrics::count_received(const interface_info* const interface,
+                                        const Wopcode<generic_object> opcode,
+                                        const std::size_t bytes,
+                                        const std::uint64_t handler_nanoseconds) noexcept {
+    received_messages_.add(1);
+
+    const auto s = interface ? slot(interface, opcode, wire_direction::received) : nullptr;
+    if (s == nullptr) {
+        untracked_messages_.add(1);
+        return;
+    }
+    s->messages.add(1);
+    s->bytes.add(bytes);
+    s->handler_nanoseconds.record(handler_nanoseconds);
+}
+
+auto connection_metrics::snapshot() const -> connection_metrics_snapshot {
+    auto messages = std::vector<message_metrics_snapshot>{};
+    for (auto i = 0uz; i < slot_count_; ++i) {
+        const auto& s               = slots_[i];
+        const auto* const interface = s.interface.load(std::memory_order::acquire);
+        if (interface == nullptr) { continue; }
+        messages.push_back({ .interface           = interface,
+                             .opcode              = s.opcode,
+                             .direction           = s.direction,
+                             .messages            = s.messages.load(),
+                             .bytes               = s.bytes.load(),
+                             .handler_nanoseconds = s.handler_nanoseconds.snapshot() });
+    }
+
+    return { .sent_messages      = sent_messages_.load(),
+             .sent_bytes         = sent_bytes_.load(),
+             .received_messages  = received_messages_.load(),
+             .received_bytes     = received_bytes_.load(),
+             .read_syscalls      = read_syscalls_.load(),
+             .write_syscalls     = write_syscalls_.load(),
+             .unhandled_messages = unhandled_messages_.load(),
+             .untracked_messages = untracked_messages_.load(),
+             .flush_bytes        = flush_bytes_.snapshot(),
+             .messages           = std::move(messages) };
+}
+
+} // namespace wl
+} // namespace waylander
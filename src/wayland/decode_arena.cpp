@@ -0,0 +1,72 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+
+#include "waylander/wayland/decode_arena.hpp"
+
+namespace waylander {
+namespace wl {
+
+[[nodiscard]] decode_arena::decode_arena(const std::size_t initial_block_size,
+                                         std::pmr::memory_resource* const upstream)
+    : resource_{ initial_block_size, upstream },
+      interned_strings_{ &resource_ } {}
+
+[[nodiscard]] auto decode_arena::copy(const Wstring str) -> Wstring {
+    // Null-string has nothing to copy.
+    if (str.data() == nullptr) { return str; }
+
+    if (const auto interned = interned_strings_.find(str); interned != interned_strings_.end()) {
+        return Wstring{ *interned };
+    }
+
+    // Keep the null delimiter, so the copy can be passed to C APIs like the original.
+    auto* const storage = static_cast<char8_t*>(resource_.allocate(str.size() + 1uz, 1uz));
+    std::ranges::copy(str, storage);
+    storage[str.size()] = u8'\0';
+
+    const auto copied_str = std::u8string_view(storage, str.size());
+    interned_strings_.insert(copied_str);
+    return Wstring{ copied_str };
+}
+
+[[nodiscard]] auto decode_arena::copy(const Warray arr) -> Warray {
+    if (arr.empty()) { return Warray{}; }
+
+    // Wire format aligns arrays to 32-bits, so keep at least that.
+    auto* const storage =
+        static_cast<std::byte*>(resource_.allocate(arr.size(), alignof(std::uint32_t)));
+    std::ranges::copy(arr, storage);
+    return Warray{ std::span<const std::byte>(storage, arr.size()) };
+}
+
+[[nodiscard]] auto decode_arena::interned_string_count() const noexcept -> std::size_t {
+    return interned_strings_.size();
+}
+
+void decode_arena::release() {
+    // Table of the interned strings is allocated from the arena as well,
+    // so it has to be replaced before the arena memory is released.
+    interned_strings_ = std::pmr::unordered_set<std::u8string_view>{ &resource_ };
+    resource_.release();
+}
+
+} // namespace wl
+} // namespace waylander
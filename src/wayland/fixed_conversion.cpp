@@ -0,0 +1,51 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cassert>
+#include <concepts>
+#include <span>
+
+#include "waylander/wayland/fixed_conversion.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+template<std::floating_point T>
+void convert_fixed_to(const std::span<const Wfixed> in, const std::span<T> out) noexcept {
+    assert(out.size() >= in.size());
+
+    // Plain loop without dependencies between the elements, so the compiler turns it into
+    // packed int to float conversions and multiplications.
+    // Power of two, so multiplying by it is exact.
+    constexpr auto inverse_scale = T{ 1 } / Wfixed::scale;
+    const auto* const src        = in.data();
+    auto* const dst              = out.data();
+    for (auto i = 0uz; i < in.size(); ++i) {
+        dst[i] = static_cast<T>(src[i].value) * inverse_scale;
+    }
+}
+} // namespace
+
+void convert_fixed(const std::span<const Wfixed> in, const std::span<float> out) noexcept {
+    convert_fixed_to(in, out);
+}
+
+void convert_fixed(const std::span<const Wfixed> in, const std::span<double> out) noexcept {
+    convert_fixed_to(in, out);
+}
+
+} // namespace wl
+} // namespace waylander
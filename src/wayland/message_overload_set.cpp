@@ -15,6 +15,8 @@
 
 #include <array>
 #include <cstring>
+#include <stdexcept>
+#include <utility>
 
 #include "waylander/wayland/message_overload_set.hpp"
 
@@ -39,13 +41,31 @@ std::size_t
     return std::hash<std::size_t>{}(std::bit_cast<std::size_t>(combined));
 }
 
+void waylander::wl::message_overload_set::insert_overload(const key_t key,
+                                                          erased_overload_t&& overload,
+                                                          const interface_info* const interface) {
+    const auto [_, insert_ok] =
+        overloads_.try_emplace(key, overload_entry{ std::move(overload), interface });
+
+    if (not insert_ok) {
+        throw std::runtime_error{ "Overload for {Wobject<W>, Msg::opcode} already present!" };
+    }
+}
+
 auto waylander::wl::message_overload_set::overload_resolution(const Wobject<generic_object> obj_id,
                                                               const Wopcode<generic_object> opcode)
     -> std::optional<std::reference_wrapper<erased_overload_t>> {
-    const auto ov_resolution = overloads_.find({ obj_id, opcode });
-    if (ov_resolution == overloads_.end()) {
+    const auto entry = find_overload(obj_id, opcode);
+    if (entry == nullptr) {
         return {};
     } else {
-        return ov_resolution->second;
+        return entry->overload;
     }
 }
+
+auto waylander::wl::message_overload_set::find_overload(const Wobject<generic_object> obj_id,
+                                                        const Wopcode<generic_object> opcode)
+    -> overload_entry* {
+    const auto ov_resolution = overloads_.find({ obj_id, opcode });
+    return ov_resolution == overloads_.end() ? nullptr : &ov_resolution->second;
+}
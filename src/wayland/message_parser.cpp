@@ -25,64 +25,75 @@
 namespace waylander {
 namespace wl {
 
-[[nodiscard]] auto parsed_message_generator(const std::span<const std::byte> buff)
-    -> std::generator<const parsed_message&> {
-    // Points to the beginning of the next unparsed message = NUM.
-    auto NUM_begin = buff.begin();
-
-    const auto parse_NUM = [&]() -> parsed_message {
-        const auto unparsed_bytes = std::ranges::distance(NUM_begin, buff.end());
-        if (unparsed_bytes < 8) {
-            throw std::logic_error{
-                "Trying to interpert less than 8 bytes as Wayland message header."
-            };
-        }
-        // Default intialize NUM, meaning that its members:
-        //     - object_id
-        //     - opcode
-        // which are implicit-lifetime types, can be initialized using std::memcpy.
+[[nodiscard]] auto parse_first_message(const std::span<const std::byte> buff) -> parsed_message {
+    if (buff.size() < 8) {
+        throw std::logic_error{
+            "Trying to interpert less than 8 bytes as Wayland message header."
+        };
+    }
+    // Default intialize the message, meaning that its members:
+    //     - object_id
+    //     - opcode
+    // which are implicit-lifetime types, can be initialized using std::memcpy.
 
 #ifdef __cpp_lib_is_implicit_lifetime
-        static_assert(std::is_implicit_lifetime_v<wl::Wmessage_size_t>);
+    static_assert(std::is_implicit_lifetime_v<wl::Wmessage_size_t>);
 
-        static_assert(std::is_implicit_lifetime_v<wl::Wobject<wl::generic_object>>);
-        static_assert(std::is_implicit_lifetime_v<wl::Wopcode<wl::generic_object>>);
+    static_assert(std::is_implicit_lifetime_v<wl::Wobject<wl::generic_object>>);
+    static_assert(std::is_implicit_lifetime_v<wl::Wopcode<wl::generic_object>>);
 #endif
 
-        const auto ptr_to_size =
-            std::ranges::next(NUM_begin, message_header<generic_object>::size_offset);
-        const auto ptr_to_opcode =
-            std::ranges::next(NUM_begin, message_header<generic_object>::opcode_offset);
+    const auto ptr_to_size =
+        std::ranges::next(buff.begin(), message_header<generic_object>::size_offset);
+    const auto ptr_to_opcode =
+        std::ranges::next(buff.begin(), message_header<generic_object>::opcode_offset);
 
-        parsed_message NUM;
-        std::memcpy(&NUM.object_id, &*NUM_begin, sizeof(NUM.object_id));
-        std::memcpy(&NUM.opcode, &*ptr_to_opcode, sizeof(NUM.opcode));
+    parsed_message msg;
+    std::memcpy(&msg.object_id, buff.data(), sizeof(msg.object_id));
+    std::memcpy(&msg.opcode, &*ptr_to_opcode, sizeof(msg.opcode));
 
-        Wmessage_size_t NUM_size;
-        std::memcpy(&NUM_size, &*ptr_to_size, sizeof(NUM_size));
+    Wmessage_size_t msg_size;
+    std::memcpy(&msg_size, &*ptr_to_size, sizeof(msg_size));
 
-        if (NUM_size.value < 8u) {
-            throw std::logic_error{ "Wayland message size is less than 8 bytes." };
-        }
-        if (NUM_size.value > unparsed_bytes) {
-            throw std::logic_error{ "Wayland message size is more than bytes available." };
-        }
+    if (msg_size.value < 8u) {
+        throw std::logic_error{ "Wayland message size is less than 8 bytes." };
+    }
+    if (msg_size.value > buff.size()) {
+        throw std::logic_error{ "Wayland message size is more than bytes available." };
+    }
 
-        const auto ptr_to_arguments =
-            std::ranges::next(NUM_begin, sizeof(message_header<generic_object>));
+    msg.arguments = buff.subspan(sizeof(message_header<generic_object>),
+                                 msg_size.value - sizeof(message_header<generic_object>));
+    return msg;
+}
 
-        NUM.arguments =
-            std::span(ptr_to_arguments, NUM_size.value - sizeof(message_header<generic_object>));
+[[nodiscard]] auto whole_messages_size(const std::span<const std::byte> buff) -> std::size_t {
+    auto whole = 0uz;
+    while (buff.size() - whole >= sizeof(message_header<generic_object>)) {
+        Wmessage_size_t msg_size;
+        std::memcpy(&msg_size,
+                    buff.data() + whole + message_header<generic_object>::size_offset,
+                    sizeof(msg_size));
 
-        return NUM;
-    };
+        // Otherwise the same message would be found again and again.
+        if (msg_size.value < sizeof(message_header<generic_object>)) {
+            throw std::logic_error{ "Wayland message size is less than 8 bytes." };
+        }
+        if (buff.size() - whole < msg_size.value) { break; }
+        whole += msg_size.value;
+    }
+    return whole;
+}
+
+[[nodiscard]] auto parsed_message_generator(const std::span<const std::byte> buff)
+    -> std::generator<const parsed_message&> {
+    // Points to the beginning of the next unparsed message = NUM.
+    auto NUM_begin = 0uz;
 
-    // Message which is being constructed from NUM.
-    while (NUM_begin != buff.end()) {
-        const auto msg = parse_NUM();
+    while (NUM_begin != buff.size()) {
+        const auto msg = parse_first_message(buff.subspan(NUM_begin));
         co_yield msg;
-        const auto tot_size = sizeof(message_header<generic_object>) + msg.arguments.size();
-        std::ranges::advance(NUM_begin, tot_size, buff.end());
+        NUM_begin += sizeof(message_header<generic_object>) + msg.arguments.size();
     }
     co_return;
 }
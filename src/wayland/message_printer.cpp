@@ -0,0 +1,213 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/sstd.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_printer.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+
+[[nodiscard]] auto as_chars(const std::u8string_view str) -> std::string_view {
+    return { reinterpret_cast<const char*>(str.data()), str.size() };
+}
+
+/// Reads arguments of a payload in wire format.
+class payload_reader {
+    std::span<const std::byte> unread_;
+
+  public:
+    [[nodiscard]] explicit payload_reader(const std::span<const std::byte> payload)
+        : unread_{ payload } {}
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return unread_.empty(); }
+
+    template<typename T>
+    [[nodiscard]] auto read() -> T {
+        T x;
+        std::memcpy(&x, take(sizeof(T)).data(), sizeof(T));
+        return x;
+    }
+
+    /// Takes \p size bytes and the padding to 32-bit word after them.
+    [[nodiscard]] auto take(const std::size_t size) -> std::span<const std::byte> {
+        const auto padded = size + sstd::round_upto_multiple_of<4uz>(size);
+        if (unread_.size() < padded) {
+            throw std::logic_error{ "Message payload is shorter than its signature." };
+        }
+        const auto bytes = unread_.first(size);
+        unread_          = unread_.subspan(padded);
+        return bytes;
+    }
+};
+
+} // namespace
+
+[[nodiscard]] message_printer::message_printer(const std::span<const interface_info> interfaces)
+    : interfaces_{ interfaces } {
+    bind(global_display_object, u8"wl_display");
+}
+
+auto message_printer::find_interface(const std::u8string_view name) const
+    -> const interface_info* {
+    const auto found = std::ranges::find(interfaces_, name, &interface_info::name);
+    return found == interfaces_.end() ? nullptr : &*found;
+}
+
+void message_printer::bind(const Wobject<generic_object> obj, const std::u8string_view interface) {
+    if (const auto info = find_interface(interface)) { objects_[obj.value] = info; }
+}
+
+auto message_printer::format(const wire_direction direction, const parsed_message& msg)
+    -> std::string {
+    const auto obj = objects_.find(msg.object_id.value);
+    if (obj == objects_.end()) {
+        return std::format("unknown#{}.opcode {}({} bytes)",
+                           msg.object_id.value,
+                           msg.opcode.value,
+                           msg.arguments.size());
+    }
+
+    const auto& interface = *obj->second;
+    const auto messages =
+        direction == wire_direction::sent ? interface.requests : interface.events;
+
+    if (msg.opcode.value >= messages.size()) {
+        return std::format("{}#{}.opcode {}({} bytes)",
+                           as_chars(interface.name),
+                           msg.object_id.value,
+                           msg.opcode.value,
+                           msg.arguments.size());
+    }
+    const auto& info = messages[msg.opcode.value];
+
+    auto text = std::format("{}#{}.{}(",
+                            as_chars(interface.name),
+                            msg.object_id.value,
+                            as_chars(info.name));
+
+    // Interface of new_id without interface in the metadata is given by the preceding string.
+    auto last_string = std::u8string_view{};
+    auto reader      = payload_reader{ msg.arguments };
+
+    for (const auto& arg : info.arguments) {
+        if (&arg != info.arguments.data()) { text += ", "; }
+        text += std::format("{}: ", as_chars(arg.name));
+
+        switch (arg.type) {
+            case u8'i': text += std::format("{}", reader.read<Wint>().value); break;
+            case u8'u': text += std::format("{}", reader.read<Wuint>().value); break;
+            case u8'f': text += std::format("{}", reader.read<Wfixed>().to_double()); break;
+            case u8'h': text += "fd"; break;
+            case u8's': {
+                const auto size = reader.read<Wstring::size_type>();
+                if (size == 0) {
+                    text += "nil";
+                    break;
+                }
+                // Size includes the null terminator.
+                const auto bytes = reader.take(size);
+                last_string      = { reinterpret_cast<const char8_t*>(bytes.data()), size - 1 };
+                text += std::format("\"{}\"", as_chars(last_string));
+                break;
+            }
+            case u8'a': {
+                const auto size = reader.read<Warray::size_type>();
+                std::ignore     = reader.take(size);
+                text += std::format("array[{}]", size);
+                break;
+            }
+            case u8'o': {
+                const auto id = reader.read<Wuint>().value;
+                if (id == 0) {
+                    text += "nil";
+                    break;
+                }
+                const auto found = objects_.find(id);
+                const auto name  = found != objects_.end() ? found->second->name : arg.interface;
+                text += std::format("{}#{}", as_chars(name), id);
+                break;
+            }
+            case u8'n': {
+                const auto id   = reader.read<Wuint>().value;
+                const auto name = arg.interface.empty() ? last_string : arg.interface;
+                bind({ id }, name);
+                text += std::format("new id {}#{}", as_chars(name), id);
+                break;
+            }
+            default: throw std::logic_error{ "Unknown type in message signature." };
+        }
+    }
+
+    if (not reader.empty()) {
+        throw std::logic_error{ "Message payload is longer than its signature." };
+    }
+
+    if (direction == wire_direction::received and interface.name == u8"wl_display"
+        and info.name == u8"delete_id") {
+        auto deleted = Wuint{};
+        std::memcpy(&deleted, msg.arguments.data(), sizeof(deleted));
+        objects_.erase(deleted.value);
+    }
+
+    text += ")";
+    return text;
+}
+
+[[nodiscard]] auto format_wire_trace(const std::span<const std::byte> trace,
+                                     message_printer& printer) -> std::generator<std::string> {
+    // Beginning of a message which continues in the next record of the same direction.
+    auto partial_sent     = sstd::byte_vec{};
+    auto partial_received = sstd::byte_vec{};
+
+    auto first_timestamp = std::optional<std::chrono::steady_clock::time_point>{};
+
+    for (const auto& record : wire_trace_range{ trace }) {
+        if (not first_timestamp) { first_timestamp = record.timestamp; }
+        const auto ms =
+            std::chrono::duration<double, std::milli>(record.timestamp - *first_timestamp).count();
+
+        const auto sent = record.direction == wire_direction::sent;
+        auto& partial   = sent ? partial_sent : partial_received;
+        partial.insert(partial.end(), record.data.begin(), record.data.end());
+
+        const auto whole = whole_messages_size(partial);
+        for (const auto& msg : parsed_message_range{ std::span{ partial }.first(whole) }) {
+            co_yield std::format("[{:10.3f}] {}{}",
+                                 ms,
+                                 sent ? " -> " : "",
+                                 printer.format(record.direction, msg));
+        }
+        partial.erase(partial.begin(), partial.begin() + static_cast<std::ptrdiff_t>(whole));
+    }
+}
+
+} // namespace wl
+} // namespace waylander
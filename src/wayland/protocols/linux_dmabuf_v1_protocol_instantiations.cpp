@@ -0,0 +1,124 @@
+// Generated from Wayland xml protocol: linux_dmabuf_v1
+
+/// @file
+/// Explicit instantiations of encoding and decoding of linux_dmabuf_v1 messages.
+///
+/// Compiled to the library with meson option explicit_instantiations.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/linux_dmabuf_v1_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_dmabuf_v1>,
+                             const protocols::zwp_linux_dmabuf_v1::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_dmabuf_v1>,
+                             const protocols::zwp_linux_dmabuf_v1::request::create_params&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_dmabuf_v1>,
+                             const protocols::zwp_linux_dmabuf_v1::request::get_default_feedback&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_dmabuf_v1>,
+                             const protocols::zwp_linux_dmabuf_v1::request::get_surface_feedback&);
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::format, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::format;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::format, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::format;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::modifier, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::modifier;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_v1::event::modifier, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_linux_dmabuf_v1::event::modifier;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_buffer_params_v1>,
+                             const protocols::zwp_linux_buffer_params_v1::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_buffer_params_v1>,
+                             const protocols::zwp_linux_buffer_params_v1::request::add&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_buffer_params_v1>,
+                             const protocols::zwp_linux_buffer_params_v1::request::create&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_buffer_params_v1>,
+                             const protocols::zwp_linux_buffer_params_v1::request::create_immed&);
+template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::created,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::created;
+template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::created,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::created;
+template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::failed,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::failed;
+template auto
+decode_message_payload<protocols::zwp_linux_buffer_params_v1::event::failed,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_buffer_params_v1::event::failed;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_linux_dmabuf_feedback_v1>,
+                             const protocols::zwp_linux_dmabuf_feedback_v1::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::done,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::done;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::done,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::done;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::main_device,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::main_device;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::main_device,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::main_device;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_done;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_target_device;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_formats;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags;
+template auto
+decode_message_payload<protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_linux_dmabuf_feedback_v1::event::tranche_flags;
+
+} // namespace wl
+} // namespace waylander
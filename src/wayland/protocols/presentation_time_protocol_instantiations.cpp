@@ -0,0 +1,57 @@
+// Generated from Wayland xml protocol: presentation_time
+
+/// @file
+/// Explicit instantiations of encoding and decoding of presentation_time messages.
+///
+/// Compiled to the library with meson option explicit_instantiations.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/presentation_time_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_presentation>,
+                             const protocols::wp_presentation::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_presentation>,
+                             const protocols::wp_presentation::request::feedback&);
+template auto
+decode_message_payload<protocols::wp_presentation::event::clock_id, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wp_presentation::event::clock_id;
+template auto
+decode_message_payload<protocols::wp_presentation::event::clock_id, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wp_presentation::event::clock_id;
+template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::sync_output,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::sync_output;
+template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::sync_output,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::sync_output;
+template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::presented,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::presented;
+template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::presented,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::presented;
+template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::discarded,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::discarded;
+template auto
+decode_message_payload<protocols::wp_presentation_feedback::event::discarded,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wp_presentation_feedback::event::discarded;
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,352 @@
+// Generated from Wayland xml protocol: tablet_v2
+
+/// @file
+/// Explicit instantiations of encoding and decoding of tablet_v2 messages.
+///
+/// Compiled to the library with meson option explicit_instantiations.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/tablet_v2_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_manager_v2>,
+                             const protocols::zwp_tablet_manager_v2::request::get_tablet_seat&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_manager_v2>,
+                             const protocols::zwp_tablet_manager_v2::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_seat_v2>,
+                             const protocols::zwp_tablet_seat_v2::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tablet_added, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tablet_added;
+template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tablet_added, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tablet_added;
+template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tool_added, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tool_added;
+template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::tool_added, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::tool_added;
+template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::pad_added, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::pad_added;
+template auto
+decode_message_payload<protocols::zwp_tablet_seat_v2::event::pad_added, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_seat_v2::event::pad_added;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_tool_v2>,
+                             const protocols::zwp_tablet_tool_v2::request::set_cursor&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_tool_v2>,
+                             const protocols::zwp_tablet_tool_v2::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::type, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::type;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::type, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::type;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_serial,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_serial;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_serial,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_serial;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_id_wacom,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_id_wacom;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::hardware_id_wacom,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_tool_v2::event::hardware_id_wacom;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::capability, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::capability;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::capability, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::capability;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::removed, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::removed;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::removed, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::removed;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_in, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_in;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_in, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_in;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_out, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_out;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::proximity_out, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::proximity_out;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::down, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::down;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::down, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::down;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::up, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::up;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::up, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::up;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::motion;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::motion;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::pressure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::pressure;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::pressure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::pressure;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::distance, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::distance;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::distance, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::distance;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::tilt, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::tilt;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::tilt, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::tilt;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::rotation, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::rotation;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::rotation, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::rotation;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::slider, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::slider;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::slider, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::slider;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::wheel, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::wheel;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::wheel, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::wheel;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::button, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::button;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::button, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::button;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::frame;
+template auto
+decode_message_payload<protocols::zwp_tablet_tool_v2::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_tool_v2::event::frame;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_v2>,
+                             const protocols::zwp_tablet_v2::request::destroy&);
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::name, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::name;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::name, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::name;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::id, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::id;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::id, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::id;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::path, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::path;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::path, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::path;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::done;
+template auto decode_message_payload<protocols::zwp_tablet_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::removed, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::removed;
+template auto
+decode_message_payload<protocols::zwp_tablet_v2::event::removed, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_v2::event::removed;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_ring_v2>,
+                             const protocols::zwp_tablet_pad_ring_v2::request::set_feedback&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_ring_v2>,
+                             const protocols::zwp_tablet_pad_ring_v2::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::source, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::source;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::source, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::source;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::angle, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::angle;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::angle, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::angle;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::stop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::stop;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::stop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::stop;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::frame;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_ring_v2::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_ring_v2::event::frame;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_strip_v2>,
+                             const protocols::zwp_tablet_pad_strip_v2::request::set_feedback&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_strip_v2>,
+                             const protocols::zwp_tablet_pad_strip_v2::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::source, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::source;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::source, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::source;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::position, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::position;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::position, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::position;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::stop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::stop;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::stop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::stop;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::frame;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_strip_v2::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_strip_v2::event::frame;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_group_v2>,
+                             const protocols::zwp_tablet_pad_group_v2::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::buttons, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::buttons;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::buttons, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::buttons;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::ring, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::ring;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::ring, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::ring;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::strip, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::strip;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::strip, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::strip;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::modes, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::modes;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::modes, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::modes;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_group_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::mode_switch,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_pad_group_v2::event::mode_switch;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_group_v2::event::mode_switch,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::zwp_tablet_pad_group_v2::event::mode_switch;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_v2>,
+                             const protocols::zwp_tablet_pad_v2::request::set_feedback&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::zwp_tablet_pad_v2>,
+                             const protocols::zwp_tablet_pad_v2::request::destroy&);
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::group, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::group;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::group, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::group;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::path, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::path;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::path, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::path;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::buttons, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::buttons;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::buttons, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::buttons;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::done;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::button, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::button;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::button, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::button;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::enter;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::enter;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::leave;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::leave;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::removed, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::removed;
+template auto
+decode_message_payload<protocols::zwp_tablet_pad_v2::event::removed, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::zwp_tablet_pad_v2::event::removed;
+
+} // namespace wl
+} // namespace waylander
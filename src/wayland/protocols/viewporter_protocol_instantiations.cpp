@@ -0,0 +1,36 @@
+// Generated from Wayland xml protocol: viewporter
+
+/// @file
+/// Explicit instantiations of encoding and decoding of viewporter messages.
+///
+/// Compiled to the library with meson option explicit_instantiations.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/viewporter_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_viewporter>,
+                             const protocols::wp_viewporter::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_viewporter>,
+                             const protocols::wp_viewporter::request::get_viewport&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_viewport>,
+                             const protocols::wp_viewport::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_viewport>,
+                             const protocols::wp_viewport::request::set_source&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wp_viewport>,
+                             const protocols::wp_viewport::request::set_destination&);
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,530 @@
+// Generated from Wayland xml protocol: wayland
+
+/// @file
+/// Explicit instantiations of encoding and decoding of wayland messages.
+///
+/// Compiled to the library with meson option explicit_instantiations.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_display>,
+                             const protocols::wl_display::request::sync&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_display>,
+                             const protocols::wl_display::request::get_registry&);
+template auto decode_message_payload<protocols::wl_display::event::error, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_display::event::error;
+template auto decode_message_payload<protocols::wl_display::event::error, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_display::event::error;
+template auto
+decode_message_payload<protocols::wl_display::event::delete_id, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_display::event::delete_id;
+template auto
+decode_message_payload<protocols::wl_display::event::delete_id, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_display::event::delete_id;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_registry>,
+                             const protocols::wl_registry::request::bind&);
+template auto decode_message_payload<protocols::wl_registry::event::global, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global;
+template auto decode_message_payload<protocols::wl_registry::event::global, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global;
+template auto
+decode_message_payload<protocols::wl_registry::event::global_remove, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global_remove;
+template auto
+decode_message_payload<protocols::wl_registry::event::global_remove, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_registry::event::global_remove;
+template auto decode_message_payload<protocols::wl_callback::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_callback::event::done;
+template auto decode_message_payload<protocols::wl_callback::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_callback::event::done;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_compositor>,
+                             const protocols::wl_compositor::request::create_surface&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_compositor>,
+                             const protocols::wl_compositor::request::create_region&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shm_pool>,
+                             const protocols::wl_shm_pool::request::create_buffer&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shm_pool>,
+                             const protocols::wl_shm_pool::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shm_pool>,
+                             const protocols::wl_shm_pool::request::resize&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shm>,
+                             const protocols::wl_shm::request::create_pool&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shm>,
+                             const protocols::wl_shm::request::release&);
+template auto decode_message_payload<protocols::wl_shm::event::format, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shm::event::format;
+template auto decode_message_payload<protocols::wl_shm::event::format, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shm::event::format;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_buffer>,
+                             const protocols::wl_buffer::request::destroy&);
+template auto decode_message_payload<protocols::wl_buffer::event::release, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_buffer::event::release;
+template auto decode_message_payload<protocols::wl_buffer::event::release, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_buffer::event::release;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_offer>,
+                             const protocols::wl_data_offer::request::accept&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_offer>,
+                             const protocols::wl_data_offer::request::receive&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_offer>,
+                             const protocols::wl_data_offer::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_offer>,
+                             const protocols::wl_data_offer::request::finish&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_offer>,
+                             const protocols::wl_data_offer::request::set_actions&);
+template auto
+decode_message_payload<protocols::wl_data_offer::event::offer, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::offer;
+template auto
+decode_message_payload<protocols::wl_data_offer::event::offer, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::offer;
+template auto
+decode_message_payload<protocols::wl_data_offer::event::source_actions, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::source_actions;
+template auto
+decode_message_payload<protocols::wl_data_offer::event::source_actions, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::source_actions;
+template auto
+decode_message_payload<protocols::wl_data_offer::event::action, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::action;
+template auto
+decode_message_payload<protocols::wl_data_offer::event::action, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_offer::event::action;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_source>,
+                             const protocols::wl_data_source::request::offer&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_source>,
+                             const protocols::wl_data_source::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_source>,
+                             const protocols::wl_data_source::request::set_actions&);
+template auto
+decode_message_payload<protocols::wl_data_source::event::target, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::target;
+template auto
+decode_message_payload<protocols::wl_data_source::event::target, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::target;
+template auto
+decode_message_payload<protocols::wl_data_source::event::cancelled, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::cancelled;
+template auto
+decode_message_payload<protocols::wl_data_source::event::cancelled, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::cancelled;
+template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_drop_performed,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_data_source::event::dnd_drop_performed;
+template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_drop_performed,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_data_source::event::dnd_drop_performed;
+template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_finished, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::dnd_finished;
+template auto
+decode_message_payload<protocols::wl_data_source::event::dnd_finished, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::dnd_finished;
+template auto
+decode_message_payload<protocols::wl_data_source::event::action, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::action;
+template auto
+decode_message_payload<protocols::wl_data_source::event::action, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_source::event::action;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_device>,
+                             const protocols::wl_data_device::request::start_drag&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_device>,
+                             const protocols::wl_data_device::request::set_selection&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_device>,
+                             const protocols::wl_data_device::request::release&);
+template auto
+decode_message_payload<protocols::wl_data_device::event::data_offer, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::data_offer;
+template auto
+decode_message_payload<protocols::wl_data_device::event::data_offer, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::data_offer;
+template auto
+decode_message_payload<protocols::wl_data_device::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::enter;
+template auto
+decode_message_payload<protocols::wl_data_device::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::enter;
+template auto
+decode_message_payload<protocols::wl_data_device::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::leave;
+template auto
+decode_message_payload<protocols::wl_data_device::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::leave;
+template auto
+decode_message_payload<protocols::wl_data_device::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::motion;
+template auto
+decode_message_payload<protocols::wl_data_device::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::motion;
+template auto
+decode_message_payload<protocols::wl_data_device::event::drop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::drop;
+template auto
+decode_message_payload<protocols::wl_data_device::event::drop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::drop;
+template auto
+decode_message_payload<protocols::wl_data_device::event::selection, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::selection;
+template auto
+decode_message_payload<protocols::wl_data_device::event::selection, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_data_device::event::selection;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_device_manager>,
+                             const protocols::wl_data_device_manager::request::create_data_source&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_data_device_manager>,
+                             const protocols::wl_data_device_manager::request::get_data_device&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell>,
+                             const protocols::wl_shell::request::get_shell_surface&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::pong&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::move&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::resize&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_toplevel&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_transient&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_fullscreen&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_popup&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_maximized&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_title&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_shell_surface>,
+                             const protocols::wl_shell_surface::request::set_class&);
+template auto
+decode_message_payload<protocols::wl_shell_surface::event::ping, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::ping;
+template auto
+decode_message_payload<protocols::wl_shell_surface::event::ping, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::ping;
+template auto
+decode_message_payload<protocols::wl_shell_surface::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::configure;
+template auto
+decode_message_payload<protocols::wl_shell_surface::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::configure;
+template auto
+decode_message_payload<protocols::wl_shell_surface::event::popup_done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::popup_done;
+template auto
+decode_message_payload<protocols::wl_shell_surface::event::popup_done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_shell_surface::event::popup_done;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::attach&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::damage&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::frame&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::set_opaque_region&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::set_input_region&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::commit&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::set_buffer_transform&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::set_buffer_scale&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::damage_buffer&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_surface>,
+                             const protocols::wl_surface::request::offset&);
+template auto decode_message_payload<protocols::wl_surface::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::enter;
+template auto decode_message_payload<protocols::wl_surface::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::enter;
+template auto decode_message_payload<protocols::wl_surface::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::leave;
+template auto decode_message_payload<protocols::wl_surface::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_surface::event::leave;
+template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_scale,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_scale;
+template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_scale,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_scale;
+template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_transform,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_transform;
+template auto
+decode_message_payload<protocols::wl_surface::event::preferred_buffer_transform,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_surface::event::preferred_buffer_transform;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_seat>,
+                             const protocols::wl_seat::request::get_pointer&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_seat>,
+                             const protocols::wl_seat::request::get_keyboard&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_seat>,
+                             const protocols::wl_seat::request::get_touch&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_seat>,
+                             const protocols::wl_seat::request::release&);
+template auto
+decode_message_payload<protocols::wl_seat::event::capabilities, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::capabilities;
+template auto
+decode_message_payload<protocols::wl_seat::event::capabilities, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::capabilities;
+template auto decode_message_payload<protocols::wl_seat::event::name, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::name;
+template auto decode_message_payload<protocols::wl_seat::event::name, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_seat::event::name;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_pointer>,
+                             const protocols::wl_pointer::request::set_cursor&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_pointer>,
+                             const protocols::wl_pointer::request::release&);
+template auto decode_message_payload<protocols::wl_pointer::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::enter;
+template auto decode_message_payload<protocols::wl_pointer::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::enter;
+template auto decode_message_payload<protocols::wl_pointer::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::leave;
+template auto decode_message_payload<protocols::wl_pointer::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::leave;
+template auto decode_message_payload<protocols::wl_pointer::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::motion;
+template auto decode_message_payload<protocols::wl_pointer::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::motion;
+template auto decode_message_payload<protocols::wl_pointer::event::button, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::button;
+template auto decode_message_payload<protocols::wl_pointer::event::button, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::button;
+template auto decode_message_payload<protocols::wl_pointer::event::axis, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis;
+template auto decode_message_payload<protocols::wl_pointer::event::axis, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis;
+template auto decode_message_payload<protocols::wl_pointer::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::frame;
+template auto decode_message_payload<protocols::wl_pointer::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::frame;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_source, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_source;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_source, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_source;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_stop, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_stop;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_stop, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_stop;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_discrete, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_discrete;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_discrete, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_discrete;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_value120, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_value120;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_value120, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_pointer::event::axis_value120;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_relative_direction,
+                       decode_policy::trusted>(std::span<const std::byte>)
+    -> protocols::wl_pointer::event::axis_relative_direction;
+template auto
+decode_message_payload<protocols::wl_pointer::event::axis_relative_direction,
+                       decode_policy::checked>(std::span<const std::byte>)
+    -> protocols::wl_pointer::event::axis_relative_direction;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_keyboard>,
+                             const protocols::wl_keyboard::request::release&);
+template auto decode_message_payload<protocols::wl_keyboard::event::enter, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::enter;
+template auto decode_message_payload<protocols::wl_keyboard::event::enter, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::enter;
+template auto decode_message_payload<protocols::wl_keyboard::event::leave, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::leave;
+template auto decode_message_payload<protocols::wl_keyboard::event::leave, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::leave;
+template auto decode_message_payload<protocols::wl_keyboard::event::key, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::key;
+template auto decode_message_payload<protocols::wl_keyboard::event::key, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::key;
+template auto
+decode_message_payload<protocols::wl_keyboard::event::modifiers, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::modifiers;
+template auto
+decode_message_payload<protocols::wl_keyboard::event::modifiers, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::modifiers;
+template auto
+decode_message_payload<protocols::wl_keyboard::event::repeat_info, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::repeat_info;
+template auto
+decode_message_payload<protocols::wl_keyboard::event::repeat_info, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_keyboard::event::repeat_info;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_touch>,
+                             const protocols::wl_touch::request::release&);
+template auto decode_message_payload<protocols::wl_touch::event::down, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::down;
+template auto decode_message_payload<protocols::wl_touch::event::down, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::down;
+template auto decode_message_payload<protocols::wl_touch::event::up, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::up;
+template auto decode_message_payload<protocols::wl_touch::event::up, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::up;
+template auto decode_message_payload<protocols::wl_touch::event::motion, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::motion;
+template auto decode_message_payload<protocols::wl_touch::event::motion, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::motion;
+template auto decode_message_payload<protocols::wl_touch::event::frame, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::frame;
+template auto decode_message_payload<protocols::wl_touch::event::frame, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::frame;
+template auto decode_message_payload<protocols::wl_touch::event::cancel, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::cancel;
+template auto decode_message_payload<protocols::wl_touch::event::cancel, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::cancel;
+template auto decode_message_payload<protocols::wl_touch::event::shape, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::shape;
+template auto decode_message_payload<protocols::wl_touch::event::shape, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::shape;
+template auto
+decode_message_payload<protocols::wl_touch::event::orientation, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::orientation;
+template auto
+decode_message_payload<protocols::wl_touch::event::orientation, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_touch::event::orientation;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_output>,
+                             const protocols::wl_output::request::release&);
+template auto decode_message_payload<protocols::wl_output::event::geometry, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::geometry;
+template auto decode_message_payload<protocols::wl_output::event::geometry, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::geometry;
+template auto decode_message_payload<protocols::wl_output::event::mode, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::mode;
+template auto decode_message_payload<protocols::wl_output::event::mode, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::mode;
+template auto decode_message_payload<protocols::wl_output::event::done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::done;
+template auto decode_message_payload<protocols::wl_output::event::done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::done;
+template auto decode_message_payload<protocols::wl_output::event::scale, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::scale;
+template auto decode_message_payload<protocols::wl_output::event::scale, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::scale;
+template auto decode_message_payload<protocols::wl_output::event::name, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::name;
+template auto decode_message_payload<protocols::wl_output::event::name, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::name;
+template auto
+decode_message_payload<protocols::wl_output::event::description, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::wl_output::event::description;
+template auto
+decode_message_payload<protocols::wl_output::event::description, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::wl_output::event::description;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_region>,
+                             const protocols::wl_region::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_region>,
+                             const protocols::wl_region::request::add&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_region>,
+                             const protocols::wl_region::request::subtract&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subcompositor>,
+                             const protocols::wl_subcompositor::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subcompositor>,
+                             const protocols::wl_subcompositor::request::get_subsurface&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subsurface>,
+                             const protocols::wl_subsurface::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subsurface>,
+                             const protocols::wl_subsurface::request::set_position&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subsurface>,
+                             const protocols::wl_subsurface::request::place_above&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subsurface>,
+                             const protocols::wl_subsurface::request::place_below&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subsurface>,
+                             const protocols::wl_subsurface::request::set_sync&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_subsurface>,
+                             const protocols::wl_subsurface::request::set_desync&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_fixes>,
+                             const protocols::wl_fixes::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::wl_fixes>,
+                             const protocols::wl_fixes::request::destroy_registry&);
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,179 @@
+// Generated from Wayland xml protocol: xdg_shell
+
+/// @file
+/// Explicit instantiations of encoding and decoding of xdg_shell messages.
+///
+/// Compiled to the library with meson option explicit_instantiations.
+
+#include <cstddef>
+#include <span>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_wm_base>,
+                             const protocols::xdg_wm_base::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_wm_base>,
+                             const protocols::xdg_wm_base::request::create_positioner&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_wm_base>,
+                             const protocols::xdg_wm_base::request::get_xdg_surface&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_wm_base>,
+                             const protocols::xdg_wm_base::request::pong&);
+template auto decode_message_payload<protocols::xdg_wm_base::event::ping, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_wm_base::event::ping;
+template auto decode_message_payload<protocols::xdg_wm_base::event::ping, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_wm_base::event::ping;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_size&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_anchor_rect&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_anchor&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_gravity&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_constraint_adjustment&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_offset&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_reactive&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_parent_size&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_positioner>,
+                             const protocols::xdg_positioner::request::set_parent_configure&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_surface>,
+                             const protocols::xdg_surface::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_surface>,
+                             const protocols::xdg_surface::request::get_toplevel&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_surface>,
+                             const protocols::xdg_surface::request::get_popup&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_surface>,
+                             const protocols::xdg_surface::request::set_window_geometry&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_surface>,
+                             const protocols::xdg_surface::request::ack_configure&);
+template auto
+decode_message_payload<protocols::xdg_surface::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_surface::event::configure;
+template auto
+decode_message_payload<protocols::xdg_surface::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_surface::event::configure;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_parent&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_title&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_app_id&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::show_window_menu&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::move&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::resize&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_max_size&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_min_size&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_maximized&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::unset_maximized&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_fullscreen&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::unset_fullscreen&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_toplevel>,
+                             const protocols::xdg_toplevel::request::set_minimized&);
+template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure;
+template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure;
+template auto decode_message_payload<protocols::xdg_toplevel::event::close, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::close;
+template auto decode_message_payload<protocols::xdg_toplevel::event::close, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::close;
+template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure_bounds, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure_bounds;
+template auto
+decode_message_payload<protocols::xdg_toplevel::event::configure_bounds, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::configure_bounds;
+template auto
+decode_message_payload<protocols::xdg_toplevel::event::wm_capabilities, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::wm_capabilities;
+template auto
+decode_message_payload<protocols::xdg_toplevel::event::wm_capabilities, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_toplevel::event::wm_capabilities;
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_popup>,
+                             const protocols::xdg_popup::request::destroy&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_popup>,
+                             const protocols::xdg_popup::request::grab&);
+template void encode_request(message_buffer&,
+                             Wobject<protocols::xdg_popup>,
+                             const protocols::xdg_popup::request::reposition&);
+template auto
+decode_message_payload<protocols::xdg_popup::event::configure, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::configure;
+template auto
+decode_message_payload<protocols::xdg_popup::event::configure, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::configure;
+template auto
+decode_message_payload<protocols::xdg_popup::event::popup_done, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::popup_done;
+template auto
+decode_message_payload<protocols::xdg_popup::event::popup_done, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::popup_done;
+template auto
+decode_message_payload<protocols::xdg_popup::event::repositioned, decode_policy::trusted>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::repositioned;
+template auto
+decode_message_payload<protocols::xdg_popup::event::repositioned, decode_policy::checked>(
+    std::span<const std::byte>) -> protocols::xdg_popup::event::repositioned;
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,254 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/request_coalescer.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+
+using wl_surface = protocols::wl_surface;
+
+/// Half-open rectangle [x0, x1) x [y0, y1), which is wide enough to not overflow.
+struct rectangle {
+    std::int64_t x0, y0, x1, y1;
+
+    /// Area as floating point, as it might not fit to any integer type.
+    [[nodiscard]] constexpr double area() const {
+        return static_cast<double>(x1 - x0) * static_cast<double>(y1 - y0);
+    }
+};
+
+[[nodiscard]] constexpr auto bounding_box(const rectangle& a, const rectangle& b) -> rectangle {
+    return {
+        std::min(a.x0, b.x0), std::min(a.y0, b.y0), std::max(a.x1, b.x1), std::max(a.y1, b.y1)
+    };
+}
+
+[[nodiscard]] constexpr bool touch_or_overlap(const rectangle& a, const rectangle& b) {
+    return a.x0 <= b.x1 and b.x0 <= a.x1 and a.y0 <= b.y1 and b.y0 <= a.y1;
+}
+
+/// Bounded set of non-touching damage rectangles.
+class damage_region {
+    std::array<rectangle, max_coalesced_damage_rectangles> rects_{};
+    std::size_t size_{ 0 };
+
+  public:
+    void add(rectangle r) {
+        // Absorb rectangles touching r, which might make it touch previously separate ones.
+        for (auto i = 0uz; i < size_;) {
+            if (touch_or_overlap(rects_[i], r)) {
+                r         = bounding_box(rects_[i], r);
+                rects_[i] = rects_[--size_];
+                i         = 0;
+            } else {
+                ++i;
+            }
+        }
+
+        if (size_ == rects_.size()) {
+            const auto growth = [&](const rectangle& x) {
+                return bounding_box(x, r).area() - x.area();
+            };
+            const auto least_growing =
+                std::ranges::min_element(std::span(rects_).first(size_), {}, growth);
+            const auto merged = bounding_box(*least_growing, r);
+            *least_growing    = rects_[--size_];
+            add(merged);
+            return;
+        }
+
+        rects_[size_++] = r;
+    }
+
+    [[nodiscard]] auto rectangles() const -> std::span<const rectangle> {
+        return std::span(rects_).first(size_);
+    }
+};
+
+/// Requests of one surface since its last commit.
+struct surface_state {
+    damage_region damage{};
+    damage_region damage_buffer{};
+    std::optional<std::size_t> last_damage{};
+    std::optional<std::size_t> last_damage_buffer{};
+    std::optional<std::size_t> last_opaque_region{};
+    std::optional<std::size_t> last_input_region{};
+};
+
+/// Damage requests which replace the request at the index they are stored with.
+struct damage_replacement {
+    Wopcode<wl_surface> opcode;
+    damage_region region;
+};
+
+template<typename DamageRequest>
+void append_damage(message_buffer& buff,
+                   const Wobject<wl_surface> surface,
+                   const damage_region& region) {
+    constexpr auto max_extent = std::int64_t{ std::numeric_limits<Wint::integral_type>::max() };
+    for (const auto& r : region.rectangles()) {
+        buff.append(surface,
+                    DamageRequest{ .x{ static_cast<Wint::integral_type>(r.x0) },
+                                   .y{ static_cast<Wint::integral_type>(r.y0) },
+                                   .width{ static_cast<Wint::integral_type>(
+                                       std::min(r.x1 - r.x0, max_extent)) },
+                                   .height{ static_cast<Wint::integral_type>(
+                                       std::min(r.y1 - r.y0, max_extent)) } });
+    }
+}
+
+} // namespace
+
+void coalesce_surface_requests(message_buffer& buff,
+                               const std::span<const Wobject<wl_surface>> surfaces) {
+    if (surfaces.empty() or buff.empty()) { return; }
+
+    struct message_info {
+        parsed_message msg;
+        std::span<const std::byte> bytes;
+        bool keep;
+    };
+
+    // Bookkeeping of a typical frame fits to the stack, rest comes from the resource of buff.
+    auto scratch_storage = std::array<std::byte, 4096>{};
+    auto scratch         = std::pmr::monotonic_buffer_resource{ scratch_storage.data(),
+                                                                scratch_storage.size(),
+                                                                buff.resource() };
+
+    const auto message_range = parsed_message_range{ buff.data() };
+    auto messages            = std::pmr::vector<message_info>{ &scratch };
+    messages.reserve(static_cast<std::size_t>(std::ranges::distance(message_range)));
+    for (const auto& msg : message_range) {
+        constexpr auto header_size = sizeof(message_header<generic_object>);
+        const auto msg_bytes =
+            std::span(msg.arguments.data() - header_size, header_size + msg.arguments.size());
+        messages.push_back({ msg, msg_bytes, true });
+    }
+
+    auto states = std::pmr::unordered_map<Wobject<>::integral_type, surface_state>{ &scratch };
+    for (const auto surface : surfaces) { states.try_emplace(surface.value); }
+
+    auto replacements = std::pmr::unordered_map<std::size_t, damage_replacement>{ &scratch };
+
+    const auto end_of_segment = [&](surface_state& state) {
+        if (state.last_damage) {
+            replacements.try_emplace(
+                *state.last_damage,
+                damage_replacement{ wl_surface::request::damage::opcode, state.damage });
+        }
+        if (state.last_damage_buffer) {
+            replacements.try_emplace(*state.last_damage_buffer,
+                                     damage_replacement{ wl_surface::request::damage_buffer::opcode,
+                                                         state.damage_buffer });
+        }
+        state = {};
+    };
+
+    for (auto i = 0uz; i < messages.size(); ++i) {
+        const auto state_it = states.find(messages[i].msg.object_id.value);
+        if (state_it == states.end()) { continue; }
+        auto& state = state_it->second;
+
+        const auto keep_only_latest = [&](std::optional<std::size_t>& latest) {
+            if (latest) { messages[*latest].keep = false; }
+            latest = i;
+        };
+
+        const auto accumulate_damage = [&]<typename DamageRequest>(
+                                           std::type_identity<DamageRequest>,
+                                           damage_region& region,
+                                           std::optional<std::size_t>& last) {
+            const auto d = interpert_message_payload<DamageRequest>(messages[i].msg.arguments);
+            messages[i].keep = false;
+            last             = i;
+
+            const auto is_empty = d.width.value <= 0 or d.height.value <= 0;
+            if (not is_empty) {
+                region.add({ d.x.value,
+                             d.y.value,
+                             std::int64_t{ d.x.value } + d.width.value,
+                             std::int64_t{ d.y.value } + d.height.value });
+            }
+        };
+
+        switch (messages[i].msg.opcode.value) {
+            case wl_surface::request::damage::opcode.value:
+                accumulate_damage(std::type_identity<wl_surface::request::damage>{},
+                                  state.damage,
+                                  state.last_damage);
+                break;
+            case wl_surface::request::damage_buffer::opcode.value:
+                accumulate_damage(std::type_identity<wl_surface::request::damage_buffer>{},
+                                  state.damage_buffer,
+                                  state.last_damage_buffer);
+                break;
+            case wl_surface::request::set_opaque_region::opcode.value:
+                keep_only_latest(state.last_opaque_region);
+                break;
+            case wl_surface::request::set_input_region::opcode.value:
+                keep_only_latest(state.last_input_region);
+                break;
+            case wl_surface::request::commit::opcode.value:
+            case wl_surface::request::destroy::opcode.value: end_of_segment(state); break;
+            default: break;
+        }
+    }
+
+    for (auto& [_, state] : states) { end_of_segment(state); }
+
+    // Same resource as buff, so moving it to buff below does not copy.
+    auto coalesced = message_buffer{ buff.resource() };
+    for (auto i = 0uz; i < messages.size(); ++i) {
+        const auto replacement = replacements.find(i);
+        if (replacement != replacements.end()) {
+            const auto surface           = Wobject<wl_surface>{ messages[i].msg.object_id.value };
+            const auto& [opcode, region] = replacement->second;
+            if (opcode == wl_surface::request::damage::opcode) {
+                append_damage<wl_surface::request::damage>(coalesced, surface, region);
+            } else {
+                append_damage<wl_surface::request::damage_buffer>(coalesced, surface, region);
+            }
+        } else if (messages[i].keep) {
+            coalesced.append_encoded(messages[i].bytes);
+        }
+    }
+    // Requests of wl_surface do not have file descriptors, so all of them are kept in order.
+    coalesced.append_encoded({}, buff.fds());
+
+    buff = std::move(coalesced);
+}
+
+} // namespace wl
+} // namespace waylander
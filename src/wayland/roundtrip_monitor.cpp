@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+#include "waylander/wayland/roundtrip_monitor.hpp"
+
+namespace waylander {
+namespace wl {
+
+auto latency_histogram::percentile(const double percent) const noexcept
+    -> std::chrono::nanoseconds {
+    if (total_count_ == 0) { return {}; }
+
+    const auto wanted = std::max(
+        std::uint64_t{ 1 },
+        static_cast<std::uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(total_count_))));
+
+    auto seen = std::uint64_t{ 0 };
+    for (auto bucket = 0uz; bucket < bucket_count; ++bucket) {
+        seen += counts_[bucket];
+        if (seen >= wanted) {
+            return std::chrono::nanoseconds{ static_cast<std::int64_t>(lowest_of(bucket)) };
+        }
+    }
+    return max_;
+}
+
+void roundtrip_monitor::poll(const clock::time_point now) {
+    using namespace protocols;
+
+    // Overloads can not be removed while they are invoked, so it is done here.
+    if (answered_callback_) {
+        overloads_.remove_overload({ answered_callback_->value },
+                                   { wl_callback::event::done::opcode.value });
+        answered_callback_.reset();
+    }
+
+    check_for_stall(now);
+    if (awaiting_roundtrip() or now < next_sync_) { return; }
+
+    const auto callback = client_.reserve_object_id<wl_callback>();
+    overloads_.add_overload<wl_callback::event::done>(callback, [this, callback](const auto&) {
+        const auto pending = pending_sync_.exchange(no_pending_sync, std::memory_order::acq_rel);
+        const auto sent_at = clock::time_point{ clock::duration{ pending >> 1 } };
+        roundtrips_.record(client_.last_read_time() - sent_at);
+        answered_callback_ = callback;
+    });
+    client_.register_request(global_display_object, wl_display::request::sync{ callback });
+    client_.flush_registered_requests();
+
+    const auto sent_at = clock::now();
+    next_sync_         = now + config_.sync_interval;
+    pending_sync_.store(sent_at.time_since_epoch().count() << 1, std::memory_order::release);
+}
+
+void roundtrip_monitor::check_for_stall(const clock::time_point now) {
+    auto pending = pending_sync_.load(std::memory_order::acquire);
+    if (pending == no_pending_sync or (pending & stall_reported)) { return; }
+
+    const auto waited = now - clock::time_point{ clock::duration{ pending >> 1 } };
+    if (waited < config_.stall_threshold) { return; }
+
+    // Fails if the sync was answered, a new one was sent or another thread reported it.
+    if (not pending_sync_.compare_exchange_strong(pending,
+                                                  pending | stall_reported,
+                                                  std::memory_order::acq_rel)) {
+        return;
+    }
+
+    report({ .kind     = stall_kind::compositor,
+             .duration = std::chrono::duration_cast<std::chrono::nanoseconds>(waited) });
+}
+
+void roundtrip_monitor::monitor_pings(const Wobject<protocols::xdg_wm_base> wm_base) {
+    using namespace protocols;
+
+    overloads_.add_overload<xdg_wm_base::event::ping>(wm_base, [this, wm_base](const auto& ping) {
+        client_.register_request(wm_base, xdg_wm_base::request::pong{ ping.serial });
+        const auto response = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            clock::now() - client_.last_read_time());
+        client_.flush_registered_requests();
+
+        ping_responses_.record(response);
+        if (response > config_.ping_threshold) {
+            report({ .kind = stall_kind::ping_response, .duration = response });
+        }
+    });
+}
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,180 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "waylander/wayland/timeline_tracer.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+
+/// Ids are never reused, so a thread can not mistake a new tracer for a destroyed one.
+constinit auto next_tracer_id = std::atomic<std::uint64_t>{ 0 };
+
+[[nodiscard]] auto as_string_view(const std::u8string_view str) -> std::string_view {
+    return { reinterpret_cast<const char*>(str.data()), str.size() };
+}
+
+/// Name of the message of \p record, e.g. wl_surface.commit.
+[[nodiscard]] auto message_name(const timeline_record& record) -> std::string {
+    if (record.interface == nullptr) {
+        return std::format("{}#{}.opcode {}",
+                           record.kind == timeline_kind::request ? "request" : "event",
+                           record.object.value,
+                           record.opcode.value);
+    }
+    const auto messages = record.kind == timeline_kind::request ? record.interface->requests
+                                                                 : record.interface->events;
+    const auto interface = as_string_view(record.interface->name);
+    if (record.opcode.value >= messages.size()) {
+        return std::format("{}.opcode {}", interface, record.opcode.value);
+    }
+    return std::format("{}.{}", interface, as_string_view(messages[record.opcode.value].name));
+}
+
+[[nodiscard]] auto event_name(const timeline_record& record) -> std::string {
+    switch (record.kind) {
+        case timeline_kind::socket_read: return "read";
+        case timeline_kind::flush: return "flush";
+        case timeline_kind::request:
+        case timeline_kind::dispatch: return message_name(record);
+        case timeline_kind::until: return "until " + message_name(record);
+    }
+    return "unknown";
+}
+
+[[nodiscard]] auto event_args(const timeline_record& record) -> std::string {
+    switch (record.kind) {
+        case timeline_kind::socket_read: return std::format("{{\"bytes\": {}}}", record.bytes);
+        case timeline_kind::flush:
+            return std::format("{{\"bytes\": {}, \"fds\": {}}}", record.bytes, record.fds);
+        case timeline_kind::request:
+        case timeline_kind::dispatch:
+        case timeline_kind::until:
+            return std::format("{{\"object\": {}, \"opcode\": {}}}",
+                               record.object.value,
+                               record.opcode.value);
+    }
+    return "{}";
+}
+
+/// Microseconds with nanosecond precision, which is the unit of trace-event timestamps.
+[[nodiscard]] auto as_microseconds(const std::chrono::nanoseconds ns) -> std::string {
+    return std::format("{}.{:03}", ns.count() / 1000, ns.count() % 1000);
+}
+
+} // namespace
+
+[[nodiscard]] timeline_tracer::timeline_tracer(const std::size_t records_per_thread)
+    : id_{ next_tracer_id.fetch_add(1, std::memory_order::relaxed) },
+      records_per_thread_{ std::max(records_per_thread, 1uz) } {}
+
+auto timeline_tracer::this_thread_buffer() -> thread_buffer& {
+    struct cached_buffer {
+        std::uint64_t tracer_id;
+        thread_buffer* buffer;
+    };
+    thread_local auto cache = std::vector<cached_buffer>{};
+
+    const auto cached =
+        std::ranges::find(cache, id_, [](const cached_buffer& c) { return c.tracer_id; });
+    if (cached != cache.end()) { return *cached->buffer; }
+
+    auto buffer = std::make_unique<thread_buffer>(::gettid(),
+                                                  std::vector<timeline_record>{},
+                                                  0uz);
+    buffer->ring.reserve(records_per_thread_);
+
+    const auto lock = std::scoped_lock{ buffers_mutex_ };
+    cache.push_back({ id_, buffer.get() });
+    return *buffers_.emplace_back(std::move(buffer));
+}
+
+void timeline_tracer::record(const timeline_record& record) {
+    auto& buffer = this_thread_buffer();
+    if (buffer.ring.size() < records_per_thread_) {
+        buffer.ring.push_back(record);
+    } else {
+        buffer.ring[buffer.recorded % records_per_thread_] = record;
+    }
+    ++buffer.recorded;
+}
+
+auto timeline_tracer::overwritten_records() -> std::size_t {
+    const auto lock  = std::scoped_lock{ buffers_mutex_ };
+    auto overwritten = 0uz;
+    for (const auto& buffer : buffers_) { overwritten += buffer->recorded - buffer->ring.size(); }
+    return overwritten;
+}
+
+auto timeline_tracer::chrome_trace_json() -> std::string {
+    const auto lock = std::scoped_lock{ buffers_mutex_ };
+    const auto pid  = ::getpid();
+
+    auto out   = std::string{ "{\n    \"displayTimeUnit\": \"ns\",\n    \"traceEvents\": [" };
+    auto first = true;
+    for (const auto& buffer : buffers_) {
+        // Oldest kept record is the next one to be overwritten.
+        const auto size  = buffer->ring.size();
+        const auto begin = buffer->recorded % size;
+        for (auto i = 0uz; i < size; ++i) {
+            const auto& record = buffer->ring[(begin + i) % size];
+            const auto ts      = as_microseconds(record.begin.time_since_epoch());
+            out += std::format("{}\n        {{ \"name\": \"{}\", \"cat\": \"waylander\", ",
+                               first ? "" : ",",
+                               event_name(record));
+            if (record.kind == timeline_kind::request) {
+                out += std::format("\"ph\": \"i\", \"s\": \"t\", \"ts\": {}, ", ts);
+            } else {
+                out += std::format("\"ph\": \"X\", \"ts\": {}, \"dur\": {}, ",
+                                   ts,
+                                   as_microseconds(record.duration));
+            }
+            out += std::format("\"pid\": {}, \"tid\": {}, \"args\": {} }}",
+                               pid,
+                               buffer->thread_id,
+                               event_args(record));
+            first = false;
+        }
+    }
+    out += "\n    ]\n}\n";
+    return out;
+}
+
+void timeline_tracer::write_chrome_trace(const std::filesystem::path& path) {
+    auto file = std::ofstream{ path };
+    file << chrome_trace_json();
+    if (not file) { throw std::runtime_error{ "Could not write timeline " + path.string() }; }
+}
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,29 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "tracepoints.hpp"
+
+#ifdef WAYLANDER_TRACEPOINTS
+
+// Like the semaphores generated by dtrace -G, the tracers find them from section .probes.
+extern "C" {
+unsigned short waylander_flush_semaphore __attribute__((unused, section(".probes")))       = 0;
+unsigned short waylander_recv_semaphore __attribute__((unused, section(".probes")))        = 0;
+unsigned short waylander_dispatch_semaphore __attribute__((unused, section(".probes")))    = 0;
+unsigned short waylander_until_entry_semaphore __attribute__((unused, section(".probes"))) = 0;
+unsigned short waylander_until_exit_semaphore __attribute__((unused, section(".probes")))  = 0;
+}
+
+#endif
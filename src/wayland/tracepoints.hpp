@@ -0,0 +1,52 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// Implements USDT static tracepoints of provider waylander, see README.
+///
+/// Tracepoints are built only with WAYLANDER_TRACEPOINTS, which is defined when
+/// <sys/sdt.h> is available. Unattached tracepoint is a single nop instruction.
+///
+/// Each tracepoint has a semaphore, which is incremented by the tracer when it attaches,
+/// so arguments that are costly to compute can be computed only for attached tracepoints,
+/// see WAYLANDER_TRACEPOINT_ENABLED.
+
+#ifdef WAYLANDER_TRACEPOINTS
+
+#    define _SDT_HAS_SEMAPHORES 1
+#    include <sys/sdt.h>
+
+extern "C" {
+/// Semaphores of the tracepoints, defined in tracepoints.cpp.
+extern unsigned short waylander_flush_semaphore;
+extern unsigned short waylander_recv_semaphore;
+extern unsigned short waylander_dispatch_semaphore;
+extern unsigned short waylander_until_entry_semaphore;
+extern unsigned short waylander_until_exit_semaphore;
+}
+
+#    define WAYLANDER_TRACEPOINT(name, ...) STAP_PROBEV(waylander, name, __VA_ARGS__)
+#    define WAYLANDER_TRACEPOINT_ENABLED(name) \
+        (__builtin_expect(waylander_##name##_semaphore, 0) != 0)
+
+#else
+
+// Arguments are passed to an empty lambda, so they count as used but are optimized out.
+#    define WAYLANDER_TRACEPOINT(name, ...)     [](const auto&...) {}(__VA_ARGS__)
+#    define WAYLANDER_TRACEPOINT_ENABLED(name) false
+
+#endif
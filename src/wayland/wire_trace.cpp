@@ -0,0 +1,197 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/sstd.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+
+/// Size of a record with its header and padding.
+[[nodiscard]] constexpr auto record_size(const std::size_t data_size) noexcept {
+    return sizeof(wire_trace_record_header) + data_size
+           + sstd::round_upto_multiple_of<8uz>(data_size);
+}
+
+} // namespace
+
+[[nodiscard]] wire_trace_ring::wire_trace_ring(const std::size_t capacity)
+    : capacity_{ std::bit_ceil(std::max(capacity, 64uz)) },
+      storage_{ std::make_unique_for_overwrite<std::byte[]>(capacity_) } {}
+
+void wire_trace_ring::copy_in(const std::size_t position,
+                              const std::span<const std::byte> bytes) noexcept {
+    const auto begin = position & (capacity_ - 1);
+    const auto first = std::min(bytes.size(), capacity_ - begin);
+    std::memcpy(storage_.get() + begin, bytes.data(), first);
+    std::memcpy(storage_.get(), bytes.data() + first, bytes.size() - first);
+}
+
+bool wire_trace_ring::record(const wire_direction direction,
+                             const std::span<const std::byte> bytes,
+                             const std::size_t fd_count) noexcept {
+    const auto head     = head_.load(std::memory_order::relaxed);
+    const auto tail     = tail_.load(std::memory_order::acquire);
+    const auto required = record_size(bytes.size());
+
+    if (required > capacity_ - (head - tail)
+        or bytes.size() > std::numeric_limits<std::uint32_t>::max()) {
+        dropped_records_.fetch_add(1, std::memory_order::relaxed);
+        return false;
+    }
+
+    const auto now    = std::chrono::steady_clock::now().time_since_epoch();
+    const auto header = wire_trace_record_header{
+        .timestamp = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()),
+        .size      = static_cast<std::uint32_t>(bytes.size()),
+        .fd_count  = static_cast<std::uint16_t>(
+            std::min<std::size_t>(fd_count, std::numeric_limits<std::uint16_t>::max())),
+        .direction = direction,
+    };
+
+    static constexpr auto padding = std::array<std::byte, 8>{};
+    const auto padding_size       = required - sizeof(header) - bytes.size();
+
+    copy_in(head, std::as_bytes(std::span{ &header, 1 }));
+    copy_in(head + sizeof(header), bytes);
+    copy_in(head + sizeof(header) + bytes.size(), std::span{ padding }.first(padding_size));
+
+    head_.store(head + required, std::memory_order::release);
+    return true;
+}
+
+[[nodiscard]] wire_trace_file::wire_trace_file(const std::filesystem::path& path)
+    : fd_{ ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) } {
+    if (fd_ == -1) { sstd::throw_generic_system_error(); }
+    append(wire_trace_magic);
+}
+
+wire_trace_file::~wire_trace_file() {
+    if (mapping_ != nullptr) { ::munmap(mapping_, mapping_size_); }
+    // Drop the unwritten part of the last growth.
+    std::ignore = ::ftruncate(fd_, static_cast<off_t>(size_));
+    ::close(fd_);
+}
+
+void wire_trace_file::reserve(const std::size_t size) {
+    if (size <= mapping_size_) { return; }
+
+    // Grow geometrically, so that the file is remapped rarely.
+    static constexpr auto min_mapping_size = 64uz * 1024uz;
+    const auto new_size                    = std::bit_ceil(std::max(size, min_mapping_size));
+
+    if (::ftruncate(fd_, static_cast<off_t>(new_size)) == -1) {
+        sstd::throw_generic_system_error();
+    }
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_      = nullptr;
+        mapping_size_ = 0;
+    }
+
+    void* const mapping = ::mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) { sstd::throw_generic_system_error(); }
+    mapping_      = static_cast<std::byte*>(mapping);
+    mapping_size_ = new_size;
+}
+
+void wire_trace_file::append(const std::span<const std::byte> bytes) {
+    reserve(size_ + bytes.size());
+    std::ranges::copy(bytes, mapping_ + size_);
+    size_ += bytes.size();
+}
+
+[[nodiscard]] auto read_wire_trace_file(const std::filesystem::path& path) -> sstd::byte_vec {
+    auto file = std::ifstream{ path, std::ios::binary };
+    if (not file) { throw std::runtime_error{ "Could not open wire trace " + path.string() }; }
+
+    auto trace = sstd::byte_vec(std::filesystem::file_size(path));
+    file.read(reinterpret_cast<char*>(trace.data()), static_cast<std::streamsize>(trace.size()));
+    return trace;
+}
+
+[[nodiscard]] wire_trace_range::wire_trace_range(const std::span<const std::byte> trace) {
+    if (trace.size() < wire_trace_magic.size()
+        or not std::ranges::equal(trace.first(wire_trace_magic.size()), wire_trace_magic)) {
+        throw std::logic_error{ "Wire trace does not begin with wire_trace_magic." };
+    }
+    records_ = trace.subspan(wire_trace_magic.size());
+}
+
+[[nodiscard]] wire_trace_range::iterator::iterator(const std::span<const std::byte> records)
+    : unread_{ records } {
+    read_current();
+}
+
+void wire_trace_range::iterator::read_current() {
+    if (unread_.empty()) { return; }
+
+    wire_trace_record_header header;
+    if (unread_.size() < sizeof(header)) {
+        throw std::logic_error{ "Wire trace ends with a truncated record header." };
+    }
+    std::memcpy(&header, unread_.data(), sizeof(header));
+
+    if (unread_.size() - sizeof(header) < header.size) {
+        throw std::logic_error{ "Wire trace ends with a truncated record." };
+    }
+
+    using clock = std::chrono::steady_clock;
+    current_    = { .timestamp = clock::time_point{ std::chrono::duration_cast<clock::duration>(
+                        std::chrono::nanoseconds{ header.timestamp }) },
+                    .direction = header.direction,
+                    .fd_count  = header.fd_count,
+                    .data      = unread_.subspan(sizeof(header), header.size) };
+}
+
+auto wire_trace_range::iterator::operator++() -> iterator& {
+    // The padding of the last record is allowed to be missing.
+    unread_ = unread_.subspan(std::min(unread_.size(), record_size(current_.data.size())));
+    read_current();
+    return *this;
+}
+
+auto replay_wire_trace(const std::span<const std::byte> trace, message_overload_set& overloads)
+    -> std::size_t {
+    return replay_wire_trace(trace, [&](const parsed_message& msg) {
+        const auto ov_res = overloads.overload_resolution(msg.object_id, msg.opcode);
+        if (ov_res.has_value()) { std::invoke(ov_res.value(), msg.arguments); }
+    });
+}
+
+} // namespace wl
+} // namespace waylander
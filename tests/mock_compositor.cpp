@@ -0,0 +1,266 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "mock_compositor.hpp"
+
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+// Include other protocols after core protocol.
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+namespace waylander {
+namespace wl {
+
+namespace {
+using namespace protocols;
+
+template<typename Msg>
+auto decode(const parsed_message& msg) -> Msg {
+    return interpert_message_payload<Msg, decode_policy::checked>(msg.arguments);
+}
+} // namespace
+
+[[nodiscard]] mock_compositor::mock_compositor(gnulander::local_stream_socket&& client_sock,
+                                               const mock_compositor_config config)
+    : client_sock_{ std::move(client_sock) },
+      config_{ config } {
+    objects_.emplace(global_display_object.value, object_kind::display);
+}
+
+auto mock_compositor::dispatch() -> std::size_t {
+    static constexpr auto recv_block_size = 4096uz;
+
+    auto handled = 0uz;
+    do {
+        const auto unprocessed_bytes = recv_buff_.size();
+        recv_buff_.resize(unprocessed_bytes + recv_block_size);
+        const auto bytes_read =
+            client_sock_.read_some(std::span{ recv_buff_ }.subspan(unprocessed_bytes));
+        recv_buff_.resize(unprocessed_bytes + bytes_read);
+        if (bytes_read == 0) { throw std::runtime_error{ "Encountered EOF from client socket!" }; }
+
+        const auto whole_messages = std::span{ recv_buff_ }.first(whole_messages_size(recv_buff_));
+        for (const auto& msg : parsed_message_range{ whole_messages }) {
+            handle_request(msg);
+            ++handled;
+        }
+        recv_buff_.erase(recv_buff_.begin(),
+                         std::ranges::next(recv_buff_.begin(), whole_messages.size()));
+        // Rest of a partially read message is still coming.
+    } while (not recv_buff_.empty());
+
+    received_requests_ += handled;
+
+    if (not events_.empty()) {
+        if (config_.reply_latency.count() > 0) {
+            std::this_thread::sleep_for(config_.reply_latency);
+        }
+        client_sock_.write(events_.data());
+        events_.clear();
+    }
+    return handled;
+}
+
+void mock_compositor::handle_request(const parsed_message& msg) {
+    const auto id   = msg.object_id.value;
+    const auto kind = [&] {
+        const auto found = objects_.find(id);
+        return found == objects_.end() ? object_kind::other : found->second;
+    }();
+
+    switch (kind) {
+        case object_kind::display:
+            switch (msg.opcode.value) {
+                case wl_display::request::sync::opcode.value: {
+                    const auto sync = decode<wl_display::request::sync>(msg);
+                    send_callback_done(sync.callback.value, next_serial_++);
+                    return;
+                }
+                case wl_display::request::get_registry::opcode.value: {
+                    const auto registry = decode<wl_display::request::get_registry>(msg).registry;
+                    objects_.insert_or_assign(registry.value, object_kind::registry);
+                    using global = wl_registry::event::global;
+                    events_.append(Wobject<wl_registry>{ registry.value },
+                                   global{ .name{ compositor_global },
+                                           .interface{ wl_compositor::name },
+                                           .version{ wl_compositor::version } });
+                    events_.append(Wobject<wl_registry>{ registry.value },
+                                   global{ .name{ shm_global },
+                                           .interface{ wl_shm::name },
+                                           .version{ wl_shm::version } });
+                    events_.append(Wobject<wl_registry>{ registry.value },
+                                   global{ .name{ wm_base_global },
+                                           .interface{ xdg_wm_base::name },
+                                           .version{ xdg_wm_base::version } });
+                    return;
+                }
+                default: return;
+            }
+        case object_kind::registry:
+            if (msg.opcode.value == wl_registry::request::bind::opcode.value) {
+                const auto request = decode<wl_registry::request::bind>(msg);
+                bind(request.name.value, request.new_id_interface, request.id.value);
+            }
+            return;
+        case object_kind::compositor:
+            if (msg.opcode.value == wl_compositor::request::create_surface::opcode.value) {
+                const auto surface = decode<wl_compositor::request::create_surface>(msg).id;
+                objects_.insert_or_assign(surface.value, object_kind::surface);
+                surfaces_.insert_or_assign(surface.value, surface_state{});
+            }
+            return;
+        case object_kind::shm:
+            if (msg.opcode.value == wl_shm::request::create_pool::opcode.value) {
+                // The file descriptor is not part of the payload, so only the new id is read.
+                Wnew_id<wl_shm_pool> pool;
+                std::memcpy(&pool, msg.arguments.data(), sizeof(pool));
+                objects_.insert_or_assign(pool.value, object_kind::shm_pool);
+            }
+            return;
+        case object_kind::shm_pool:
+            if (msg.opcode.value == wl_shm_pool::request::create_buffer::opcode.value) {
+                const auto buffer = decode<wl_shm_pool::request::create_buffer>(msg).id;
+                objects_.insert_or_assign(buffer.value, object_kind::buffer);
+            }
+            return;
+        case object_kind::surface:
+            switch (msg.opcode.value) {
+                case wl_surface::request::attach::opcode.value:
+                    surfaces_[id].attached_buffer =
+                        decode<wl_surface::request::attach>(msg).buffer.value;
+                    return;
+                case wl_surface::request::frame::opcode.value: {
+                    const auto callback = decode<wl_surface::request::frame>(msg).callback;
+                    objects_.insert_or_assign(callback.value, object_kind::callback);
+                    surfaces_[id].frame_callback = callback.value;
+                    return;
+                }
+                case wl_surface::request::commit::opcode.value: commit(id); return;
+                default: return;
+            }
+        case object_kind::wm_base:
+            switch (msg.opcode.value) {
+                case xdg_wm_base::request::get_xdg_surface::opcode.value: {
+                    const auto request = decode<xdg_wm_base::request::get_xdg_surface>(msg);
+                    objects_.insert_or_assign(request.id.value, object_kind::xdg_surface);
+                    xdg_surfaces_.insert_or_assign(request.id.value, request.surface.value);
+                    surfaces_[request.surface.value].xdg_surface = request.id.value;
+                    return;
+                }
+                case xdg_wm_base::request::pong::opcode.value: ++pongs_; return;
+                default: return;
+            }
+        case object_kind::xdg_surface:
+            switch (msg.opcode.value) {
+                case xdg_surface::request::get_toplevel::opcode.value: {
+                    const auto toplevel = decode<xdg_surface::request::get_toplevel>(msg).id;
+                    objects_.insert_or_assign(toplevel.value, object_kind::toplevel);
+                    surfaces_[xdg_surfaces_.at(id)].toplevel = toplevel.value;
+                    return;
+                }
+                case xdg_surface::request::ack_configure::opcode.value:
+                    last_acked_serial_ =
+                        decode<xdg_surface::request::ack_configure>(msg).serial.value;
+                    return;
+                default: return;
+            }
+        case object_kind::callback:
+        case object_kind::buffer:
+        case object_kind::toplevel:
+        case object_kind::other: return;
+    }
+}
+
+void mock_compositor::bind(const Wuint::integral_type name,
+                           const std::u8string_view interface,
+                           const Wuint::integral_type id) {
+    const auto expect_interface = [&](const std::u8string_view expected) {
+        if (interface != expected) {
+            throw std::logic_error{ "Global bound with wrong interface." };
+        }
+    };
+
+    switch (name) {
+        case compositor_global:
+            expect_interface(wl_compositor::name);
+            objects_.insert_or_assign(id, object_kind::compositor);
+            return;
+        case shm_global:
+            expect_interface(wl_shm::name);
+            objects_.insert_or_assign(id, object_kind::shm);
+            events_.append(Wobject<wl_shm>{ id },
+                           wl_shm::event::format{ .format = wl_shm::format::Eargb8888 });
+            events_.append(Wobject<wl_shm>{ id },
+                           wl_shm::event::format{ .format = wl_shm::format::Exrgb8888 });
+            return;
+        case wm_base_global:
+            expect_interface(xdg_wm_base::name);
+            objects_.insert_or_assign(id, object_kind::wm_base);
+            wm_base_ = id;
+            return;
+        default: throw std::logic_error{ "Bind of unknown global." };
+    }
+}
+
+void mock_compositor::commit(const Wuint::integral_type surface) {
+    auto& state = surfaces_[surface];
+
+    if (state.toplevel != 0 and not state.configured) {
+        // Initial commit of a toplevel, which must not have a buffer attached.
+        state.configured = true;
+        events_.append(Wobject<xdg_toplevel>{ state.toplevel },
+                       xdg_toplevel::event::configure{ .width{ config_.width },
+                                                       .height{ config_.height },
+                                                       .states{} });
+        events_.append(Wobject<xdg_surface>{ state.xdg_surface },
+                       xdg_surface::event::configure{ .serial{ next_serial_++ } });
+        return;
+    }
+
+    if (state.attached_buffer != 0) {
+        events_.append(Wobject<wl_buffer>{ state.attached_buffer }, wl_buffer::event::release{});
+        state.attached_buffer = 0;
+        ++committed_frames_;
+
+        for (auto i = 0uz; i < config_.pings_per_frame; ++i) {
+            events_.append(Wobject<xdg_wm_base>{ wm_base_ },
+                           xdg_wm_base::event::ping{ .serial{ next_serial_++ } });
+        }
+    }
+
+    if (state.frame_callback != 0) {
+        const auto frame = static_cast<Wuint::integral_type>(committed_frames_);
+        send_callback_done(state.frame_callback, frame);
+        state.frame_callback = 0;
+    }
+}
+
+void mock_compositor::send_callback_done(const Wuint::integral_type callback,
+                                         const Wuint::integral_type data) {
+    events_.append(Wobject<wl_callback>{ callback },
+                   wl_callback::event::done{ .callback_data{ data } });
+    events_.append(global_display_object, wl_display::event::delete_id{ .id{ callback } });
+    objects_.erase(callback);
+}
+
+} // namespace wl
+} // namespace waylander
@@ -0,0 +1,137 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+/// @file
+/// In-process stand-in for a Wayland compositor used by tests and benchmarks.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+
+namespace waylander {
+namespace wl {
+
+/// Configuration of mock_compositor.
+struct mock_compositor_config {
+    /// Delay before the events replying to a batch of requests are written.
+    std::chrono::microseconds reply_latency{ 0 };
+    /// Amount of xdg_wm_base::ping events sent for each committed frame.
+    std::size_t pings_per_frame{ 0 };
+    /// Size sent in xdg_toplevel::configure.
+    Wint::integral_type width{ 640 };
+    Wint::integral_type height{ 480 };
+};
+
+/// Serves the other end of a socket pair given to connected_client.
+///
+/// Implements just enough of wl_display, wl_registry, wl_compositor, wl_shm and xdg_wm_base
+/// for a client to start up and run a frame loop:
+///
+///   - globals wl_compositor, wl_shm and xdg_wm_base are advertised
+///   - wl_display::sync is answered right away
+///   - first commit of a toplevel surface is answered with configure events
+///   - commit with attached buffer releases the buffer and sends pending frame callbacks
+///
+/// Other requests are counted and ignored. The compositor does not run in its own thread,
+/// instead dispatch() has to be called after the client has flushed its requests.
+/// This makes tests deterministic, as the client and the compositor never run concurrently.
+/// File descriptors sent by the client are not received and are closed by the kernel.
+class mock_compositor {
+    enum class object_kind {
+        display,
+        registry,
+        callback,
+        compositor,
+        shm,
+        shm_pool,
+        buffer,
+        surface,
+        wm_base,
+        xdg_surface,
+        toplevel,
+        other
+    };
+
+    struct surface_state {
+        Wuint::integral_type attached_buffer{ 0 };
+        Wuint::integral_type frame_callback{ 0 };
+        Wuint::integral_type toplevel{ 0 };
+        Wuint::integral_type xdg_surface{ 0 };
+        bool configured{ false };
+    };
+
+    gnulander::local_stream_socket client_sock_;
+    mock_compositor_config config_;
+
+    sstd::byte_vec recv_buff_{};
+    message_buffer events_{};
+
+    std::unordered_map<Wuint::integral_type, object_kind> objects_{};
+    std::unordered_map<Wuint::integral_type, surface_state> surfaces_{};
+    /// xdg_surface -> wl_surface
+    std::unordered_map<Wuint::integral_type, Wuint::integral_type> xdg_surfaces_{};
+
+    Wuint::integral_type wm_base_{ 0 };
+    Wuint::integral_type next_serial_{ 1 };
+    Wuint::integral_type last_acked_serial_{ 0 };
+    std::size_t received_requests_{ 0 };
+    std::size_t committed_frames_{ 0 };
+    std::size_t pongs_{ 0 };
+
+    void handle_request(const parsed_message& msg);
+    void bind(Wuint::integral_type name, std::u8string_view interface, Wuint::integral_type id);
+    void commit(Wuint::integral_type surface);
+    void send_callback_done(Wuint::integral_type callback, Wuint::integral_type data);
+
+  public:
+    [[nodiscard]] explicit mock_compositor(gnulander::local_stream_socket&& client_sock,
+                                           mock_compositor_config config = {});
+
+    /// Reads requests flushed by the client, handles them and writes the events.
+    ///
+    /// Blocks until at least one request is available.
+    /// Returns the amount of handled requests.
+    auto dispatch() -> std::size_t;
+
+    /// Global names of the advertised globals.
+    static constexpr Wuint::integral_type compositor_global = 1;
+    static constexpr Wuint::integral_type shm_global        = 2;
+    static constexpr Wuint::integral_type wm_base_global    = 3;
+
+    [[nodiscard]] auto received_requests() const noexcept -> std::size_t {
+        return received_requests_;
+    }
+    [[nodiscard]] auto committed_frames() const noexcept -> std::size_t {
+        return committed_frames_;
+    }
+    [[nodiscard]] auto pongs() const noexcept -> std::size_t { return pongs_; }
+    [[nodiscard]] auto last_acked_serial() const noexcept -> Wuint::integral_type {
+        return last_acked_serial_;
+    }
+};
+
+} // namespace wl
+} // namespace waylander
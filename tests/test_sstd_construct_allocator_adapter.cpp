@@ -25,6 +25,7 @@
 #include <ranges>
 #include <vector>
 
+#include "waylander/byte_vec.hpp"
 #include "waylander/construct_allocator_adapter.hpp"
 
 struct ctor_arg_counter {
@@ -180,4 +181,24 @@ int main() {
             // so the following check is UB. If this starts failing then so be it.
             std::ranges::for_each(vec, [](const auto& b) { expect(b == std::byte{ 10 }); });
         };
+
+    tag("sstd") / "counting_memory_resource records allocations of pmr::byte_vec"_test = [] {
+        auto resource = sstd::allocator::counting_memory_resource{};
+        {
+            auto vec = sstd::pmr::byte_vec(sstd::pmr::byte_vec_alloc{ &resource });
+            expect(resource.counter().allocations == 0uz);
+
+            vec.resize(100);
+            expect(resource.counter().allocations == 1uz);
+            expect(resource.counter().allocated_bytes == 100uz);
+
+            // Shrinking and regrowing within the capacity does not allocate.
+            for (auto i = 0uz; i < 1000uz; ++i) {
+                vec.erase(vec.begin(), std::ranges::next(vec.begin(), 50));
+                vec.resize(100);
+            }
+            expect(resource.counter().allocations == 1uz);
+        }
+        expect(resource.counter().deallocations == 1uz);
+    };
 }
@@ -16,7 +16,9 @@
 #include <boost/ut.hpp> // import boost.ut;
 
 #include <concepts>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "waylander/type_utils.hpp"
 
@@ -117,6 +119,29 @@ int main() {
         expect(constant<std::same_as<int, fold_result>>);
     };
 
+    tag("sstd") / "type_list::fold_left works for lists longer than instantiation depth"_test = [] {
+        using long_list = decltype([]<std::size_t... I>(std::index_sequence<I...>) {
+            return sstd::type_list<sstd::indexed_type<I, int>...>{};
+        }(std::make_index_sequence<2000>{}));
+        using count_op = decltype([](auto Lhs, auto) {
+            return sstd::numeral_t<decltype(Lhs)::value + 1>{};
+        });
+        using fold_result = long_list::fold_left<sstd::numeral_t<0>, count_op>;
+
+        expect(constant<fold_result::value == 2000>);
+    };
+
+    // type_list<T...>::at<I>:
+
+    tag("sstd") / "type_list::at selects types by index"_test = [] {
+        using list = L<short, int, long>;
+
+        expect(constant<list::size == 3>);
+        expect(constant<std::same_as<list::at<0>, short>>);
+        expect(constant<std::same_as<list::at<1>, int>>);
+        expect(constant<std::same_as<list::at<2>, long>>);
+    };
+
     // type_list<T...>::append<U...>:
 
     tag("sstd") / "type_list can be build with type_list::append"_test = [] {
@@ -19,18 +19,28 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <future>
+#include <memory_resource>
 #include <ranges>
+#include <stdexcept>
 #include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
 
 #include "gnulander/fd_handle.hpp"
 #include "gnulander/local_stream_socket.hpp"
 #include "gnulander/memory_block.hpp"
 
+#include "waylander/byte_array.hpp"
 #include "waylander/byte_vec.hpp"
 #include "waylander/wayland/connected_client.hpp"
 #include "waylander/wayland/message_buffer.hpp"
@@ -237,6 +247,220 @@ int main() {
         expect(not client.has_registered_requests());
     };
 
+    wl_tag / "connected_client can allocate its buffers from given memory resource"_test = [] {
+        using wl_display    = protocols::wl_display;
+        using get_registery = wl_display::request::get_registry;
+        using delete_id     = wl_display::event::delete_id;
+
+        // Any allocation outside of the storage would throw std::bad_alloc.
+        auto storage  = std::array<std::byte, 1 << 14>{};
+        auto resource = std::pmr::monotonic_buffer_resource{ storage.data(),
+                                                             storage.size(),
+                                                             std::pmr::null_memory_resource() };
+
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client = connected_client{ std::move(client_sock), &resource };
+
+        client.register_request(global_display_object, get_registery{ 2u });
+        client.flush_registered_requests();
+
+        constexpr auto size = sizeof(message_header<wl_display>) + sizeof(get_registery);
+        auto buff           = waylander::sstd::byte_vec(size);
+        expect(server_sock.read(buff) == size);
+
+        auto events = message_buffer{};
+        events.append(global_display_object, delete_id{ .id{ 2u } });
+        server_sock.write(events.release_data());
+
+        auto ov = message_overload_set{ &resource };
+        expect(nothrow(
+            [&] { client.recv_and_visit_events(ov).until<delete_id>(global_display_object); }));
+    };
+
+    wl_tag / "connected_client with immediate flush_policy flushes on registration"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = connected_client{ std::move(client_sock) };
+        client.set_flush_policy(flush_policy::immediate);
+
+        using namespace protocols;
+        const auto request  = wl_display::request::sync{ client.reserve_object_id<wl_callback>() };
+        constexpr auto size = sizeof(message_header<wl_display>) + message_payload_size(request);
+
+        client.register_request(global_display_object, request);
+        expect(not client.has_registered_requests());
+        expect(not client.has_pending_output());
+
+        auto buff = waylander::sstd::byte_vec(size);
+        expect(server_sock.read(buff) == size);
+    };
+
+    wl_tag / "connected_client with size_threshold flush_policy batches requests"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = connected_client{ std::move(client_sock) };
+
+        using namespace protocols;
+        const auto request  = wl_display::request::sync{ client.reserve_object_id<wl_callback>() };
+        constexpr auto size = sizeof(message_header<wl_display>) + message_payload_size(request);
+        constexpr auto requests_per_flush = 3uz;
+
+        client.set_flush_policy(flush_policy::size_threshold, requests_per_flush * size);
+
+        for (const auto _ : std::ranges::iota_view(1uz, requests_per_flush)) {
+            client.register_request(global_display_object, request);
+            expect(client.has_registered_requests());
+        }
+        client.register_request(global_display_object, request);
+        expect(not client.has_registered_requests());
+
+        auto buff = waylander::sstd::byte_vec(requests_per_flush * size);
+        expect(server_sock.read(buff) == requests_per_flush * size);
+    };
+
+    wl_tag / "connected_client resumes partial non-blocking flush with aligned fds"_test = [] {
+        using wl_shm      = protocols::wl_shm;
+        using wl_display  = protocols::wl_display;
+        using create_pool = wl_shm::request::create_pool;
+        using sync        = wl_display::request::sync;
+
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+
+        // gnulander does not expose file descriptors of the sockets, so find the client end
+        // as the socket which can read a byte written by the server end.
+        server_sock.write(waylander::sstd::byte_vec(1uz));
+        auto client_fd = -1;
+        for (auto fd = 0; fd < 1024 and client_fd == -1; ++fd) {
+            struct stat st{};
+            auto byte = std::byte{};
+            if (::fstat(fd, &st) == 0 and S_ISSOCK(st.st_mode)
+                and ::recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT) == 1) {
+                client_fd = fd;
+            }
+        }
+        expect(fatal(client_fd != -1));
+        auto probe = std::byte{};
+        expect(fatal(::recv(client_fd, &probe, 1, 0) == 1));
+        expect(fatal(::fcntl(client_fd, F_SETFL, ::fcntl(client_fd, F_GETFL) | O_NONBLOCK) == 0));
+        // Small send buffer, so that the backpressure is reached quickly.
+        constexpr auto send_buffer_size = 4096;
+        const auto sndbuf_set           = ::setsockopt(client_fd,
+                                                       SOL_SOCKET,
+                                                       SO_SNDBUF,
+                                                       &send_buffer_size,
+                                                       sizeof(send_buffer_size));
+        expect(fatal(sndbuf_set == 0));
+
+        auto client = connected_client{ std::move(client_sock) };
+
+        const auto shm                = Wobject<wl_shm>{ 2u };
+        constexpr auto syncs_per_pool = 20uz;
+        constexpr auto mem_size       = 4uz;
+
+        // Memory blocks of the requests, which have to stay open until they are written.
+        auto mems = std::vector<gnulander::memory_block>{};
+        // Everything registered to the client in the same order.
+        auto expected_stream = message_buffer{};
+        // End of each create_pool in expected_stream, its fd has to arrive before it.
+        auto pool_ends = std::vector<std::size_t>{};
+
+        const auto register_batch = [&] {
+            auto& mem = mems.emplace_back();
+            mem.truncate(mem_size);
+            for (auto& x : mem.map(mem_size)) { x = static_cast<std::byte>(mems.size()); }
+
+            const auto pool = create_pool{ .id{ static_cast<std::uint32_t>(1000uz + mems.size()) },
+                                           .fd{ gnulander::fd_ref{ mem } },
+                                           .size{ static_cast<std::int32_t>(mem_size) } };
+            client.register_request(shm, pool);
+            expected_stream.append(shm, pool);
+            pool_ends.push_back(expected_stream.size());
+
+            for (const auto i : std::ranges::iota_view(0uz, syncs_per_pool)) {
+                const auto request = sync{ .callback{ static_cast<std::uint32_t>(i + 3uz) } };
+                client.register_request(global_display_object, request);
+                expected_stream.append(global_display_object, request);
+            }
+        };
+
+        // Nobody reads the server end, so the socket eventually reports EAGAIN.
+        constexpr auto max_batches = 10'000uz;
+        while (not client.has_pending_output() and mems.size() < max_batches) {
+            register_batch();
+            const auto all_written = client.flush_registered_requests();
+            expect(all_written == not client.has_pending_output());
+        }
+        expect(fatal(client.has_pending_output()));
+
+        // Requests flushed under backpressure are queued after the pending output.
+        register_batch();
+        expect(not client.flush_registered_requests());
+        expect(not client.has_registered_requests());
+
+        auto received  = waylander::sstd::byte_vec{};
+        auto fd_ends   = std::vector<std::size_t>{};
+        auto fd_values = std::vector<std::byte>{};
+
+        // Drain the server end and flush again until everything has arrived.
+        while (received.size() < expected_stream.size()) {
+            std::ignore = client.flush_registered_requests();
+
+            auto chunk       = waylander::sstd::byte_vec(4096uz);
+            auto msg         = gnulander::local_socket_msg<1, 1>{ std::span{ chunk } };
+            const auto bytes = server_sock.recv(msg);
+            auto [fd_opt]    = msg.get_fd_handles();
+            received.insert(received.end(), chunk.begin(), std::ranges::next(chunk.begin(), bytes));
+            if (fd_opt.has_value()) {
+                // Reading stops at the byte the fd was sent along.
+                fd_ends.push_back(received.size());
+                auto fd = std::move(fd_opt).value();
+                fd_values.push_back(fd.map(mem_size).front());
+            }
+        }
+        expect(not client.has_pending_output());
+
+        expect(std::ranges::equal(received, expected_stream.data()));
+
+        expect(fatal(fd_ends.size() == pool_ends.size()));
+        for (const auto i : std::ranges::iota_view(0uz, pool_ends.size())) {
+            expect(fd_ends[i] <= pool_ends[i]) << "fd:" << i;
+            expect(fd_values[i] == static_cast<std::byte>(i + 1uz)) << "fd:" << i;
+        }
+    };
+
+    wl_tag / "connected_client with end_of_dispatch flush_policy flushes after visiting"_test = [] {
+        using wl_display  = protocols::wl_display;
+        using wl_callback = protocols::wl_callback;
+        using delete_id   = wl_display::event::delete_id;
+        using done        = wl_callback::event::done;
+        using sync        = wl_display::request::sync;
+
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = connected_client{ std::move(client_sock) };
+        client.set_flush_policy(flush_policy::end_of_dispatch);
+
+        const auto callback = client.reserve_object_id<wl_callback>();
+
+        auto events = [&] {
+            auto buff = message_buffer{};
+            buff.append(global_display_object, delete_id{ .id{ 42u } });
+            buff.append(callback, done{ .callback_data{ 0u } });
+            return buff.release_data();
+        }();
+        server_sock.write(events);
+
+        auto ov = message_overload_set{};
+        ov.add_overload<delete_id>(global_display_object, [&](const delete_id&) {
+            client.register_request(global_display_object, sync{ .callback{ 44u } });
+            expect(client.has_registered_requests());
+        });
+
+        client.recv_and_visit_events(ov).until<done>(callback);
+        expect(not client.has_registered_requests());
+
+        constexpr auto size = sizeof(message_header<wl_display>) + sizeof(sync);
+        auto buff           = waylander::sstd::byte_vec(size);
+        expect(server_sock.read(buff) == size);
+    };
+
     wl_tag / "connected_client can be default constructed"_test = [] {
         const auto wayland_server_is_present = std::filesystem::is_socket(wayland_socket_path());
         expect(wayland_server_is_present) << "Working Wayland compositor is required for this test."
@@ -290,6 +514,18 @@ int main() {
         expect(events_recved == number_of_events);
     };
 
+    wl_tag / "connected_client rejects messages with size less than header"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = connected_client{ std::move(client_sock) };
+
+        // Header of size 0, which would never be consumed.
+        constexpr auto header =
+            message_header<protocols::wl_display>(global_display_object, { 0u }, { 0u });
+        server_sock.write(waylander::sstd::byte_array<8>{ header }.bytes());
+
+        expect(throws<std::logic_error>([&] { std::ignore = client.recv_events(); }));
+    };
+
     wl_tag / "connected_client can recive events which are sent one byte at the time"_test = [] {
         using shell_surface = protocols::wl_shell_surface;
         using event_t       = shell_surface::event::configure;
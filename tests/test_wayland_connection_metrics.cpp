@@ -0,0 +1,217 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/connection_metrics.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+#include "mock_compositor.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+    using namespace wl::protocols;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    static constexpr auto display_info  = &wl::interface_info_of<wl_display>;
+    static constexpr auto registry_info = &wl::interface_info_of<wl_registry>;
+
+    /// Finds counters of the message or returns nullptr.
+    static constexpr auto find_message = [](const wl::connection_metrics_snapshot& snapshot,
+                                            const wl::interface_info* const interface,
+                                            const wl::Wopcode<wl::generic_object> opcode,
+                                            const wl::wire_direction direction)
+        -> const wl::message_metrics_snapshot* {
+        const auto it = std::ranges::find_if(snapshot.messages, [&](const auto& msg) {
+            return msg.interface == interface and msg.opcode.value == opcode.value
+                   and msg.direction == direction;
+        });
+        return it == snapshot.messages.end() ? nullptr : &*it;
+    };
+
+    wl_tag / "interface_info_if_known points to metadata of generated interfaces"_test = [] {
+        expect(wl::interface_info_if_known<wl_display> == display_info);
+        expect(wl::interface_info_if_known<wl::generic_object> == nullptr);
+    };
+
+    wl_tag / "log2_histogram counts values by bit width"_test = [] {
+        auto histogram = wl::log2_histogram{};
+        histogram.record(0);
+        histogram.record(1);
+        histogram.record(5);
+        histogram.record(7);
+        histogram.record(~0uz);
+
+        const auto counts = histogram.snapshot();
+        expect(counts[0] == 1uz);
+        expect(counts[1] == 1uz);
+        expect(counts[3] == 2uz);
+        expect(counts.back() == 1uz);
+    };
+
+    wl_tag / "connection_metrics counts messages per interface and opcode"_test = [] {
+        auto metrics = wl::connection_metrics{};
+        metrics.count_sent(display_info, { wl_display::request::sync::opcode.value }, 12);
+        metrics.count_sent(display_info, { wl_display::request::sync::opcode.value }, 12);
+        metrics.count_sent(nullptr, { 0 }, 8);
+        metrics.count_received(registry_info, { wl_registry::event::global::opcode.value }, 40, 3);
+        metrics.count_unhandled();
+        metrics.count_read(52);
+        metrics.count_write();
+        metrics.count_flush(32);
+
+        const auto snapshot = metrics.snapshot();
+        expect(snapshot.sent_messages == 3uz);
+        expect(snapshot.sent_bytes == 32uz);
+        expect(snapshot.received_messages == 2uz);
+        expect(snapshot.received_bytes == 52uz);
+        expect(snapshot.read_syscalls == 1uz);
+        expect(snapshot.write_syscalls == 1uz);
+        expect(snapshot.unhandled_messages == 1uz);
+        expect(snapshot.untracked_messages == 1uz);
+        expect(snapshot.flush_bytes[6] == 1uz);
+        expect(snapshot.messages.size() == 2uz);
+
+        const auto sync = find_message(snapshot,
+                                       display_info,
+                                       { wl_display::request::sync::opcode.value },
+                                       wl::wire_direction::sent);
+        expect((sync != nullptr) >> fatal);
+        expect(sync->messages == 2uz);
+        expect(sync->bytes == 24uz);
+        expect(sync->info()->name == std::u8string_view{ u8"sync" });
+
+        const auto global = find_message(snapshot,
+                                         registry_info,
+                                         { wl_registry::event::global::opcode.value },
+                                         wl::wire_direction::received);
+        expect((global != nullptr) >> fatal);
+        expect(global->handler_nanoseconds[2] == 1uz);
+        expect(global->info()->name == std::u8string_view{ u8"global" });
+    };
+
+    wl_tag / "connection_metrics counts messages which do not fit as untracked"_test = [] {
+        auto metrics = wl::connection_metrics{ 1 };
+        metrics.count_sent(display_info, { 0 }, 12);
+        metrics.count_sent(display_info, { 1 }, 12);
+
+        const auto snapshot = metrics.snapshot();
+        expect(snapshot.sent_messages == 2uz);
+        expect(snapshot.messages.size() == 1uz);
+        expect(snapshot.untracked_messages == 1uz);
+    };
+
+    wl_tag / "connected_client counts its traffic if metrics are enabled"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto metrics = wl::connection_metrics{};
+        client.set_metrics(&metrics);
+
+        const auto registry = client.reserve_object_id<wl_registry>();
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(wl::global_display_object,
+                                wl_display::request::get_registry{ registry });
+        client.register_request(wl::global_display_object, wl_display::request::sync{ callback });
+        client.flush_registered_requests();
+        compositor.dispatch();
+
+        auto globals = 0uz;
+        auto ov      = wl::message_overload_set{};
+        ov.add_overload<wl_registry::event::global>(registry, [&](const auto&) { ++globals; });
+        client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+
+        const auto snapshot = metrics.snapshot();
+        if constexpr (not wl::metrics_enabled) {
+            expect(snapshot.sent_messages == 0uz);
+            expect(snapshot.messages.empty());
+            return;
+        }
+
+        expect(snapshot.sent_messages == 2uz);
+        expect(snapshot.sent_bytes == 24uz);
+        expect(snapshot.write_syscalls >= 1uz);
+        expect(snapshot.read_syscalls >= 1uz);
+        expect(snapshot.flush_bytes[5] == 1uz);
+
+        const auto global = find_message(snapshot,
+                                         registry_info,
+                                         { wl_registry::event::global::opcode.value },
+                                         wl::wire_direction::received);
+        expect((global != nullptr) >> fatal);
+        expect(global->messages == globals);
+
+        const auto done = find_message(snapshot,
+                                       &wl::interface_info_of<wl_callback>,
+                                       { wl_callback::event::done::opcode.value },
+                                       wl::wire_direction::received);
+        expect((done != nullptr) >> fatal);
+        expect(done->messages == 1uz);
+    };
+
+    wl_tag / "connected_client counts events which are not dispatched by overloads"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto metrics = wl::connection_metrics{};
+        client.set_metrics(&metrics);
+
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(wl::global_display_object, wl_display::request::sync{ callback });
+        client.flush_registered_requests();
+        compositor.dispatch();
+
+        // Mock compositor sends wl_callback.done followed by wl_display.delete_id.
+        auto callback_events = 0uz;
+        for ([[maybe_unused]] const auto& event : client.events_of(callback)) { ++callback_events; }
+        expect(callback_events == 1uz);
+        std::ignore = client.recv_events();
+
+        const auto snapshot = metrics.snapshot();
+        if constexpr (not wl::metrics_enabled) {
+            expect(snapshot.received_messages == 0uz);
+            return;
+        }
+
+        // Interface of the object of recv_events is not known.
+        expect(snapshot.received_messages == 2uz);
+        expect(snapshot.untracked_messages == 1uz);
+
+        const auto done = find_message(snapshot,
+                                       &wl::interface_info_of<wl_callback>,
+                                       { wl_callback::event::done::opcode.value },
+                                       wl::wire_direction::received);
+        expect((done != nullptr) >> fatal);
+        expect(done->messages == 1uz);
+    };
+}
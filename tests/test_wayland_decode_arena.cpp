@@ -0,0 +1,156 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "waylander/wayland/decode_arena.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_visitor.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using global = wl::protocols::wl_registry::event::global;
+    using enter  = wl::protocols::wl_keyboard::event::enter;
+
+    constexpr auto registry = wl::Wobject<wl::protocols::wl_registry>{ 2u };
+    constexpr auto keyboard = wl::Wobject<wl::protocols::wl_keyboard>{ 3u };
+
+    /// Encodes one message and returns its payload.
+    const auto encode_payload = [](const auto obj, const auto& msg) {
+        auto buff           = wl::message_buffer{};
+        buff.append(obj, msg);
+        const auto data     = buff.release_data();
+        const auto msg_view = wl::parse_first_message(data);
+        return std::vector<std::byte>(msg_view.arguments.begin(), msg_view.arguments.end());
+    };
+
+    wl_tag / "decode_arena copies strings out of the payload"_test = [&] {
+        auto arena   = wl::decode_arena{};
+        auto payload = encode_payload(
+            registry,
+            global{ .name{ 1u }, .interface{ u8"wl_compositor" }, .version{ 6u } });
+
+        const auto msg = wl::interpert_message_payload<global>(payload, arena);
+        std::ranges::fill(payload, std::byte{ 0 });
+
+        expect(msg.name.value == 1u);
+        expect(std::u8string_view(msg.interface) == u8"wl_compositor");
+        expect(msg.interface.data()[msg.interface.size()] == u8'\0');
+        expect(msg.version.value == 6u);
+    };
+
+    wl_tag / "decode_arena interns repeated strings"_test = [&] {
+        auto arena = wl::decode_arena{};
+
+        const auto payload_A =
+            encode_payload(registry, global{ .name{ 1u }, .interface{ u8"wl_output" } });
+        const auto payload_B =
+            encode_payload(registry, global{ .name{ 2u }, .interface{ u8"wl_output" } });
+        const auto payload_C =
+            encode_payload(registry, global{ .name{ 3u }, .interface{ u8"wl_seat" } });
+
+        const auto msg_A = wl::interpert_message_payload<global>(payload_A, arena);
+        const auto msg_B = wl::interpert_message_payload<global>(payload_B, arena);
+        const auto msg_C = wl::interpert_message_payload<global>(payload_C, arena);
+
+        expect(msg_A.interface.data() == msg_B.interface.data());
+        expect(msg_A.interface.data() != msg_C.interface.data());
+        expect(arena.interned_string_count() == 2uz);
+
+        arena.release();
+        expect(arena.interned_string_count() == 0uz);
+    };
+
+    wl_tag / "decode_arena copies arrays out of the payload"_test = [&] {
+        auto arena      = wl::decode_arena{};
+        const auto keys = std::array{ std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+        auto payload    = encode_payload(
+            keyboard,
+            enter{ .serial{ 4u }, .surface{ 5u }, .keys{ std::span(keys) } });
+
+        const auto msg = wl::interpert_message_payload<enter>(payload, arena);
+        std::ranges::fill(payload, std::byte{ 0 });
+
+        expect(msg.serial.value == 4u);
+        expect(msg.surface.value == 5u);
+        expect(std::ranges::equal(msg.keys, keys));
+    };
+
+    wl_tag / "decode_arena serves a registry flood from one block"_test = [&] {
+        // Counts the blocks allocated by the arena.
+        struct block_counting_resource : std::pmr::memory_resource {
+            std::size_t blocks{ 0 };
+
+            void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+                ++blocks;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+            void do_deallocate(void* const ptr,
+                               const std::size_t bytes,
+                               const std::size_t alignment) override {
+                std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+
+        constexpr auto interfaces =
+            std::array<std::u8string_view, 4>{ u8"wl_output", u8"wl_seat", u8"wl_shm", u8"wl_drm" };
+
+        auto payloads = std::vector<std::vector<std::byte>>{};
+        for (auto i = 0u; i < 400u; ++i) {
+            payloads.push_back(encode_payload(
+                registry,
+                global{ .name{ i }, .interface{ interfaces[i % interfaces.size()] } }));
+        }
+
+        auto upstream = block_counting_resource{};
+        auto arena    = wl::decode_arena{ wl::decode_arena::default_initial_block_size, &upstream };
+        auto ov       = wl::message_overload_set{};
+        auto globals  = std::vector<global>{};
+        globals.reserve(payloads.size());
+        ov.add_overload<global>(registry, arena, [&](const global& msg) {
+            globals.push_back(msg);
+        });
+
+        for (const auto& payload : payloads) {
+            const auto overload =
+                ov.overload_resolution({ registry.value }, { global::opcode.value });
+            std::invoke(overload.value(), payload);
+        }
+
+        expect(upstream.blocks == 1uz);
+        expect(globals.size() == payloads.size());
+        expect(std::u8string_view(globals.back().interface) == interfaces[399 % interfaces.size()]);
+    };
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/type_utils.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/event_stream.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using xdg_toplevel     = wl::protocols::xdg_toplevel;
+    using configure        = xdg_toplevel::event::configure;
+    using close            = xdg_toplevel::event::close;
+    using configure_bounds = xdg_toplevel::event::configure_bounds;
+
+    constexpr auto toplevel       = wl::Wobject<xdg_toplevel>{ 5u };
+    constexpr auto other_toplevel = wl::Wobject<xdg_toplevel>{ 6u };
+
+    wl_tag / "event lists are in opcode order"_test = [] {
+        using events = wl::event_variant<xdg_toplevel>;
+        static_assert(std::variant_size_v<events> == xdg_toplevel::event_list::size);
+        static_assert(std::same_as<std::variant_alternative_t<0, events>, configure>);
+        static_assert(std::same_as<std::variant_alternative_t<1, events>, close>);
+        static_assert(configure_bounds::opcode.value == 2);
+        static_assert(std::same_as<std::variant_alternative_t<2, events>, configure_bounds>);
+        expect(true);
+    };
+
+    wl_tag / "decode_event decodes the event corresponding to the opcode"_test = [] {
+        auto buff = wl::message_buffer{};
+        buff.append(toplevel, configure_bounds{ .width{ 640 }, .height{ 480 } });
+        const auto data = buff.release_data();
+
+        const auto event = wl::decode_event<xdg_toplevel>(wl::parse_first_message(data));
+        expect(fatal(std::holds_alternative<configure_bounds>(event)));
+        expect(std::get<configure_bounds>(event).width.value == 640);
+        expect(std::get<configure_bounds>(event).height.value == 480);
+    };
+
+    wl_tag / "decode_event throws on unknown opcode"_test = [] {
+        const auto msg = wl::parsed_message{ .object_id{ toplevel.value }, .opcode{ 42u } };
+        expect(throws<std::logic_error>(
+            [&] { std::ignore = wl::decode_event<xdg_toplevel>(msg); }));
+    };
+
+    wl_tag / "event_range yields events of one object"_test = [] {
+        auto buff = wl::message_buffer{};
+        buff.append(other_toplevel, close{});
+        buff.append(toplevel, configure_bounds{ .width{ 1 }, .height{ 2 } });
+        buff.append(other_toplevel, close{});
+        buff.append(toplevel, close{});
+        const auto data = buff.release_data();
+
+        auto bounds_seen = 0uz;
+        auto closes_seen = 0uz;
+        for (const auto& event : wl::event_range{ wl::parsed_message_range{ data }, toplevel }) {
+            std::visit(sstd::overloaded{ [&](const configure_bounds&) { ++bounds_seen; },
+                                         [&](const close&) { ++closes_seen; },
+                                         [](const auto&) {} },
+                       event);
+        }
+        expect(bounds_seen == 1uz);
+        expect(closes_seen == 1uz);
+    };
+
+    wl_tag / "connected_client can pull events of an object"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto buff = wl::message_buffer{};
+        buff.append(toplevel, configure_bounds{ .width{ 3 }, .height{ 4 } });
+        buff.append(other_toplevel, close{});
+        buff.append(toplevel, close{});
+        server_sock.write(buff.release_data());
+
+        auto opcodes = std::array<std::size_t, 2>{};
+        auto events  = 0uz;
+        for (const auto& event : client.events_of(toplevel)) {
+            if (events < opcodes.size()) { opcodes[events] = event.index(); }
+            ++events;
+        }
+        expect(events == 2uz);
+        expect(opcodes[0] == configure_bounds::opcode.value);
+        expect(opcodes[1] == close::opcode.value);
+
+        wl_tag / "and the events of other objects are still delivered"_test = [&] {
+            auto other_closes = 0uz;
+            auto ov           = wl::message_overload_set{};
+            client.recv_and_visit_events(ov).until<close>(other_toplevel,
+                                                          [&](const close&) { ++other_closes; });
+            expect(other_closes == 1uz);
+        };
+    };
+
+    wl_tag / "connected_client pulls events left from previous pull without reading"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto buff = wl::message_buffer{};
+        buff.append(other_toplevel, close{});
+        buff.append(toplevel, close{});
+        buff.append(other_toplevel, configure_bounds{ .width{ 5 }, .height{ 6 } });
+        server_sock.write(buff.release_data());
+
+        auto toplevel_events = 0uz;
+        for (const auto& event : client.events_of(toplevel)) {
+            expect(event.index() == close::opcode.value);
+            ++toplevel_events;
+        }
+        expect(toplevel_events == 1uz);
+
+        // Would block if the events of other_toplevel were lost.
+        auto opcodes = std::array<std::size_t, 2>{};
+        auto events  = 0uz;
+        for (const auto& event : client.events_of(other_toplevel)) {
+            if (events < opcodes.size()) { opcodes[events] = event.index(); }
+            ++events;
+        }
+        expect(events == 2uz);
+        expect(opcodes[0] == close::opcode.value);
+        expect(opcodes[1] == configure_bounds::opcode.value);
+    };
+}
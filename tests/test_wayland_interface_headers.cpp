@@ -0,0 +1,73 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <variant>
+
+#include "waylander/wayland/event_stream.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+
+// Generated from protocols/split_test.xml with waylander_protocol_generator_command.
+// Includes also test_b.hpp, but test_c.hpp is not generated.
+#include "test_a.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using test_a     = wl::protocols::test_a;
+    using test_b     = wl::protocols::test_b;
+    using create_b   = test_a::request::create_b;
+    using kind_of_b  = test_a::event::kind_of_b;
+    using set_parent = test_b::request::set_parent;
+
+    wl_tag / "interface headers contain the interface"_test = [] {
+        static_assert(test_a::name == u8"test_a");
+        static_assert(test_a::version == 2u);
+        static_assert(kind_of_b::since == 2u);
+        static_assert(wl::message_for_inteface<create_b, test_a>);
+        static_assert(create_b::fields::size == 1);
+        expect(true);
+    };
+
+    wl_tag / "interface headers include interfaces referring to each other"_test = [] {
+        static_assert(test_b::name == u8"test_b");
+        static_assert(set_parent::fields::size == 2);
+        static_assert(static_cast<Wint::integral_type>(test_b::kind::Elarge) == 1);
+        expect(true);
+    };
+
+    wl_tag / "messages of interface headers can be encoded and decoded"_test = [] {
+        constexpr auto a = wl::Wobject<test_a>{ 3u };
+        constexpr auto b = wl::Wobject<test_b>{ 4u };
+
+        auto buff = wl::message_buffer{};
+        buff.append(a, kind_of_b{ .b = b, .kind = test_b::kind::Elarge });
+        const auto data = buff.release_data();
+
+        const auto event = wl::decode_event<test_a, wl::decode_policy::checked>(
+            wl::parse_first_message(data));
+        expect(std::holds_alternative<kind_of_b>(event));
+        expect(std::get<kind_of_b>(event).b.value == b.value);
+        expect(std::get<kind_of_b>(event).kind == test_b::kind::Elarge);
+    };
+}
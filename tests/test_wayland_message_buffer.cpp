@@ -18,7 +18,9 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
@@ -363,4 +365,24 @@ int main() {
         // receiving Wfd primitives at the moment, so there is no utility to do anything
         // with a Wfd object.
     };
+
+    wl_tag / "message_buffer allocates from given memory resource"_test = [] {
+        auto storage  = std::array<std::byte, 1024>{};
+        auto resource = std::pmr::monotonic_buffer_resource{ storage.data(),
+                                                             storage.size(),
+                                                             std::pmr::null_memory_resource() };
+        const auto in_storage = [&](const std::byte* const ptr) {
+            return std::less_equal{}(storage.data(), ptr)
+                   and std::less{}(ptr, storage.data() + storage.size());
+        };
+
+        auto buff = wl::message_buffer{ &resource };
+        buff.append(wl::global_display_object,
+                    wl::protocols::wl_display::request::get_registry{ 2u });
+        expect(in_storage(buff.data().data()));
+
+        const auto released_data = buff.release_data();
+        expect(released_data.get_allocator().resource() == &resource);
+        expect(in_storage(released_data.data()));
+    };
 }
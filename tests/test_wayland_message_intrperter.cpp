@@ -0,0 +1,172 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using global    = wl::protocols::wl_registry::event::global;
+    using enter     = wl::protocols::wl_keyboard::event::enter;
+    using delete_id = wl::protocols::wl_display::event::delete_id;
+
+    constexpr auto registry = wl::Wobject<wl::protocols::wl_registry>{ 2u };
+    constexpr auto keyboard = wl::Wobject<wl::protocols::wl_keyboard>{ 3u };
+
+    /// Encodes one message and returns its payload.
+    const auto encode_payload = [](const auto obj, const auto& msg) {
+        auto buff           = wl::message_buffer{};
+        buff.append(obj, msg);
+        const auto data     = buff.release_data();
+        const auto msg_view = wl::parse_first_message(data);
+        return std::vector<std::byte>(msg_view.arguments.begin(), msg_view.arguments.end());
+    };
+
+    /// Overwrites the size of Wstring or Warray at \p offset.
+    const auto set_size = [](std::vector<std::byte>& payload,
+                             const std::size_t offset,
+                             const std::uint32_t size) {
+        std::memcpy(payload.data() + offset, &size, sizeof(size));
+    };
+
+    const auto global_payload =
+        encode_payload(registry, global{ .name{ 1u }, .interface{ u8"wl_seat" }, .version{ 9u } });
+    // Offset of the string size in global_payload.
+    constexpr auto interface_offset = sizeof(wl::Wuint);
+
+    wl_tag / "validate_message_payload accepts payloads from message_buffer"_test = [&] {
+        const auto keys = std::array{ std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+
+        expect(wl::validate_message_payload<global>(global_payload));
+        expect(wl::validate_message_payload<enter>(encode_payload(
+            keyboard,
+            enter{ .serial{ 1u }, .surface{ 2u }, .keys{ std::span(keys) } })));
+        expect(wl::validate_message_payload<delete_id>(
+            encode_payload(wl::global_display_object, delete_id{ .id{ 4u } })));
+        expect(wl::validate_message_payload<global>(
+            encode_payload(registry, global{ .name{ 1u }, .interface{}, .version{ 9u } })));
+    };
+
+    wl_tag / "validate_message_payload rejects truncated payloads"_test = [&] {
+        for (auto size = 0uz; size < global_payload.size(); ++size) {
+            expect(not wl::validate_message_payload<global>(std::span(global_payload).first(size)))
+                << "size:" << size;
+        }
+    };
+
+    wl_tag / "validate_message_payload rejects trailing bytes"_test = [&] {
+        auto payload = global_payload;
+        payload.resize(payload.size() + 4uz);
+        expect(not wl::validate_message_payload<global>(payload));
+    };
+
+    wl_tag / "validate_message_payload rejects out of bounds lengths"_test = [&] {
+        auto payload = global_payload;
+        set_size(payload, interface_offset, 0xffff'ffffu);
+        expect(not wl::validate_message_payload<global>(payload));
+    };
+
+    wl_tag / "validate_message_payload rejects strings without null delimiter"_test = [&] {
+        auto payload = global_payload;
+        // "wl_seat" is 7 characters, so without the delimiter it still fits to the padding.
+        set_size(payload, interface_offset, 7u);
+        expect(not wl::validate_message_payload<global>(payload));
+    };
+
+    wl_tag / "checked decode_policy throws on invalid payload"_test = [&] {
+        auto payload = global_payload;
+        set_size(payload, interface_offset, 0xffff'ffffu);
+
+        expect(throws<std::logic_error>([&] {
+            std::ignore =
+                wl::interpert_message_payload<global, wl::decode_policy::checked>(payload);
+        }));
+        expect(nothrow([&] {
+            std::ignore =
+                wl::interpert_message_payload<global, wl::decode_policy::checked>(global_payload);
+        }));
+    };
+
+    wl_tag / "encode_request and decode_message_payload match constexpr versions"_test = [&] {
+        const auto msg = global{ .name{ 1u }, .interface{ u8"wl_seat" }, .version{ 9u } };
+
+        auto buff = wl::message_buffer{};
+        wl::encode_request(buff, registry, msg);
+        auto expected = wl::message_buffer{};
+        expected.append(registry, msg);
+        expect(std::ranges::equal(buff.data(), expected.data()));
+
+        const auto decoded =
+            wl::decode_message_payload<global, wl::decode_policy::checked>(global_payload);
+        expect(decoded.name == 1u);
+        expect(decoded.interface == u8"wl_seat");
+        expect(decoded.version == 9u);
+    };
+
+    wl_tag / "message_overload_set checks payloads by default"_test = [&] {
+        auto payload = global_payload;
+        set_size(payload, interface_offset, 0xffff'ffffu);
+
+        auto overloads_called = 0uz;
+        auto ov               = wl::message_overload_set{};
+        ov.add_overload<global>(registry, [&](const global&) { ++overloads_called; });
+
+        auto overload = ov.overload_resolution({ registry.value }, { global::opcode.value });
+        expect(fatal(overload.has_value()));
+        expect(throws<std::logic_error>([&] { std::invoke(overload.value(), payload); }));
+        expect(overloads_called == 0uz);
+    };
+
+    wl_tag / "generated fields match probed message arguments"_test = [&] {
+        using bind = wl::protocols::wl_registry::request::bind;
+        static_assert(wl::message_with_fields<global>);
+        static_assert(std::same_as<wl::message_argument_tuple<global>,
+                                   decltype(sstd::to_tuple(std::declval<global>()))>);
+        static_assert(std::same_as<wl::message_argument_tuple<bind>,
+                                   decltype(sstd::to_tuple(std::declval<bind>()))>);
+        static_assert(delete_id::fields::size == 1uz);
+
+        const auto msg = global{ .name = { 1u }, .interface = {}, .version = { 4u } };
+        const auto [name, interface, version] = wl::message_arguments_as_ref_tuple(msg);
+        expect(&name == &msg.name);
+        expect(&interface == &msg.interface);
+        expect(&version == &msg.version);
+    };
+}
@@ -24,6 +24,7 @@
 
 #include "waylander/byte_array.hpp"
 #include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_buffer.hpp"
 #include "waylander/wayland/message_parser.hpp"
 #include "waylander/wayland/protocol_primitives.hpp"
 #include "waylander/wayland/protocols/wayland_protocol.hpp"
@@ -193,4 +194,57 @@ int main() {
                 messages_AB.bytes().subspan(B_arg_offset, header_B.size.value - 8)));
         };
     };
+
+    wl_tag / "parsed_message_range yields same messages as parsed_message_generator"_test = [] {
+        using wl_display    = wl::protocols::wl_display;
+        using get_registery = wl_display::request::get_registry;
+        using sync          = wl_display::request::sync;
+
+        auto buff = wl::message_buffer{};
+        buff.append(wl::global_display_object, get_registery{ 2u });
+        buff.append(wl::global_display_object, sync{ 3u });
+        buff.append(wl::global_display_object, get_registery{ 4u });
+        const auto data = buff.release_data();
+
+        const auto same_messages = [&](auto&& msg_range) {
+            auto gen      = wl::parsed_message_generator(data);
+            auto gen_iter = gen.begin();
+            for (const auto& msg : msg_range) {
+                if (gen_iter == gen.end()) { return false; }
+                const auto& expected = *gen_iter++;
+                if (msg.object_id != expected.object_id or msg.opcode != expected.opcode
+                    or msg.arguments.data() != expected.arguments.data()
+                    or msg.arguments.size() != expected.arguments.size()) {
+                    return false;
+                }
+            }
+            return gen_iter == gen.end();
+        };
+
+        expect(same_messages(wl::parsed_message_range{ data }));
+        expect(same_messages(wl::unchecked_parsed_message_range{ data }));
+    };
+
+    wl_tag / "parsed_message_range can handle empty input"_test = [] {
+        const auto empty_vec = std::vector<std::byte>{};
+        const auto range     = wl::parsed_message_range{ empty_vec };
+        expect(range.begin() == range.end());
+    };
+
+    wl_tag / "parsed_message_range detects too short message at the end"_test = [] {
+        using wl_display           = wl::protocols::wl_display;
+        using get_registery        = wl_display::request::get_registry;
+        constexpr auto header      = wl::message_header<wl_display>(wl::global_display_object,
+                                                                    get_registery::opcode,
+                                                                    { 12u });
+        constexpr auto msg         = get_registery{ 2u };
+        constexpr auto garbage_msg = 42u;
+        auto get_registery_request = sstd::byte_array<16>{ header, msg, garbage_msg };
+
+        const auto range  = wl::parsed_message_range{ get_registery_request.bytes() };
+        auto msg_iterator = range.begin();
+
+        expect(msg_iterator != range.end());
+        expect(throws<std::logic_error>([&] { ++msg_iterator; }));
+    };
 }
@@ -0,0 +1,181 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_printer.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+namespace {
+
+using namespace waylander;
+
+/// Metadata has an entry with as many arguments as fields for each message.
+template<typename... Msgs>
+constexpr bool infos_match(wl::message_list<Msgs...>,
+                           const std::span<const wl::message_info> infos) {
+    if (infos.size() != sizeof...(Msgs)) { return false; }
+    auto opcode = 0uz;
+    return ((infos[opcode++].arguments.size() == Msgs::fields::size) and ...);
+}
+
+template<wl::interface W>
+constexpr bool interface_infos_match() {
+    return infos_match(typename W::request_list{}, W::request_infos)
+           and infos_match(typename W::event_list{}, W::event_infos);
+}
+
+/// Renders the only message in \p buff.
+auto format_only_message(wl::message_printer& printer,
+                         const wl::wire_direction direction,
+                         wl::message_buffer& buff) {
+    const auto data = sstd::byte_vec(buff.data().begin(), buff.data().end());
+    buff.clear();
+    return printer.format(direction, wl::parse_first_message(data));
+}
+
+} // namespace
+
+int main() {
+    using namespace boost::ut;
+    using namespace wl::protocols;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    wl_tag / "generated metadata matches generated messages"_test = [] {
+        static_assert(interface_infos_match<wl_display>());
+        static_assert(interface_infos_match<wl_registry>());
+        static_assert(interface_infos_match<wl_surface>());
+        static_assert(interface_infos_match<wl_pointer>());
+        static_assert(interface_infos_match<xdg_toplevel>());
+
+        static_assert(wl_registry::request_infos[0].name == u8"bind");
+        static_assert(wl_registry::request_infos[0].signature == u8"usun");
+        static_assert(wl_compositor::request_infos[0].arguments[0].interface == u8"wl_surface");
+        static_assert(wayland_interfaces.size() == 23uz);
+        static_assert(wayland_interfaces[1].name == wl_registry::name);
+    };
+
+    wl_tag / "message_printer renders arguments"_test = [] {
+        auto printer = wl::message_printer{ wayland_interfaces };
+        auto buff    = wl::message_buffer{};
+
+        buff.append(wl::global_display_object, wl_display::request::get_registry{ 2u });
+        expect(format_only_message(printer, wl::wire_direction::sent, buff)
+               == "wl_display#1.get_registry(registry: new id wl_registry#2)");
+
+        buff.append(wl::Wobject<wl_registry>{ 2 },
+                    wl_registry::event::global{ .name{ 1u },
+                                                .interface{ u8"wl_compositor" },
+                                                .version{ 6u } });
+        expect(format_only_message(printer, wl::wire_direction::received, buff)
+               == R"(wl_registry#2.global(name: 1, interface: "wl_compositor", version: 6))");
+
+        buff.append(wl::Wobject<wl_registry>{ 2 },
+                    wl_registry::request::bind{ .name{ 1u },
+                                                .new_id_interface{ u8"wl_compositor" },
+                                                .new_id_interface_version{ 6u },
+                                                .id{ 3u } });
+        expect(format_only_message(printer, wl::wire_direction::sent, buff)
+               == "wl_registry#2.bind(name: 1, new_id_interface: \"wl_compositor\", "
+                  "new_id_interface_version: 6, id: new id wl_compositor#3)");
+
+        buff.append(wl::Wobject<wl_compositor>{ 3 }, wl_compositor::request::create_surface{ 4u });
+        expect(format_only_message(printer, wl::wire_direction::sent, buff)
+               == "wl_compositor#3.create_surface(id: new id wl_surface#4)");
+
+        buff.append(wl::Wobject<wl_surface>{ 4 },
+                    wl_surface::request::attach{ .buffer{ 0u }, .x{ -1 }, .y{ 2 } });
+        expect(format_only_message(printer, wl::wire_direction::sent, buff)
+               == "wl_surface#4.attach(buffer: nil, x: -1, y: 2)");
+    };
+
+    wl_tag / "message_printer follows deleted objects"_test = [] {
+        auto printer = wl::message_printer{ wayland_interfaces };
+        auto buff    = wl::message_buffer{};
+
+        buff.append(wl::global_display_object, wl_display::request::sync{ 3u });
+        expect(format_only_message(printer, wl::wire_direction::sent, buff)
+               == "wl_display#1.sync(callback: new id wl_callback#3)");
+
+        buff.append(wl::Wobject<wl_callback>{ 3 }, wl_callback::event::done{ 7u });
+        expect(format_only_message(printer, wl::wire_direction::received, buff)
+               == "wl_callback#3.done(callback_data: 7)");
+
+        buff.append(wl::global_display_object, wl_display::event::delete_id{ 3u });
+        expect(format_only_message(printer, wl::wire_direction::received, buff)
+               == "wl_display#1.delete_id(id: 3)");
+
+        buff.append(wl::Wobject<wl_callback>{ 3 }, wl_callback::event::done{ 7u });
+        expect(format_only_message(printer, wl::wire_direction::received, buff)
+               == "unknown#3.opcode 0(4 bytes)");
+    };
+
+    wl_tag / "message_printer detects payloads not matching the signature"_test = [] {
+        auto printer = wl::message_printer{ wayland_interfaces };
+        auto buff    = wl::message_buffer{};
+
+        // wl_display::sync payload given as wl_display::error, which has three arguments.
+        buff.append(wl::global_display_object, wl_display::request::sync{ 3u });
+        const auto data = sstd::byte_vec(buff.data().begin(), buff.data().end());
+        const auto msg  = wl::parse_first_message(data);
+        expect(throws<std::logic_error>(
+            [&] { std::ignore = printer.format(wl::wire_direction::received, msg); }));
+    };
+
+    wl_tag / "format_wire_trace renders both directions of a trace"_test = [] {
+        auto buff = wl::message_buffer{};
+        buff.append(wl::global_display_object, wl_display::request::sync{ 3u });
+        const auto request = sstd::byte_vec(buff.data().begin(), buff.data().end());
+        buff.clear();
+        buff.append(wl::Wobject<wl_callback>{ 3 }, wl_callback::event::done{ 7u });
+        const auto event = sstd::byte_vec(buff.data().begin(), buff.data().end());
+
+        auto ring = wl::wire_trace_ring{ 1024 };
+        expect(ring.record(wl::wire_direction::sent, std::span{ request }.first(5)));
+        expect(ring.record(wl::wire_direction::received, event));
+        expect(ring.record(wl::wire_direction::sent, std::span{ request }.subspan(5)));
+
+        auto trace = sstd::byte_vec(wl::wire_trace_magic.begin(), wl::wire_trace_magic.end());
+        ring.consume([&](const auto bytes) {
+            trace.insert(trace.end(), bytes.begin(), bytes.end());
+        });
+
+        auto printer = wl::message_printer{ wayland_interfaces };
+        auto lines   = std::vector<std::string>{};
+        for (auto&& line : wl::format_wire_trace(trace, printer)) { lines.push_back(line); }
+
+        expect(fatal(lines.size() == 2uz));
+        // The event is rendered first, as the request is complete only in the last record.
+        expect(lines[0].ends_with("] unknown#3.opcode 0(4 bytes)"));
+        expect(lines[1].ends_with("]  -> wl_display#1.sync(callback: new id wl_callback#3)"));
+    };
+}
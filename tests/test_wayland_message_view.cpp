@@ -0,0 +1,134 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_view.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using global    = wl::protocols::wl_registry::event::global;
+    using error     = wl::protocols::wl_display::event::error;
+    using configure = wl::protocols::wl_shell_surface::event::configure;
+
+    constexpr auto registry = wl::Wobject<wl::protocols::wl_registry>{ 2u };
+
+    /// Encodes one message and returns its payload.
+    const auto encode_payload = [](const auto obj, const auto& msg) {
+        auto buff           = wl::message_buffer{};
+        buff.append(obj, msg);
+        const auto data     = buff.release_data();
+        const auto msg_view = wl::parse_first_message(data);
+        return std::vector<std::byte>(msg_view.arguments.begin(), msg_view.arguments.end());
+    };
+
+    wl_tag / "message_view offsets before first dynamic argument are constant"_test = [] {
+        // Offsets of these do not depend on the payload.
+        constexpr auto no_payload = std::span<const std::byte>{};
+
+        using view = wl::message_view<global>;
+        static_assert(view::argument_count == 3uz);
+        static_assert(view{ no_payload }.offset<0>() == 0uz);
+        static_assert(view{ no_payload }.offset<1>() == sizeof(wl::Wuint));
+
+        using configure_view = wl::message_view<configure>;
+        static_assert(configure_view{ no_payload }.offset<2>() == 2uz * sizeof(wl::Wuint));
+        expect(true);
+    };
+
+    wl_tag / "message_view decodes same arguments as interpert_message_payload"_test = [&] {
+        const auto payload = encode_payload(
+            registry,
+            global{ .name{ 42u }, .interface{ u8"wl_compositor" }, .version{ 6u } });
+
+        const auto view = wl::message_view<global>{ payload };
+        const auto msg  = wl::interpert_message_payload<global>(payload);
+
+        expect(view.get<&global::name>().value == msg.name.value);
+        expect(std::u8string_view(view.get<&global::interface>())
+               == std::u8string_view(msg.interface));
+        expect(view.get<&global::version>().value == msg.version.value);
+        expect(view.materialize().version.value == 6u);
+    };
+
+    wl_tag / "message_view computes offsets after dynamic arguments"_test = [&] {
+        const auto payload = encode_payload(
+            wl::global_display_object,
+            error{ .object_id{ 3u }, .code{ 4u }, .message{ u8"something went wrong" } });
+
+        const auto view = wl::message_view<error>{ payload };
+        expect(std::u8string_view(view.get<&error::message>()) == u8"something went wrong");
+
+        const auto payload_B = encode_payload(
+            registry,
+            global{ .name{ 1u }, .interface{ u8"wl_shm" }, .version{ 2u } });
+        const auto view_B = wl::message_view<global>{ payload_B };
+        // 4 for name, 4 for string size and 8 for padded "wl_shm\0".
+        expect(view_B.offset<&global::version>() == 16uz);
+        expect(view_B.get<&global::version>().value == 2u);
+    };
+
+    wl_tag / "message_view accesses arguments by name same as by index"_test = [&] {
+        const auto payload = encode_payload(
+            wl::global_display_object,
+            error{ .object_id{ 3u }, .code{ 4u }, .message{ u8"by name" } });
+
+        static_assert(global::fields::index_of<&global::version> == 2uz);
+        static_assert(global::fields::index_of<&error::code> == global::fields::size);
+
+        const auto view = wl::message_view<error>{ payload };
+        expect(view.offset<&error::message>() == view.offset<2>());
+        expect(view.get<&error::object_id>().value == view.get<0>().value);
+        expect(view.get<&error::code>().value == 4u);
+        expect(std::u8string_view(view.get<&error::message>())
+               == std::u8string_view(view.get<2>()));
+    };
+
+    wl_tag / "message_overload_set can give message_view to overloads"_test = [&] {
+        const auto payload = encode_payload(
+            registry,
+            global{ .name{ 7u }, .interface{ u8"wl_seat" }, .version{ 9u } });
+
+        auto interface = std::u8string{};
+        auto ov        = wl::message_overload_set{};
+        ov.add_view_overload<global>(registry, [&](const wl::message_view<global> view) {
+            interface = std::u8string_view(view.get<&global::interface>());
+        });
+
+        const auto overload = ov.overload_resolution({ registry.value }, { global::opcode.value });
+        expect(fatal(overload.has_value()));
+        std::invoke(overload.value(), payload);
+        expect(interface == u8"wl_seat");
+    };
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+#include "gnulander/memory_block.hpp"
+
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+
+#include "mock_compositor.hpp"
+
+namespace {
+
+using namespace waylander;
+using namespace wl::protocols;
+
+/// Client side of the startup and frame loop against mock_compositor.
+struct mock_client {
+    wl::connected_client client;
+    wl::mock_compositor& compositor;
+
+    wl::Wobject<wl_compositor> compositor_obj{};
+    wl::Wobject<wl_shm> shm{};
+    wl::Wobject<xdg_wm_base> wm_base{};
+    wl::Wobject<wl_surface> surface{};
+    wl::Wobject<xdg_surface> xdg_surf{};
+    wl::Wobject<xdg_toplevel> toplevel{};
+    wl::Wobject<wl_buffer> buffer{};
+    std::size_t pings{ 0 };
+
+    gnulander::memory_block mem{};
+
+    /// Flushes the requests and a sync, lets the compositor answer and visits until the sync.
+    void roundtrip(wl::message_overload_set& ov) {
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(wl::global_display_object, wl_display::request::sync{ callback });
+        client.flush_registered_requests();
+        compositor.dispatch();
+        client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+    }
+
+    void start_up() {
+        const auto registry = client.reserve_object_id<wl_registry>();
+        client.register_request(wl::global_display_object,
+                                wl_display::request::get_registry{ registry });
+
+        auto ov = wl::message_overload_set{};
+        ov.add_overload<wl_registry::event::global>(registry, [&](const auto& global) {
+            using bind    = wl_registry::request::bind;
+            const auto id = client.reserve_object_id();
+            client.register_request(registry,
+                                    bind{ .name                     = global.name,
+                                          .new_id_interface         = global.interface,
+                                          .new_id_interface_version = global.version,
+                                          .id{ id.value } });
+            if (global.interface == wl_compositor::name) { compositor_obj = { id.value }; }
+            if (global.interface == wl_shm::name) { shm = { id.value }; }
+            if (global.interface == xdg_wm_base::name) { wm_base = { id.value }; }
+        });
+        roundtrip(ov);
+
+        surface  = client.reserve_object_id<wl_surface>();
+        xdg_surf = client.reserve_object_id<xdg_surface>();
+        toplevel = client.reserve_object_id<xdg_toplevel>();
+        client.register_request(compositor_obj, wl_compositor::request::create_surface{ surface });
+        client.register_request(wm_base,
+                                xdg_wm_base::request::get_xdg_surface{ xdg_surf, surface });
+        client.register_request(xdg_surf, xdg_surface::request::get_toplevel{ toplevel });
+        client.register_request(surface, wl_surface::request::commit{});
+
+        auto configure_ov = wl::message_overload_set{};
+        configure_ov.add_overload<xdg_surface::event::configure>(xdg_surf, [&](const auto& conf) {
+            client.register_request(xdg_surf, xdg_surface::request::ack_configure{ conf.serial });
+        });
+        roundtrip(configure_ov);
+
+        static constexpr auto size = 64 * 64 * 4;
+        mem.truncate(size);
+        const auto pool = client.reserve_object_id<wl_shm_pool>();
+        buffer          = client.reserve_object_id<wl_buffer>();
+        client.register_request(shm,
+                                wl_shm::request::create_pool{ .id{ pool },
+                                                              .fd{ gnulander::fd_ref{ mem } },
+                                                              .size{ size } });
+        client.register_request(pool,
+                                wl_shm_pool::request::create_buffer{
+                                    .id{ buffer },
+                                    .offset{ 0 },
+                                    .width{ 64 },
+                                    .height{ 64 },
+                                    .stride{ 64 * 4 },
+                                    .format = wl_shm::format::Eargb8888 });
+    }
+
+    /// Attaches the buffer, commits and waits for the frame callback.
+    void frame() {
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(surface, wl_surface::request::attach{ buffer, { 0 }, { 0 } });
+        client.register_request(surface, wl_surface::request::frame{ callback });
+        client.register_request(surface, wl_surface::request::commit{});
+        client.flush_registered_requests();
+        compositor.dispatch();
+
+        auto ov = wl::message_overload_set{};
+        ov.add_overload<xdg_wm_base::event::ping>(wm_base, [&](const auto& ping) {
+            client.register_request(wm_base, xdg_wm_base::request::pong{ ping.serial });
+            ++pings;
+        });
+        client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+    }
+};
+
+} // namespace
+
+int main() {
+    using namespace boost::ut;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    wl_tag / "mock_compositor answers sync"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client = mock_client{ .client{ std::move(client_sock) }, .compositor = compositor };
+
+        auto ov = wl::message_overload_set{};
+        client.roundtrip(ov);
+        expect(compositor.received_requests() == 1uz);
+    };
+
+    wl_tag / "mock_compositor advertises and binds globals and configures toplevel"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client = mock_client{ .client{ std::move(client_sock) }, .compositor = compositor };
+
+        client.start_up();
+        auto ov = wl::message_overload_set{};
+        client.roundtrip(ov);
+        expect(client.compositor_obj.value != 0u);
+        expect(client.shm.value != 0u);
+        expect(client.wm_base.value != 0u);
+        expect(compositor.last_acked_serial() != 0u);
+    };
+
+    wl_tag / "mock_compositor runs frame loop"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client = mock_client{ .client{ std::move(client_sock) }, .compositor = compositor };
+
+        client.start_up();
+        for (auto i = 0; i < 10; ++i) { client.frame(); }
+        expect(compositor.committed_frames() == 10uz);
+    };
+
+    wl_tag / "mock_compositor floods pings"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor =
+            wl::mock_compositor{ std::move(server_sock), { .pings_per_frame = 3 } };
+        auto client = mock_client{ .client{ std::move(client_sock) }, .compositor = compositor };
+
+        client.start_up();
+        client.frame();
+        client.frame();
+        expect(client.pings == 6uz);
+        // Pongs of the last frame are not flushed yet.
+        expect(compositor.pongs() == 3uz);
+    };
+
+    wl_tag / "mock_compositor delays replies"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        using namespace std::chrono_literals;
+        auto compositor =
+            wl::mock_compositor{ std::move(server_sock), { .reply_latency = 2ms } };
+        auto client = mock_client{ .client{ std::move(client_sock) }, .compositor = compositor };
+
+        auto ov          = wl::message_overload_set{};
+        const auto start = std::chrono::steady_clock::now();
+        client.roundtrip(ov);
+        expect(std::chrono::steady_clock::now() - start >= 2ms);
+    };
+}
@@ -15,8 +15,10 @@
 
 #include <boost/ut.hpp> // import boost.ut;
 
+#include <array>
 #include <concepts>
 
+#include "waylander/wayland/fixed_conversion.hpp"
 #include "waylander/wayland/protocol_primitives.hpp"
 #include "waylander/wayland/protocols/wayland_protocol.hpp"
 
@@ -43,7 +45,7 @@ int main() {
     wl_tag / "every primitive can be constructed from integral literals"_test = [] {
         constexpr auto i  = Wint{ 1 };
         constexpr auto ui = Wuint{ 2 };
-        constexpr auto f  = Wfixed{ .is_negative = true, .mantissa = 3, .exponent = 4 };
+        constexpr auto f  = Wfixed{ 5 };
         constexpr auto o  = Wobject{ 6 };
         constexpr auto ni = Wnew_id{ 7 };
         constexpr auto ms = Wmessage_size_t{ 9 };
@@ -52,7 +54,7 @@ int main() {
             message_header<bar>{ Wobject<bar>{ 11 }, Wopcode<bar>{ 13 }, Wmessage_size_t{ 12 } };
         expect(i == 1);
         expect(ui == 2u);
-        expect(f.is_negative == true);
+        expect(f.value == 5);
         expect(o == 6u);
         expect(ni == 7u);
         expect(ms == 9u);
@@ -179,4 +181,66 @@ int main() {
         expect(not std::constructible_from<Wobject<generic_object>, Wnew_id<bar>>);
         expect(not std::constructible_from<Wobject<generic_object>, Wnew_id<generic_object>>);
     };
+
+    wl_tag / "Wfixed is signed 24.8 fixed-point number"_test = [] {
+        static_assert(Wfixed::from_int(3).value == 3 * 256);
+        static_assert(Wfixed::from_int(-3).to_int() == -3);
+        static_assert(Wfixed{ 384 }.to_double() == 1.5);
+        static_assert(Wfixed{ -384 }.to_double() == -1.5);
+        static_assert(Wfixed{ -1 }.to_int() == 0);
+
+        // Rounds to the nearest like libwayland.
+        static_assert(Wfixed::from_double(1.5).value == 384);
+        static_assert(Wfixed::from_double(-1.5).value == -384);
+        static_assert(Wfixed::from_double(0.3).value == 77);
+        static_assert(Wfixed::from_double(-0.3).value == -77);
+        expect(true);
+    };
+
+    wl_tag / "Wfixed arithmetic"_test = [] {
+        constexpr auto a = Wfixed::from_double(1.5);
+        constexpr auto b = Wfixed::from_double(-2.25);
+        static_assert((a + b).to_double() == -0.75);
+        static_assert((a - b).to_double() == 3.75);
+        static_assert((-a).to_double() == -1.5);
+        static_assert((a * b).to_double() == -3.375);
+        static_assert((b / a).to_double() == -1.5);
+        static_assert(b < a);
+        static_assert(a == Wfixed{ 384 });
+
+        auto c = a;
+        c += a;
+        c *= a;
+        expect(c.to_double() == 4.5);
+    };
+
+    wl_tag / "convert_fixed converts batches of Wfixed"_test = [] {
+        constexpr auto in = std::array{ Wfixed::from_double(1.5),
+                                        Wfixed::from_double(-2.25),
+                                        Wfixed::from_int(1000),
+                                        Wfixed{ 1 },
+                                        Wfixed::from_int(-7) };
+        auto floats       = std::array<float, in.size()>{};
+        auto doubles      = std::array<double, in.size()>{};
+        convert_fixed(in, floats);
+        convert_fixed(in, doubles);
+        for (auto i = 0uz; i < in.size(); ++i) {
+            expect(doubles[i] == in[i].to_double());
+            expect(floats[i] == static_cast<float>(in[i].to_double()));
+        }
+    };
+
+    wl_tag / "convert_fixed converts an argument of batch of messages"_test = [] {
+        using motion        = waylander::wl::protocols::wl_pointer::event::motion;
+        constexpr auto msgs = std::array{
+            motion{ .time{ 1u }, .surface_x = Wfixed::from_int(1), .surface_y = Wfixed{ 128 } },
+            motion{ .time{ 2u }, .surface_x = Wfixed::from_int(2), .surface_y = Wfixed{ -128 } },
+        };
+        auto xs = std::array<float, 2>{};
+        auto ys = std::array<float, 2>{};
+        convert_fixed<motion, float>(msgs, &motion::surface_x, xs);
+        convert_fixed<motion, float>(msgs, &motion::surface_y, ys);
+        expect(xs[0] == 1.0f and xs[1] == 2.0f);
+        expect(ys[0] == 0.5f and ys[1] == -0.5f);
+    };
 }
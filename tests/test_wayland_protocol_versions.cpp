@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+#include "waylander/wayland/event_stream.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+#include "waylander/wayland/registry_bind.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using xdg_wm_base      = wl::protocols::xdg_wm_base;
+    using xdg_toplevel     = wl::protocols::xdg_toplevel;
+    using configure        = xdg_toplevel::event::configure;
+    using configure_bounds = xdg_toplevel::event::configure_bounds;
+    using global           = wl::protocols::wl_registry::event::global;
+
+    wl_tag / "generated headers contain interface and message versions"_test = [] {
+        static_assert(xdg_toplevel::name == u8"xdg_toplevel");
+        static_assert(xdg_toplevel::version == 6u);
+        static_assert(configure::since == 1u);
+        static_assert(configure_bounds::since == 4u);
+
+        using axis_discrete = wl::protocols::wl_pointer::event::axis_discrete;
+        static_assert(axis_discrete::since == 5u);
+        static_assert(not wl::message_deprecated_at<axis_discrete, 7u>);
+        static_assert(wl::message_deprecated_at<axis_discrete, 8u>);
+        static_assert(not wl::message_deprecated_at<configure, 6u>);
+        expect(true);
+    };
+
+    wl_tag / "versioned Wobject is usable as unversioned one"_test = [] {
+        constexpr auto versioned = wl::Wobject<xdg_toplevel, 3u>{ 5u };
+        static_assert(sizeof(versioned) == sizeof(wl::Wobject<xdg_toplevel>));
+        static_assert(decltype(versioned)::version == 3u);
+        static_assert(wl::static_message_argument<wl::Wobject<xdg_toplevel, 3u>>);
+
+        const wl::Wobject<xdg_toplevel> unversioned = versioned;
+        expect(unversioned.value == 5u);
+
+        static_assert(wl::message_available_at<configure_bounds, wl::any_version>);
+        static_assert(wl::message_available_at<configure_bounds, 4u>);
+        static_assert(not wl::message_available_at<configure_bounds, 3u>);
+    };
+
+    wl_tag / "decode_event leaves out events newer than the bound version"_test = [] {
+        constexpr auto toplevel = wl::Wobject<xdg_toplevel>{ 5u };
+
+        auto buff = wl::message_buffer{};
+        buff.append(toplevel, configure_bounds{ .width{ 640 }, .height{ 480 } });
+        const auto data = buff.release_data();
+        const auto msg  = wl::parse_first_message(data);
+
+        using wl::decode_policy::checked;
+        expect(throws<std::logic_error>(
+            [&] { std::ignore = wl::decode_event<xdg_toplevel, checked, 3u>(msg); }));
+
+        const auto event = wl::decode_event<xdg_toplevel, checked, 4u>(msg);
+        expect(std::holds_alternative<configure_bounds>(event));
+    };
+
+    wl_tag / "message_overload_set accepts versioned objects"_test = [] {
+        constexpr auto toplevel = wl::Wobject<xdg_toplevel, 4u>{ 5u };
+
+        auto ov = wl::message_overload_set{};
+        ov.add_overload<configure_bounds>(toplevel, [](const configure_bounds&) {});
+        expect(ov.overload_resolution({ toplevel.value }, { configure_bounds::opcode.value })
+                   .has_value());
+    };
+
+    wl_tag / "bind_global clamps the bound version"_test = [] {
+        const auto advertised =
+            global{ .name{ 7u }, .interface{ u8"xdg_wm_base" }, .version{ 5u } };
+
+        const auto bind_v3 = wl::bind_global(advertised, wl::Wobject<xdg_wm_base, 3u>{ 10u });
+        expect(bind_v3.name.value == 7u);
+        expect(bind_v3.new_id_interface == u8"xdg_wm_base");
+        expect(bind_v3.new_id_interface_version.value == 3u);
+        expect(bind_v3.id.value == 10u);
+
+        const auto bind_v5 = wl::bind_global(advertised, wl::Wobject<xdg_wm_base, 6u>{ 10u });
+        expect(bind_v5.new_id_interface_version.value == 5u);
+
+        const auto newer    = global{ .name{ 7u }, .interface{ u8"xdg_wm_base" }, .version{ 9u } };
+        const auto bind_any = wl::bind_global(newer, wl::Wobject<xdg_wm_base>{ 10u });
+        expect(bind_any.new_id_interface_version.value == xdg_wm_base::version);
+    };
+
+    wl_tag / "bind_global throws on global of other interface"_test = [] {
+        const auto advertised = global{ .name{ 7u }, .interface{ u8"wl_shm" }, .version{ 1u } };
+        expect(throws<std::logic_error>([&] {
+            std::ignore = wl::bind_global(advertised, wl::Wobject<xdg_wm_base, 3u>{ 10u });
+        }));
+    };
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_intrperter.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/request_coalescer.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    using wl_surface    = wl::protocols::wl_surface;
+    using wl_region     = wl::protocols::wl_region;
+    using damage_buffer = wl_surface::request::damage_buffer;
+    using damage        = wl_surface::request::damage;
+    using commit        = wl_surface::request::commit;
+    using opaque_region = wl_surface::request::set_opaque_region;
+    using input_region  = wl_surface::request::set_input_region;
+
+    constexpr auto surface       = wl::Wobject<wl_surface>{ 10u };
+    constexpr auto other_surface = wl::Wobject<wl_surface>{ 11u };
+    constexpr auto surfaces      = std::array{ surface, other_surface };
+
+    /// Coalesces and returns the data with the messages pointing to it.
+    const auto coalesce = [&](wl::message_buffer& buff) {
+        wl::coalesce_surface_requests(buff, surfaces);
+        auto data     = buff.release_data();
+        auto messages = std::vector<wl::parsed_message>{};
+        for (const auto& msg : wl::parsed_message_generator(data)) { messages.push_back(msg); }
+        return std::pair{ std::move(data), std::move(messages) };
+    };
+
+    wl_tag / "overlapping damage_buffer requests are merged"_test = [&] {
+        auto buff = wl::message_buffer{};
+        buff.append(surface, damage_buffer{ .x{ 0 }, .y{ 0 }, .width{ 10 }, .height{ 10 } });
+        buff.append(surface, damage_buffer{ .x{ 5 }, .y{ 5 }, .width{ 10 }, .height{ 10 } });
+        buff.append(surface, damage_buffer{ .x{ 10 }, .y{ 0 }, .width{ 10 }, .height{ 1 } });
+        buff.append(surface, commit{});
+
+        const auto [data, messages] = coalesce(buff);
+        expect(fatal(messages.size() == 2uz));
+        expect(messages[0].opcode == damage_buffer::opcode);
+        expect(messages[1].opcode == commit::opcode);
+
+        const auto d = wl::interpert_message_payload<damage_buffer>(messages[0].arguments);
+        expect(d.x == 0 and d.y == 0 and d.width == 20 and d.height == 15);
+    };
+
+    wl_tag / "damage and damage_buffer are not merged together"_test = [&] {
+        auto buff = wl::message_buffer{};
+        buff.append(surface, damage{ .x{ 0 }, .y{ 0 }, .width{ 10 }, .height{ 10 } });
+        buff.append(surface, damage_buffer{ .x{ 0 }, .y{ 0 }, .width{ 10 }, .height{ 10 } });
+        buff.append(surface, damage{ .x{ 0 }, .y{ 0 }, .width{ 5 }, .height{ 5 } });
+        buff.append(surface, commit{});
+
+        const auto [data, messages] = coalesce(buff);
+        expect(fatal(messages.size() == 3uz));
+        expect(messages[0].opcode == damage_buffer::opcode);
+        expect(messages[1].opcode == damage::opcode);
+        expect(messages[2].opcode == commit::opcode);
+    };
+
+    wl_tag / "disjoint damage is bounded"_test = [&] {
+        auto buff = wl::message_buffer{};
+        for (auto i = 0; i < 10; ++i) {
+            buff.append(surface,
+                        damage_buffer{ .x{ 100 * i }, .y{ 0 }, .width{ 10 }, .height{ 10 } });
+        }
+        buff.append(surface, commit{});
+
+        const auto [data, messages] = coalesce(buff);
+        expect(fatal(messages.size() == wl::max_coalesced_damage_rectangles + 1uz));
+        expect(messages.back().opcode == commit::opcode);
+    };
+
+    wl_tag / "only the last region requests before commit are kept"_test = [&] {
+        auto buff = wl::message_buffer{};
+        buff.append(surface, opaque_region{ .region{ 1u } });
+        buff.append(surface, input_region{ .region{ 2u } });
+        buff.append(wl::Wobject<wl_region>{ 1u }, wl_region::request::destroy{});
+        buff.append(surface, opaque_region{ .region{ 3u } });
+        buff.append(surface, input_region{ .region{ 4u } });
+        buff.append(surface, commit{});
+        buff.append(surface, opaque_region{ .region{ 5u } });
+        buff.append(surface, commit{});
+
+        const auto [data, messages] = coalesce(buff);
+        expect(fatal(messages.size() == 6uz));
+        expect(messages[0].object_id == 1u);
+        expect(messages[1].opcode == opaque_region::opcode);
+        expect(wl::interpert_message_payload<opaque_region>(messages[1].arguments).region == 3u);
+        expect(messages[2].opcode == input_region::opcode);
+        expect(wl::interpert_message_payload<input_region>(messages[2].arguments).region == 4u);
+        expect(messages[3].opcode == commit::opcode);
+        expect(wl::interpert_message_payload<opaque_region>(messages[4].arguments).region == 5u);
+        expect(messages[5].opcode == commit::opcode);
+    };
+
+    wl_tag / "surfaces are coalesced independently"_test = [&] {
+        auto buff = wl::message_buffer{};
+        buff.append(surface, opaque_region{ .region{ 1u } });
+        buff.append(other_surface, opaque_region{ .region{ 2u } });
+        buff.append(surface, commit{});
+        buff.append(other_surface, commit{});
+
+        const auto [data, messages] = coalesce(buff);
+        expect(messages.size() == 4uz);
+    };
+
+    wl_tag / "requests of other objects are untouched"_test = [&] {
+        constexpr auto untracked_surface = wl::Wobject<wl_surface>{ 12u };
+
+        auto buff = wl::message_buffer{};
+        buff.append(untracked_surface, opaque_region{ .region{ 1u } });
+        buff.append(untracked_surface, opaque_region{ .region{ 2u } });
+        buff.append(untracked_surface,
+                    damage_buffer{ .x{ 0 }, .y{ 0 }, .width{ 10 }, .height{ 10 } });
+        buff.append(untracked_surface,
+                    damage_buffer{ .x{ 0 }, .y{ 0 }, .width{ 10 }, .height{ 10 } });
+        const auto size_before = buff.size();
+
+        const auto [data, messages] = coalesce(buff);
+        expect(data.size() == size_before);
+        expect(messages.size() == 4uz);
+    };
+
+    wl_tag / "coalescing allocates only from the resource of the buffer"_test = [&] {
+        // Any allocation outside of the storage would throw std::bad_alloc.
+        auto storage  = std::array<std::byte, 1 << 16>{};
+        auto resource = std::pmr::monotonic_buffer_resource{ storage.data(),
+                                                             storage.size(),
+                                                             std::pmr::null_memory_resource() };
+
+        auto buff = wl::message_buffer{ &resource };
+        for (auto i = 0; i < 100; ++i) {
+            buff.append(surface, damage_buffer{ .x{ i }, .y{ 0 }, .width{ 1 }, .height{ 1 } });
+            buff.append(other_surface, opaque_region{ .region{ 1u } });
+        }
+        buff.append(surface, commit{});
+        buff.append(other_surface, commit{});
+
+        auto* const default_resource =
+            std::pmr::set_default_resource(std::pmr::null_memory_resource());
+        expect(nothrow([&] { wl::coalesce_surface_requests(buff, surfaces); }));
+        std::pmr::set_default_resource(default_resource);
+
+        expect(buff.resource() == &resource);
+        auto messages = std::vector<wl::parsed_message>{};
+        for (const auto& msg : wl::parsed_message_range{ buff.data() }) { messages.push_back(msg); }
+        // damage_buffer, opaque_region and a commit for each surface.
+        expect(messages.size() == 4uz);
+    };
+}
@@ -0,0 +1,167 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/protocols/xdg_shell_protocol.hpp"
+#include "waylander/wayland/roundtrip_monitor.hpp"
+
+#include "mock_compositor.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+    using namespace wl::protocols;
+    using namespace std::chrono_literals;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    wl_tag / "latency_histogram percentiles are within sub-bucket precision"_test = [] {
+        auto histogram = wl::latency_histogram{};
+        expect(histogram.percentile(50.0) == 0ns);
+
+        for (auto i = 1; i <= 100; ++i) { histogram.record(std::chrono::microseconds{ i }); }
+
+        expect(histogram.count() == 100uz);
+        expect(histogram.max() == 100us);
+        expect(histogram.percentile(50.0) <= 50us);
+        expect(histogram.percentile(50.0) > 50us * 7 / 8);
+        expect(histogram.percentile(100.0) <= 100us);
+        expect(histogram.percentile(100.0) > 100us * 7 / 8);
+        expect(histogram.percentile(0.0) <= 1us);
+    };
+
+    wl_tag / "roundtrip_monitor measures wl_display.sync roundtrips"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto ov      = wl::message_overload_set{};
+        auto monitor = wl::roundtrip_monitor{ client, ov };
+
+        const auto start = std::chrono::steady_clock::now();
+        monitor.poll(start);
+        expect(monitor.awaiting_roundtrip());
+
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(wl::global_display_object, wl_display::request::sync{ callback });
+        client.flush_registered_requests();
+        compositor.dispatch();
+        client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+
+        expect(not monitor.awaiting_roundtrip());
+        expect(monitor.roundtrips().count() == 1uz);
+
+        monitor.poll(start);
+        expect(not monitor.awaiting_roundtrip());
+        monitor.poll(start + 2s);
+        expect(monitor.awaiting_roundtrip());
+    };
+
+    wl_tag / "roundtrip_monitor reports unanswered wl_display.sync once"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto stalls  = std::vector<wl::stall_event>{};
+        auto ov      = wl::message_overload_set{};
+        auto monitor = wl::roundtrip_monitor{ client,
+                                              ov,
+                                              { .stall_threshold = 100ms },
+                                              [&](const auto& stall) { stalls.push_back(stall); } };
+
+        const auto start = std::chrono::steady_clock::now();
+        monitor.poll(start);
+        monitor.check_for_stall(start + 10ms);
+        expect(stalls.empty());
+
+        monitor.check_for_stall(start + 1s);
+        monitor.check_for_stall(start + 2s);
+        expect((stalls.size() == 1uz) >> fatal);
+        expect(stalls.front().kind == wl::stall_kind::compositor);
+        expect(stalls.front().duration >= 100ms);
+    };
+
+    wl_tag / "roundtrip_monitor reports a stall once when checked from many threads"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto stalls  = std::atomic<std::size_t>{ 0 };
+        auto ov      = wl::message_overload_set{};
+        auto monitor = wl::roundtrip_monitor{ client,
+                                              ov,
+                                              { .stall_threshold = 100ms },
+                                              [&](const auto&) { ++stalls; } };
+
+        const auto start = std::chrono::steady_clock::now();
+        monitor.poll(start);
+        {
+            auto watchdogs = std::vector<std::jthread>{};
+            for (auto i = 0uz; i < 8uz; ++i) {
+                watchdogs.emplace_back([&] {
+                    for (auto j = 0uz; j < 1000uz; ++j) { monitor.check_for_stall(start + 1s); }
+                });
+            }
+        }
+        expect(stalls == 1uz);
+    };
+
+    wl_tag / "roundtrip_monitor answers pings and reports slow responses"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto stalls  = std::vector<wl::stall_event>{};
+        auto ov      = wl::message_overload_set{};
+        auto monitor = wl::roundtrip_monitor{ client,
+                                              ov,
+                                              { .ping_threshold = -1ns },
+                                              [&](const auto& stall) { stalls.push_back(stall); } };
+
+        const auto wm_base = client.reserve_object_id<xdg_wm_base>();
+        monitor.monitor_pings(wm_base);
+
+        auto events = wl::message_buffer{};
+        events.append(wm_base, xdg_wm_base::event::ping{ .serial{ 7u } });
+        events.append(wl::global_display_object, wl_display::event::delete_id{ .id{ 1u } });
+        server_sock.write(events.release_data());
+        client.recv_and_visit_events(ov).until<wl_display::event::delete_id>(
+            wl::global_display_object);
+
+        const auto pong     = xdg_wm_base::request::pong{ .serial{ 7u } };
+        constexpr auto size = sizeof(wl::message_header<xdg_wm_base>) + sizeof(pong);
+        auto buff           = sstd::byte_vec(size);
+        expect(server_sock.read(buff) == size);
+
+        expect(monitor.ping_responses().count() == 1uz);
+        expect((stalls.size() == 1uz) >> fatal);
+        expect(stalls.front().kind == wl::stall_kind::ping_response);
+    };
+}
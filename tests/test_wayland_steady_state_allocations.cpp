@@ -0,0 +1,158 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+/// Checks that a frame loop of connected_client does not allocate after warm-up.
+///
+/// Global allocation functions are replaced in this executable, so every heap allocation
+/// is seen, including the ones made by the dispatch table of message_overload_set.
+/// The buffers are also allocated from a counting_memory_resource, which tells
+/// that the allocations, if any, come from the buffers of the library.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/construct_allocator_adapter.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_visitor.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+
+namespace {
+/// Allocations are counted only when this is set.
+thread_local auto count_allocations = false;
+thread_local auto allocation_count  = 0uz;
+
+[[nodiscard]] auto counted_malloc(const std::size_t size) -> void* {
+    if (count_allocations) { ++allocation_count; }
+    if (auto* const ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+    throw std::bad_alloc{};
+}
+
+[[nodiscard]] auto counted_aligned_alloc(const std::size_t size, const std::align_val_t al)
+    -> void* {
+    if (count_allocations) { ++allocation_count; }
+    const auto alignment    = static_cast<std::size_t>(al);
+    // std::aligned_alloc requires the size to be non-zero multiple of the alignment.
+    const auto aligned_size = std::max(alignment, (size + alignment - 1) / alignment * alignment);
+    if (auto* const ptr = std::aligned_alloc(alignment, aligned_size)) { return ptr; }
+    throw std::bad_alloc{};
+}
+} // namespace
+
+void* operator new(const std::size_t size) { return counted_malloc(size); }
+void* operator new[](const std::size_t size) { return counted_malloc(size); }
+void* operator new(const std::size_t size, const std::align_val_t al) {
+    return counted_aligned_alloc(size, al);
+}
+void* operator new[](const std::size_t size, const std::align_val_t al) {
+    return counted_aligned_alloc(size, al);
+}
+void operator delete(void* const ptr) noexcept { std::free(ptr); }
+void operator delete[](void* const ptr) noexcept { std::free(ptr); }
+void operator delete(void* const ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* const ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* const ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* const ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* const ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* const ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+    using namespace waylander::wl;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    wl_tag / "connected_client frame loop does not allocate after warm-up"_test = [] {
+        using wl_display    = protocols::wl_display;
+        using wl_surface    = protocols::wl_surface;
+        using wl_callback   = protocols::wl_callback;
+        using damage_buffer = wl_surface::request::damage_buffer;
+        using frame         = wl_surface::request::frame;
+        using commit        = wl_surface::request::commit;
+        using done          = wl_callback::event::done;
+        using delete_id     = wl_display::event::delete_id;
+
+        auto resource = sstd::allocator::counting_memory_resource{};
+
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = connected_client{ std::move(client_sock), &resource };
+        // The server side is driven by another connected_client, which sends events instead.
+        auto server = connected_client{ std::move(server_sock), &resource };
+
+        const auto surface = client.reserve_object_id<wl_surface>();
+
+        auto server_ov = message_overload_set{ &resource };
+        server_ov.add_overload<frame>(surface, [&](const frame& msg) {
+            const auto callback = Wobject<wl_callback>{ msg.callback.value };
+            server.register_request(callback, done{ .callback_data{ 0u } });
+            server.register_request(global_display_object, delete_id{ .id{ callback.value } });
+        });
+
+        auto client_ov = message_overload_set{ &resource };
+        // Exercises the dispatch table on every frame.
+        client_ov.add_overload<delete_id>(global_display_object, [](const delete_id&) {});
+
+        const auto simulate_frame = [&] {
+            const auto callback = client.reserve_object_id<wl_callback>();
+            client.register_request(surface,
+                                    damage_buffer{ .x{ 0 }, .y{ 0 }, .width{ 64 }, .height{ 64 } });
+            client.register_request(surface, frame{ callback });
+            client.register_request(surface, commit{});
+            client.flush_registered_requests();
+
+            server.recv_and_visit_events(server_ov).until<commit>(surface);
+            server.flush_registered_requests();
+
+            client.recv_and_visit_events(client_ov).until<done>(callback);
+        };
+
+        static constexpr auto warm_up_frames = 100uz;
+        static constexpr auto frames         = 10'000uz;
+
+        for (auto i = 0uz; i < warm_up_frames; ++i) { simulate_frame(); }
+
+        const auto warm_up_counter = resource.counter();
+        const auto warm_up_flushes = client.flush_stats();
+
+        allocation_count  = 0;
+        count_allocations = true;
+        for (auto i = 0uz; i < frames; ++i) { simulate_frame(); }
+        count_allocations = false;
+
+        expect(allocation_count == 0uz) << "allocations during steady state:" << allocation_count;
+        expect(resource.counter().allocations == warm_up_counter.allocations)
+            << "buffer allocations during steady state:"
+            << resource.counter().allocations - warm_up_counter.allocations;
+
+        // Every frame is flushed once and its requests are the same size.
+        const auto flushes = client.flush_stats();
+        expect(flushes.flushes - warm_up_flushes.flushes == frames);
+        expect(flushes.partial_flushes == 0uz);
+        expect(flushes.flushed_bytes - warm_up_flushes.flushed_bytes
+               == frames * warm_up_flushes.largest_flush_bytes);
+    };
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_parser.hpp"
+#include "waylander/wayland/message_visitor.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/timeline_tracer.hpp"
+
+#include "mock_compositor.hpp"
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+    using namespace wl::protocols;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    static constexpr auto contains = [](const std::string& str, const std::string_view part) {
+        return str.find(part) != std::string::npos;
+    };
+
+    wl_tag / "timeline_tracer records activity of connected_client"_test = [] {
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto compositor                 = wl::mock_compositor{ std::move(server_sock) };
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+
+        auto tracer = wl::timeline_tracer{};
+        client.set_timeline(&tracer);
+
+        const auto registry = client.reserve_object_id<wl_registry>();
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(wl::global_display_object,
+                                wl_display::request::get_registry{ registry });
+        client.register_request(wl::global_display_object, wl_display::request::sync{ callback });
+        client.flush_registered_requests();
+        compositor.dispatch();
+
+        auto ov = wl::message_overload_set{};
+        ov.add_overload<wl_registry::event::global>(registry, [](const auto&) {});
+        client.recv_and_visit_events(ov).until<wl_callback::event::done>(callback);
+
+        const auto json = tracer.chrome_trace_json();
+        expect(contains(json, "\"traceEvents\""));
+        expect(contains(json, "\"name\": \"wl_display.get_registry\""));
+        expect(contains(json, "\"name\": \"wl_display.sync\""));
+        expect(contains(json, "\"name\": \"flush\""));
+        expect(contains(json, "\"name\": \"read\""));
+        expect(contains(json, "\"name\": \"wl_registry.global\""));
+        expect(contains(json, "\"name\": \"until wl_callback.done\""));
+        expect(tracer.overwritten_records() == 0uz);
+    };
+
+    wl_tag / "timeline_tracer records dispatches of message_visit"_test = [] {
+        const auto callback = wl::Wobject<wl_callback>{ 3 };
+        auto events         = wl::message_buffer{};
+        events.append(callback, wl_callback::event::done{ .callback_data{ 1u } });
+        const auto data = events.release_data();
+
+        auto visited = 0uz;
+        auto ov      = wl::message_overload_set{};
+        ov.add_overload<wl_callback::event::done>(callback, [&](const auto&) { ++visited; });
+
+        auto tracer = wl::timeline_tracer{};
+        wl::message_visit([] {}, ov, wl::parsed_message_range{ data }, &tracer);
+
+        expect(visited == 1uz);
+        expect(contains(tracer.chrome_trace_json(), "\"name\": \"wl_callback.done\""));
+    };
+
+    wl_tag / "timeline_tracer keeps latest records of each thread"_test = [] {
+        auto tracer = wl::timeline_tracer{ 2 };
+        for (auto i = 0; i < 3; ++i) { tracer.record({ .kind = wl::timeline_kind::flush }); }
+        std::thread{ [&] { tracer.record({ .kind = wl::timeline_kind::socket_read }); } }.join();
+
+        expect(tracer.overwritten_records() == 1uz);
+        const auto json = tracer.chrome_trace_json();
+        expect(contains(json, "\"name\": \"flush\""));
+        expect(contains(json, "\"name\": \"read\""));
+    };
+}
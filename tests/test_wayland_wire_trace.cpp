@@ -0,0 +1,225 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gnulander/local_stream_socket.hpp"
+
+#include "waylander/byte_vec.hpp"
+#include "waylander/wayland/connected_client.hpp"
+#include "waylander/wayland/message_buffer.hpp"
+#include "waylander/wayland/message_overload_set.hpp"
+#include "waylander/wayland/message_utils.hpp"
+#include "waylander/wayland/parsed_message.hpp"
+#include "waylander/wayland/protocol_primitives.hpp"
+#include "waylander/wayland/protocols/wayland_protocol.hpp"
+#include "waylander/wayland/wire_trace.hpp"
+
+namespace {
+
+/// Trace consisting of the records currently in \p ring.
+auto trace_of(waylander::wl::wire_trace_ring& ring) {
+    using namespace waylander;
+    auto trace = sstd::byte_vec(wl::wire_trace_magic.begin(), wl::wire_trace_magic.end());
+    ring.consume([&](const auto bytes) { trace.insert(trace.end(), bytes.begin(), bytes.end()); });
+    return trace;
+}
+
+} // namespace
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    wl_tag / "wire_trace_range reads records of wire_trace_ring"_test = [] {
+        auto ring = wl::wire_trace_ring{ 256 };
+
+        const auto a = std::vector{ std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+        const auto b = std::vector<std::byte>(13, std::byte{ 4 });
+        expect(ring.record(wl::wire_direction::sent, a, 1));
+        expect(ring.record(wl::wire_direction::received, b));
+
+        const auto trace = trace_of(ring);
+        auto records     = std::vector<wl::wire_trace_record>{};
+        for (const auto& record : wl::wire_trace_range{ trace }) { records.push_back(record); }
+
+        expect(fatal(records.size() == 2uz));
+        expect(records[0].direction == wl::wire_direction::sent);
+        expect(records[0].fd_count == 1uz);
+        expect(std::ranges::equal(records[0].data, a));
+        expect(records[1].direction == wl::wire_direction::received);
+        expect(records[1].fd_count == 0uz);
+        expect(std::ranges::equal(records[1].data, b));
+        expect(records[0].timestamp <= records[1].timestamp);
+    };
+
+    wl_tag / "wire_trace_ring drops records which do not fit"_test = [] {
+        auto ring = wl::wire_trace_ring{ 64 };
+        expect(ring.capacity() == 64uz);
+
+        // Header is 16 bytes, so two 16 byte records fit to 64 bytes.
+        const auto bytes = std::vector<std::byte>(16);
+        expect(ring.record(wl::wire_direction::sent, bytes));
+        expect(ring.record(wl::wire_direction::sent, bytes));
+        expect(not ring.record(wl::wire_direction::sent, bytes));
+        expect(ring.dropped_records() == 1uz);
+
+        expect(ring.consume([](const auto) {}) == 64uz);
+        expect(ring.record(wl::wire_direction::sent, bytes));
+    };
+
+    wl_tag / "wire_trace_ring records wrap around"_test = [] {
+        auto ring = wl::wire_trace_ring{ 64 };
+
+        auto bytes = std::vector<std::byte>(20);
+        for (auto i = 0uz; i < bytes.size(); ++i) { bytes[i] = static_cast<std::byte>(i); }
+
+        for (auto round = 0uz; round < 10uz; ++round) {
+            expect(ring.record(wl::wire_direction::received, bytes));
+            const auto trace = trace_of(ring);
+            auto records     = 0uz;
+            for (const auto& record : wl::wire_trace_range{ trace }) {
+                ++records;
+                expect(std::ranges::equal(record.data, bytes));
+            }
+            expect(records == 1uz);
+        }
+    };
+
+    wl_tag / "wire_trace_range detects invalid traces"_test = [] {
+        const auto garbage = std::vector<std::byte>(16);
+        expect(throws<std::logic_error>([&] { std::ignore = wl::wire_trace_range{ garbage }; }));
+
+        auto ring = wl::wire_trace_ring{ 64 };
+        expect(ring.record(wl::wire_direction::sent, std::vector<std::byte>(8)));
+        auto trace = trace_of(ring);
+        trace.resize(trace.size() - 4);
+        const auto range = wl::wire_trace_range{ trace };
+        expect(throws<std::logic_error>([&] { std::ignore = range.begin(); }));
+    };
+
+    wl_tag / "wire_trace_file writes trace which can be read back"_test = [] {
+        const auto path = std::filesystem::temp_directory_path() / "waylander_test_wire_trace";
+
+        auto ring = wl::wire_trace_ring{ 1024 };
+        expect(ring.record(wl::wire_direction::sent, std::vector<std::byte>(100)));
+        expect(ring.record(wl::wire_direction::received, std::vector<std::byte>(7)));
+        const auto expected = trace_of(ring);
+
+        expect(ring.record(wl::wire_direction::sent, std::vector<std::byte>(100)));
+        expect(ring.record(wl::wire_direction::received, std::vector<std::byte>(7)));
+        {
+            auto file = wl::wire_trace_file{ path };
+            file.flush(ring);
+            expect(file.size() == expected.size());
+        }
+
+        const auto trace = wl::read_wire_trace_file(path);
+        std::filesystem::remove(path);
+
+        auto sizes = std::vector<std::size_t>{};
+        for (const auto& record : wl::wire_trace_range{ trace }) {
+            sizes.push_back(record.data.size());
+        }
+        expect(trace.size() == expected.size());
+        expect(sizes == std::vector{ 100uz, 7uz });
+    };
+
+    wl_tag / "connected_client records sent and received bytes"_test = [] {
+        using wl_display  = wl::protocols::wl_display;
+        using wl_callback = wl::protocols::wl_callback;
+        using sync        = wl_display::request::sync;
+        using done        = wl_callback::event::done;
+
+        auto [client_sock, server_sock] = gnulander::open_local_stream_socket_pair();
+        auto client                     = wl::connected_client{ std::move(client_sock) };
+        auto ring                       = wl::wire_trace_ring{ 1024 };
+        client.set_wire_trace(&ring);
+
+        const auto callback = client.reserve_object_id<wl_callback>();
+        client.register_request(wl::global_display_object, sync{ callback });
+        client.flush_registered_requests();
+
+        constexpr auto request_size =
+            sizeof(wl::message_header<wl_display>) + wl::message_payload_size(sync{});
+        auto request_bytes = sstd::byte_vec(request_size);
+        server_sock.read(request_bytes);
+
+        auto event_buff = wl::message_buffer{};
+        event_buff.append(callback, done{ .callback_data{ 42u } });
+        const auto event_bytes = event_buff.release_data();
+        server_sock.write(event_bytes);
+
+        auto ov = wl::message_overload_set{};
+        client.recv_and_visit_events(ov).until<done>(callback);
+
+        const auto trace = trace_of(ring);
+        auto records     = std::vector<wl::wire_trace_record>{};
+        for (const auto& record : wl::wire_trace_range{ trace }) { records.push_back(record); }
+
+        expect(fatal(records.size() == 2uz));
+        expect(records[0].direction == wl::wire_direction::sent);
+        expect(std::ranges::equal(records[0].data, request_bytes));
+        expect(records[1].direction == wl::wire_direction::received);
+        expect(std::ranges::equal(records[1].data, event_bytes));
+    };
+
+    wl_tag / "replay_wire_trace reassembles messages split between records"_test = [] {
+        using wl_callback = wl::protocols::wl_callback;
+        using done        = wl_callback::event::done;
+
+        const auto callback = wl::Wobject<wl_callback>{ 3 };
+        auto events         = wl::message_buffer{};
+        for (auto i = 0u; i < 10u; ++i) { events.append(callback, done{ .callback_data{ i } }); }
+        const auto data = events.release_data();
+
+        // Split to 5 byte records, in between of sent records which are not replayed.
+        auto ring = wl::wire_trace_ring{ 4096 };
+        for (auto bytes = std::span<const std::byte>{ data }; not bytes.empty();) {
+            const auto size = std::min(bytes.size(), 5uz);
+            expect(ring.record(wl::wire_direction::received, bytes.first(size)));
+            expect(ring.record(wl::wire_direction::sent, bytes.first(size)));
+            bytes = bytes.subspan(size);
+        }
+        const auto trace = trace_of(ring);
+
+        auto callback_data = std::vector<wl::Wuint::integral_type>{};
+        auto ov            = wl::message_overload_set{};
+        ov.add_overload<done>(callback, [&](const done& msg) {
+            callback_data.push_back(msg.callback_data.value);
+        });
+
+        expect(wl::replay_wire_trace(trace, ov) == 10uz);
+        expect(callback_data == std::vector{ 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u });
+
+        auto visited = 0uz;
+        wl::replay_wire_trace(trace, [&](const wl::parsed_message& msg) {
+            visited += msg.object_id.value == callback.value;
+        });
+        expect(visited == 10uz);
+    };
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2024 Miro Palmu.
+//
+// This file is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/ut.hpp> // import boost.ut;
+
+import waylander;
+import waylander.protocols.wayland;
+
+int main() {
+    using namespace boost::ut;
+    using namespace waylander;
+
+    static const auto wl_tag = tag("wayland");
+    // Run wl_tag:
+    cfg<override> = { .tag = { "wayland" } };
+
+    wl_tag / "request encoded with imported names can be parsed back"_test = [] {
+        using get_registry = wl::protocols::wl_display::request::get_registry;
+
+        auto buff = wl::message_buffer{};
+        buff.append(wl::global_display_object, get_registry{ 2u });
+
+        const auto parsed_msg = wl::parse_first_message(buff.data());
+        expect(parsed_msg.object_id.value == wl::global_display_object.value);
+        expect(parsed_msg.opcode.value == get_registry::opcode.value);
+        expect(parsed_msg.arguments.size() == 4uz);
+    };
+
+    wl_tag / "imported names can be mixed with included headers"_test = [] {
+        expect(wl::whole_messages_size(wl::message_buffer{}.data()) == 0uz);
+    };
+}